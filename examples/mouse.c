@@ -10,16 +10,9 @@
 /// or clear the screen when the right is pressed.
 /// @param context graphical context to use.
 static void render(gfx_context_t *context) {
+    // Mouse position in background coordinates, whatever the window size
     int x, y;
-    uint32_t button = SDL_GetMouseState(&x, &y);
-
-    // Scale mouse position to window size
-    int width, height;
-    SDL_GetWindowSize(context->window, &width, &height);
-    float sx = ((float)width/DISPLAY_WIDTH);
-    float sy = ((float)height/DISPLAY_HEIGHT);
-    x /= sx;
-    y /= sy;
+    uint32_t button = gfx_mouse_state(context, &x, &y);
 
     // Left button: draw a "cross" at mouse position
     if (button & 1) {
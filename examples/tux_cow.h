@@ -1,3281 +0,0 @@
-// I know we should never declare variables in .h, but this is an exception ;-)
-
-static uint8_t tux_cow[65536] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0x76,0x6d,0x12,
-    0xb9,0xb5,0xa4,0xa8,0xaa,0xa7,0x99,0x6f,0x79,0x78,0x70,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0x79,0x71,0x09,
-    0xb1,0xad,0x9e,0x87,0xc6,0xc1,0xae,0xe7,0x7e,0x7b,0x71,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x79,0x6e,0x45,0xdf,0xda,0xc3,0xfa,0xe5,0xe0,0xcb,0xfb,
-    0xb8,0xb4,0xa6,0x96,0x7c,0x79,0x72,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x78,0x76,0x6f,0x07,0xb7,0xb4,0xa5,0x95,0xe6,0xe0,0xcb,0xfc,0xdb,0xd5,0xbd,0xfc,
-    0x85,0x81,0x74,0x5a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x6e,0x6c,0x62,0x47,0xcb,0xc4,0xad,0xfa,0xe9,0xe4,0xcd,0xff,0xe7,0xe2,0xce,0xfb,0xb6,0xb3,0xa5,0x8f,
-    0x7c,0x7a,0x73,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x6b,0x66,0x04,0xb1,0xae,0xa1,0x7f,
-    0xe5,0xe0,0xcc,0xfb,0xe7,0xe2,0xcb,0xff,0xc0,0xba,0xa3,0xfa,0x6e,0x6b,0x60,0x4c,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x5b,0x53,0x2b,0xa5,0xa0,0x89,0xf7,
-    0xde,0xd8,0xc1,0xff,0xeb,0xe6,0xd0,0xff,0xe8,0xe3,0xd1,0xfb,0xb9,0xb6,0xaa,0x97,0x7f,0x7d,0x77,0x0b,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x64,0x63,0x5f,0x03,0xac,0xa9,0x9d,0x69,0xe3,0xde,0xcc,0xf8,0xeb,0xe5,0xcf,0xff,0xd9,0xd3,0xbb,0xff,
-    0x9c,0x96,0x80,0xf6,0x5c,0x5a,0x51,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x5c,0x59,0x4e,0x0d,0x81,0x7b,0x66,0xe4,0xc0,0xba,0xa2,0xff,0xe7,0xe1,0xca,0xff,
-    0xec,0xe7,0xd3,0xff,0xea,0xe5,0xd4,0xfc,0xbe,0xbb,0xaf,0xa4,0x81,0x7f,0x78,0x0f,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x62,0x5e,0x02,0xa6,0xa3,0x99,0x5a,0xe1,0xdc,0xcb,0xf4,
-    0xec,0xe7,0xd2,0xff,0xe6,0xe0,0xc9,0xff,0xba,0xb4,0x9c,0xff,0x7a,0x75,0x61,0xda,0x59,0x56,0x4b,0x0a,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x48,0x44,0x04,
-    0x62,0x5d,0x4c,0xae,0x99,0x93,0x7b,0xff,0xd4,0xce,0xb6,0xff,0xea,0xe5,0xce,0xff,0xed,0xe8,0xd4,0xff,
-    0xec,0xe8,0xd6,0xfd,0xc4,0xc1,0xb5,0xb1,0x83,0x81,0x7a,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x63,0x5f,0x01,
-    0xa2,0x9f,0x96,0x4f,0xde,0xdb,0xcb,0xef,0xed,0xe8,0xd4,0xff,0xea,0xe4,0xce,0xff,0xd1,0xcb,0xb3,0xff,
-    0x94,0x8e,0x76,0xff,0x5f,0x5a,0x49,0x9c,0x46,0x46,0x44,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0x48,0x3d,0x6a,0x71,0x6b,0x54,0xfd,
-    0xb0,0xa9,0x91,0xff,0xe1,0xdb,0xc3,0xff,0xeb,0xe6,0xd0,0xff,0xee,0xe9,0xd6,0xff,0xee,0xea,0xd9,0xfe,
-    0xcc,0xc9,0xbc,0xc2,0x87,0x86,0x7f,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x64,0x63,0x5f,0x01,0x9f,0x9d,0x94,0x49,0xde,0xda,0xca,0xec,0xee,0xe9,0xd6,0xff,
-    0xeb,0xe6,0xd0,0xff,0xe0,0xda,0xc3,0xff,0xad,0xa7,0x8f,0xff,0x6f,0x68,0x51,0xfb,0x4b,0x48,0x3f,0x54,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x43,0x41,0x3d,0x22,0x4e,0x48,0x35,0xf1,0x86,0x7f,0x67,0xff,0xc2,0xbc,0xa4,0xff,
-    0xe7,0xe1,0xca,0xff,0xec,0xe7,0xd2,0xff,0xee,0xea,0xd8,0xff,0xef,0xeb,0xdb,0xff,0xd4,0xd1,0xc4,0xd3,
-    0x92,0x90,0x89,0x33,0x65,0x64,0x61,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x63,0x5f,0x01,0x9f,0x9d,0x94,0x48,
-    0xdd,0xd9,0xcb,0xea,0xee,0xea,0xd8,0xff,0xec,0xe7,0xd3,0xff,0xe8,0xe2,0xcb,0xff,0xc3,0xbd,0xa5,0xff,
-    0x85,0x7f,0x67,0xff,0x4e,0x49,0x37,0xe5,0x43,0x42,0x3d,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x41,0x3e,0x05,
-    0x3e,0x3a,0x2d,0xb2,0x5c,0x56,0x3f,0xff,0x98,0x92,0x7a,0xff,0xd1,0xcc,0xb4,0xff,0xea,0xe4,0xce,0xff,
-    0xed,0xe8,0xd4,0xff,0xef,0xea,0xd9,0xff,0xf0,0xec,0xdc,0xff,0xdc,0xd9,0xcc,0xe4,0xa1,0x9f,0x97,0x4c,
-    0x64,0x63,0x60,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x63,0x62,0x5f,0x02,0xa2,0xa0,0x97,0x4d,0xde,0xda,0xcc,0xeb,0xef,0xeb,0xd9,0xff,0xed,0xe8,0xd4,0xff,
-    0xea,0xe5,0xce,0xff,0xd4,0xce,0xb6,0xff,0x9a,0x94,0x7c,0xff,0x5d,0x57,0x40,0xff,0x3f,0x3c,0x30,0x97,
-    0x4c,0x4c,0x4b,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0xd0,0xd0,0x01,0xd3,0xd3,0xd3,0x01,
-    0xc4,0xc4,0xc4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x3d,0x36,0x57,0x3f,0x38,0x22,0xfb,
-    0x6d,0x66,0x4f,0xff,0xa8,0xa3,0x8a,0xff,0xdc,0xd6,0xbe,0xff,0xeb,0xe5,0xcf,0xff,0xed,0xe8,0xd4,0xff,
-    0xef,0xeb,0xd9,0xff,0xf1,0xed,0xdd,0xff,0xe3,0xe0,0xd3,0xf2,0xb0,0xae,0xa5,0x72,0x7a,0x78,0x74,0x07,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x04,
-    0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x06,
-    0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x05,
-    0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x03,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x64,0x61,0x03,0xa7,0xa5,0x9c,0x59,0xe1,0xdd,0xcf,0xef,
-    0xef,0xeb,0xda,0xff,0xed,0xe9,0xd6,0xff,0xeb,0xe6,0xd0,0xff,0xdf,0xd9,0xc2,0xff,0xae,0xa8,0x90,0xff,
-    0x70,0x6a,0x53,0xff,0x41,0x3b,0x26,0xf7,0x54,0x53,0x4f,0x3e,0xdc,0xdc,0xdc,0x04,0xe3,0xe3,0xe3,0x04,
-    0xe8,0xe8,0xe8,0x04,0xe1,0xe1,0xe1,0x04,0xdf,0xdf,0xdf,0x04,0xdf,0xdf,0xdf,0x04,0xdd,0xdd,0xdd,0x03,
-    0xd7,0xd7,0xd7,0x02,0xd6,0xd6,0xd6,0x01,0xd2,0xd2,0xd2,0x01,0xb8,0xb8,0xb8,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xe9,0xe9,0xe9,0x01,0xec,0xec,0xec,0x01,0xed,0xed,0xed,0x02,0xec,0xec,0xec,0x02,0xec,0xec,0xec,0x03,
-    0xe9,0xe9,0xe9,0x03,0xed,0xed,0xed,0x04,0xf3,0xf3,0xf3,0x04,0xeb,0xeb,0xeb,0x04,0xea,0xea,0xea,0x03,
-    0xeb,0xeb,0xeb,0x03,0x70,0x6f,0x6d,0x11,0x3c,0x37,0x29,0xd8,0x47,0x41,0x29,0xff,0x7c,0x76,0x5e,0xff,
-    0xb6,0xb0,0x98,0xff,0xe2,0xdc,0xc5,0xff,0xeb,0xe6,0xd0,0xff,0xed,0xe8,0xd5,0xff,0xef,0xeb,0xda,0xff,
-    0xf1,0xed,0xdd,0xff,0xeb,0xe7,0xda,0xfa,0xc0,0xbe,0xb3,0xa1,0x83,0x82,0x7c,0x17,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x07,
-    0xff,0xff,0xff,0x08,0xff,0xff,0xff,0x09,0xff,0xff,0xff,0x0a,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x0c,
-    0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x0d,
-    0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x0a,
-    0xff,0xff,0xff,0x09,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x04,
-    0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x75,0x70,0x06,
-    0xaf,0xad,0xa4,0x6f,0xe4,0xe0,0xd3,0xf4,0xf0,0xec,0xdb,0xff,0xee,0xe9,0xd7,0xff,0xec,0xe6,0xd2,0xff,
-    0xe6,0xe0,0xc9,0xff,0xbe,0xb8,0xa0,0xff,0x82,0x7c,0x64,0xff,0x4a,0x44,0x2c,0xff,0x46,0x43,0x39,0xc7,
-    0xb9,0xb9,0xb9,0x1f,0xcc,0xcc,0xcc,0x1a,0xc9,0xc9,0xc9,0x1b,0xc9,0xc9,0xc9,0x1c,0xca,0xca,0xca,0x1b,
-    0xce,0xce,0xce,0x19,0xcf,0xcf,0xcf,0x16,0xd9,0xd9,0xd9,0x12,0xe5,0xe5,0xe5,0x0e,0xe8,0xe8,0xe8,0x0b,
-    0xe9,0xe9,0xe9,0x08,0xe7,0xe7,0xe7,0x06,0xe0,0xe0,0xe0,0x04,0xda,0xda,0xda,0x02,0xd5,0xd5,0xd5,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xec,0xec,0xec,0x01,0xee,0xee,0xee,0x02,0xec,0xec,0xec,0x03,0xeb,0xeb,0xeb,0x06,0xeb,0xeb,0xeb,0x08,
-    0xe9,0xe9,0xe9,0x0b,0xe3,0xe3,0xe3,0x0e,0xd8,0xd8,0xd8,0x12,0xd4,0xd4,0xd4,0x15,0xcc,0xcc,0xcc,0x17,
-    0xcc,0xcc,0xcc,0x17,0xd0,0xd0,0xd0,0x16,0xd8,0xd8,0xd8,0x13,0xe0,0xe0,0xe0,0x10,0xe1,0xe1,0xe1,0x0e,
-    0x54,0x52,0x4d,0x7b,0x39,0x32,0x1b,0xfd,0x52,0x4b,0x34,0xff,0x8a,0x83,0x6b,0xff,0xc1,0xbb,0xa3,0xff,
-    0xe5,0xe0,0xc8,0xff,0xec,0xe6,0xd1,0xff,0xed,0xe9,0xd5,0xff,0xef,0xeb,0xd9,0xff,0xf1,0xed,0xdd,0xff,
-    0xef,0xec,0xde,0xfe,0xd2,0xcf,0xc3,0xcf,0x99,0x96,0x8f,0x3e,0x65,0x65,0x61,0x03,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x08,
-    0xff,0xff,0xff,0x0a,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x0e,0xff,0xff,0xff,0x10,0xff,0xff,0xff,0x12,
-    0xff,0xff,0xff,0x14,0xff,0xff,0xff,0x15,0xfe,0xfe,0xfe,0x17,0xfa,0xfa,0xfa,0x18,0xf5,0xf5,0xf5,0x1a,
-    0xf2,0xf2,0xf2,0x1b,0xf1,0xf1,0xf1,0x1b,0xf2,0xf2,0xf2,0x1b,0xf6,0xf6,0xf6,0x1a,0xfb,0xfb,0xfb,0x18,
-    0xff,0xff,0xff,0x16,0xff,0xff,0xff,0x15,0xff,0xff,0xff,0x13,0xff,0xff,0xff,0x11,0xff,0xff,0xff,0x0f,
-    0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x0c,0xff,0xff,0xff,0x0a,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x06,
-    0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xba,0xba,0xba,0x01,0x8b,0x8a,0x85,0x0f,0xba,0xb8,0xae,0x92,0xe9,0xe5,0xd7,0xf9,0xf0,0xec,0xdc,0xff,
-    0xee,0xea,0xd7,0xff,0xec,0xe7,0xd3,0xff,0xe8,0xe3,0xcc,0xff,0xcb,0xc5,0xae,0xff,0x93,0x8c,0x74,0xff,
-    0x58,0x52,0x3b,0xff,0x3a,0x33,0x1e,0xff,0x45,0x44,0x42,0xde,0x4c,0x4c,0x4c,0xca,0x47,0x47,0x47,0xd6,
-    0x45,0x45,0x45,0xe0,0x45,0x45,0x45,0xe2,0x45,0x45,0x45,0xdd,0x48,0x48,0x48,0xd2,0x4d,0x4d,0x4d,0xc2,
-    0x56,0x56,0x56,0xab,0x62,0x62,0x62,0x8c,0x77,0x77,0x77,0x65,0xa2,0xa2,0xa2,0x39,0xd0,0xd0,0xd0,0x1e,
-    0xe2,0xe2,0xe2,0x13,0xe8,0xe8,0xe8,0x0c,0xe8,0xe8,0xe8,0x08,0xe2,0xe2,0xe2,0x04,0xd5,0xd5,0xd5,0x02,
-    0xb7,0xb7,0xb7,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xd2,0xd2,0xd2,0x01,0xe9,0xe9,0xe9,0x01,0xf0,0xf0,0xf0,0x03,0xeb,0xeb,0xeb,0x06,0xeb,0xeb,0xeb,0x0a,
-    0xdf,0xdf,0xdf,0x11,0xc7,0xc7,0xc7,0x1d,0x8f,0x8f,0x8f,0x3e,0x69,0x69,0x69,0x6c,0x57,0x57,0x57,0x91,
-    0x4d,0x4d,0x4d,0xac,0x47,0x47,0x47,0xbe,0x45,0x45,0x45,0xc9,0x45,0x45,0x45,0xca,0x47,0x47,0x47,0xc2,
-    0x4d,0x4d,0x4d,0xb3,0x55,0x55,0x55,0x9d,0x63,0x63,0x63,0x7e,0x6e,0x6e,0x6e,0x6d,0x3d,0x39,0x2c,0xef,
-    0x3a,0x33,0x1a,0xff,0x5d,0x56,0x3f,0xff,0x94,0x8e,0x76,0xff,0xc9,0xc3,0xab,0xff,0xe7,0xe1,0xcb,0xff,
-    0xec,0xe6,0xd1,0xff,0xed,0xe9,0xd5,0xff,0xef,0xea,0xd9,0xff,0xf0,0xec,0xdc,0xff,0xf1,0xed,0xde,0xff,
-    0xe2,0xdf,0xd1,0xf2,0xb6,0xb3,0xa9,0x85,0x86,0x84,0x7e,0x14,0xd6,0xd6,0xd6,0x01,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x08,
-    0xff,0xff,0xff,0x0b,0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x10,0xff,0xff,0xff,0x13,0xff,0xff,0xff,0x17,
-    0xf9,0xf9,0xf9,0x1b,0xe9,0xe9,0xe9,0x21,0xce,0xce,0xce,0x2e,0x9b,0x9b,0x9b,0x4d,0x7d,0x7d,0x7d,0x6c,
-    0x6b,0x6b,0x6b,0x85,0x61,0x61,0x61,0x98,0x58,0x58,0x58,0xa5,0x55,0x55,0x55,0xad,0x54,0x54,0x54,0xaf,
-    0x55,0x55,0x55,0xac,0x59,0x59,0x59,0xa2,0x63,0x63,0x63,0x94,0x6f,0x6f,0x6f,0x7f,0x83,0x83,0x83,0x64,
-    0xa7,0xa7,0xa7,0x43,0xd8,0xd8,0xd8,0x29,0xed,0xed,0xed,0x1f,0xfc,0xfc,0xfc,0x19,0xff,0xff,0xff,0x15,
-    0xff,0xff,0xff,0x12,0xff,0xff,0xff,0x0f,0xff,0xff,0xff,0x0d,0xfd,0xfd,0xfd,0x0a,0xfa,0xfa,0xfa,0x07,
-    0xf8,0xf8,0xf8,0x06,0xfb,0xfb,0xfb,0x04,0xfd,0xfd,0xfd,0x03,0xfe,0xfe,0xfe,0x02,0xfd,0xfd,0xfd,0x01,
-    0xe9,0xe9,0xe9,0x01,0xd6,0xd6,0xd6,0x01,0xc8,0xc8,0xc8,0x04,0x94,0x92,0x8d,0x2b,0xca,0xc7,0xbc,0xbc,
-    0xed,0xea,0xdb,0xfd,0xf0,0xec,0xdb,0xff,0xee,0xea,0xd8,0xff,0xec,0xe7,0xd3,0xff,0xea,0xe4,0xce,0xff,
-    0xd5,0xcf,0xb7,0xff,0xa0,0x9a,0x82,0xff,0x66,0x60,0x48,0xff,0x3c,0x35,0x1d,0xff,0x48,0x45,0x3c,0xff,
-    0x62,0x62,0x62,0xff,0x67,0x67,0x67,0xff,0x6a,0x6a,0x6a,0xff,0x6c,0x6c,0x6c,0xff,0x6c,0x6c,0x6c,0xff,
-    0x6c,0x6c,0x6c,0xff,0x69,0x69,0x69,0xff,0x65,0x65,0x65,0xff,0x60,0x60,0x60,0xff,0x59,0x59,0x59,0xfe,
-    0x52,0x52,0x52,0xfb,0x4b,0x4b,0x4b,0xf5,0x4f,0x4f,0x4f,0xd2,0x64,0x64,0x64,0x96,0x90,0x90,0x90,0x4f,
-    0xce,0xce,0xce,0x1f,0xe0,0xe0,0xe0,0x10,0xd9,0xd9,0xd9,0x08,0xc6,0xc6,0xc6,0x04,0xab,0xab,0xab,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe2,0xe2,0xe2,0x01,0xeb,0xeb,0xeb,0x03,0xe7,0xe7,0xe7,0x07,
-    0xe6,0xe6,0xe6,0x0d,0xcb,0xcb,0xcb,0x1b,0x81,0x81,0x81,0x4f,0x57,0x57,0x57,0x9b,0x42,0x42,0x42,0xda,
-    0x40,0x40,0x40,0xf7,0x46,0x46,0x46,0xfc,0x4c,0x4c,0x4c,0xff,0x52,0x52,0x52,0xff,0x56,0x56,0x56,0xff,
-    0x58,0x58,0x58,0xff,0x58,0x58,0x58,0xff,0x57,0x57,0x57,0xff,0x55,0x55,0x55,0xff,0x51,0x51,0x51,0xff,
-    0x4c,0x4c,0x4c,0xfe,0x46,0x46,0x46,0xfb,0x41,0x40,0x3c,0xfe,0x38,0x31,0x1b,0xff,0x3d,0x36,0x1e,0xff,
-    0x66,0x60,0x48,0xff,0x9c,0x96,0x7e,0xff,0xce,0xc9,0xb1,0xff,0xe8,0xe2,0xcb,0xff,0xec,0xe6,0xd1,0xff,
-    0xed,0xe8,0xd5,0xff,0xef,0xea,0xd8,0xff,0xf0,0xec,0xdb,0xff,0xf0,0xec,0xdc,0xff,0xee,0xea,0xdb,0xfd,
-    0xd2,0xcf,0xc2,0xd5,0xa4,0xa2,0x99,0x5f,0xa3,0xa2,0x9e,0x0f,0xec,0xec,0xec,0x05,0xff,0xff,0xff,0x07,
-    0xff,0xff,0xff,0x09,0xff,0xff,0xff,0x0d,0xff,0xff,0xff,0x10,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0x18,
-    0xf4,0xf4,0xf4,0x1f,0xcf,0xcf,0xcf,0x2f,0x89,0x89,0x89,0x62,0x62,0x62,0x62,0x9a,0x48,0x48,0x48,0xcb,
-    0x39,0x39,0x39,0xef,0x37,0x37,0x37,0xf9,0x38,0x38,0x38,0xfc,0x39,0x39,0x39,0xfe,0x3b,0x3b,0x3b,0xff,
-    0x3c,0x3c,0x3c,0xff,0x3c,0x3c,0x3c,0xff,0x3c,0x3c,0x3c,0xff,0x3c,0x3c,0x3c,0xff,0x3c,0x3c,0x3c,0xff,
-    0x3a,0x3a,0x3a,0xff,0x39,0x39,0x39,0xfd,0x38,0x38,0x38,0xfb,0x37,0x37,0x37,0xf8,0x3a,0x3a,0x3a,0xe8,
-    0x4e,0x4e,0x4e,0xbf,0x6a,0x6a,0x6a,0x8c,0x97,0x97,0x97,0x53,0xdd,0xdd,0xdd,0x28,0xf5,0xf5,0xf5,0x1d,
-    0xf1,0xf1,0xf1,0x18,0xe3,0xe3,0xe3,0x15,0xd6,0xd6,0xd6,0x12,0xcd,0xcd,0xcd,0x0e,0xc9,0xc9,0xc9,0x0b,
-    0xce,0xce,0xce,0x07,0xd9,0xd9,0xd9,0x05,0xe0,0xe0,0xe0,0x04,0xe9,0xe9,0xe9,0x05,0xb9,0xb9,0xb7,0x0f,
-    0xac,0xaa,0xa2,0x68,0xda,0xd7,0xcb,0xe5,0xf0,0xec,0xdd,0xff,0xf0,0xec,0xdb,0xff,0xee,0xea,0xd7,0xff,
-    0xed,0xe8,0xd3,0xff,0xeb,0xe5,0xcf,0xff,0xdb,0xd5,0xbd,0xff,0xab,0xa5,0x8d,0xff,0x73,0x6c,0x55,0xff,
-    0x42,0x3b,0x24,0xff,0x3b,0x35,0x23,0xff,0x7e,0x7d,0x7c,0xff,0x95,0x95,0x95,0xff,0x98,0x98,0x98,0xff,
-    0x9b,0x9b,0x9b,0xff,0x9c,0x9c,0x9c,0xff,0x9c,0x9c,0x9c,0xff,0x9b,0x9b,0x9b,0xff,0x98,0x98,0x98,0xff,
-    0x94,0x94,0x94,0xff,0x8e,0x8e,0x8e,0xff,0x87,0x87,0x87,0xff,0x7e,0x7e,0x7e,0xff,0x73,0x73,0x73,0xff,
-    0x66,0x66,0x66,0xff,0x56,0x56,0x56,0xfe,0x48,0x48,0x48,0xf8,0x4a,0x4a,0x4a,0xc9,0x6a,0x6a,0x6a,0x6d,
-    0xad,0xad,0xad,0x1d,0xc4,0xc4,0xc4,0x09,0xb0,0xb0,0xb0,0x03,0x5c,0x5c,0x5c,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaf,0xaf,0xaf,0x01,
-    0xdc,0xdc,0xdc,0x03,0xdd,0xdd,0xdd,0x09,0xb4,0xb4,0xb4,0x1c,0x67,0x67,0x67,0x6a,0x44,0x44,0x44,0xca,
-    0x41,0x41,0x41,0xf9,0x4e,0x4e,0x4e,0xfe,0x5c,0x5c,0x5c,0xff,0x67,0x67,0x67,0xff,0x71,0x71,0x71,0xff,
-    0x78,0x78,0x78,0xff,0x7d,0x7d,0x7d,0xff,0x81,0x81,0x81,0xff,0x83,0x83,0x83,0xff,0x84,0x84,0x84,0xff,
-    0x83,0x83,0x83,0xff,0x80,0x80,0x80,0xff,0x7c,0x7c,0x7c,0xff,0x77,0x77,0x77,0xff,0x70,0x70,0x70,0xff,
-    0x67,0x67,0x67,0xff,0x46,0x43,0x3a,0xff,0x37,0x30,0x17,0xff,0x41,0x3a,0x22,0xff,0x6e,0x67,0x50,0xff,
-    0xa1,0x9b,0x83,0xff,0xd1,0xcb,0xb3,0xff,0xe8,0xe2,0xcb,0xff,0xeb,0xe6,0xd1,0xff,0xed,0xe8,0xd4,0xff,
-    0xee,0xea,0xd7,0xff,0xef,0xeb,0xd9,0xff,0xf0,0xeb,0xdb,0xff,0xf0,0xeb,0xdb,0xff,0xe9,0xe5,0xd5,0xfb,
-    0xd0,0xcc,0xbe,0xd3,0xb2,0xb0,0xa4,0x7c,0xa3,0xa2,0x9d,0x35,0xe1,0xe1,0xdf,0x19,0xf9,0xf9,0xf9,0x17,
-    0xfc,0xfc,0xfc,0x1c,0xe0,0xe0,0xe0,0x2a,0x8e,0x8e,0x8e,0x61,0x5b,0x5b,0x5b,0xac,0x3d,0x3d,0x3d,0xe9,
-    0x3a,0x3a,0x3a,0xfb,0x3d,0x3d,0x3d,0xff,0x41,0x41,0x41,0xff,0x45,0x45,0x45,0xff,0x48,0x48,0x48,0xff,
-    0x4b,0x4b,0x4b,0xff,0x4e,0x4e,0x4e,0xff,0x4f,0x4f,0x4f,0xff,0x51,0x51,0x51,0xff,0x51,0x51,0x51,0xff,
-    0x51,0x51,0x51,0xff,0x51,0x51,0x51,0xff,0x50,0x50,0x50,0xff,0x4f,0x4f,0x4f,0xff,0x4d,0x4d,0x4d,0xff,
-    0x4a,0x4a,0x4a,0xff,0x47,0x47,0x47,0xff,0x43,0x43,0x43,0xff,0x3f,0x3f,0x3f,0xff,0x3b,0x3b,0x3b,0xfe,
-    0x39,0x39,0x39,0xf9,0x41,0x41,0x41,0xdd,0x60,0x60,0x60,0x9b,0x8d,0x8d,0x8d,0x53,0xb2,0xb2,0xb2,0x2d,
-    0xab,0xab,0xab,0x25,0x9f,0x9f,0x9f,0x1f,0x98,0x98,0x98,0x1a,0x97,0x97,0x97,0x14,0xa2,0xa2,0xa2,0x10,
-    0xb0,0xb0,0xaf,0x14,0xa0,0x9f,0x99,0x4b,0xc9,0xc7,0xbb,0xbd,0xea,0xe6,0xd7,0xfb,0xf0,0xec,0xdc,0xff,
-    0xef,0xeb,0xda,0xff,0xee,0xe9,0xd7,0xff,0xed,0xe7,0xd3,0xff,0xeb,0xe5,0xcf,0xff,0xdf,0xd9,0xc1,0xff,
-    0xb4,0xad,0x96,0xff,0x7d,0x77,0x5f,0xff,0x4a,0x43,0x2c,0xff,0x38,0x31,0x18,0xff,0x68,0x66,0x61,0xff,
-    0xb1,0xb1,0xb1,0xff,0xb6,0xb6,0xb6,0xff,0xb7,0xb7,0xb7,0xff,0xb7,0xb7,0xb7,0xff,0xb6,0xb6,0xb6,0xff,
-    0xb4,0xb4,0xb4,0xff,0xb1,0xb1,0xb1,0xff,0xad,0xad,0xad,0xff,0xa9,0xa9,0xa9,0xff,0xa3,0xa3,0xa3,0xff,
-    0x9c,0x9c,0x9c,0xff,0x94,0x94,0x94,0xff,0x89,0x89,0x89,0xff,0x7d,0x7d,0x7d,0xff,0x6d,0x6d,0x6d,0xff,
-    0x5b,0x5b,0x5b,0xff,0x46,0x46,0x46,0xff,0x31,0x31,0x31,0xfb,0x2c,0x2c,0x2c,0xcd,0x44,0x44,0x44,0x54,
-    0x82,0x82,0x82,0x0a,0x91,0x91,0x91,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc6,0xc6,0xc6,0x01,0x9e,0x9e,0x9e,0x0a,0x52,0x52,0x52,0x52,
-    0x30,0x30,0x30,0xcc,0x34,0x34,0x34,0xfb,0x49,0x49,0x49,0xff,0x5f,0x5f,0x5f,0xff,0x71,0x71,0x71,0xff,
-    0x80,0x80,0x80,0xff,0x8b,0x8b,0x8b,0xff,0x94,0x94,0x94,0xff,0x9a,0x9a,0x9a,0xff,0x9e,0x9e,0x9e,0xff,
-    0xa1,0xa1,0xa1,0xff,0xa3,0xa3,0xa3,0xff,0xa3,0xa3,0xa3,0xff,0xa3,0xa3,0xa3,0xff,0xa1,0xa1,0xa1,0xff,
-    0x9f,0x9f,0x9f,0xff,0x9b,0x9b,0x9b,0xff,0x96,0x96,0x96,0xff,0x90,0x90,0x90,0xff,0x78,0x78,0x77,0xff,
-    0x3c,0x36,0x24,0xff,0x37,0x30,0x17,0xff,0x45,0x3f,0x27,0xff,0x73,0x6c,0x54,0xff,0xa4,0x9e,0x86,0xff,
-    0xd1,0xcb,0xb3,0xff,0xe8,0xe2,0xcb,0xff,0xeb,0xe6,0xd0,0xff,0xec,0xe7,0xd3,0xff,0xed,0xe9,0xd6,0xff,
-    0xee,0xe9,0xd7,0xff,0xef,0xea,0xd8,0xff,0xef,0xea,0xd9,0xff,0xee,0xea,0xd8,0xff,0xeb,0xe7,0xd4,0xfd,
-    0xde,0xda,0xc8,0xf6,0xcc,0xc8,0xb7,0xd3,0xba,0xb7,0xaa,0x93,0x81,0x80,0x7e,0x86,0x47,0x47,0x47,0xd6,
-    0x3b,0x3b,0x3b,0xfa,0x40,0x40,0x40,0xff,0x46,0x46,0x46,0xff,0x4c,0x4c,0x4c,0xff,0x51,0x51,0x51,0xff,
-    0x55,0x55,0x55,0xff,0x59,0x59,0x59,0xff,0x5c,0x5c,0x5c,0xff,0x5f,0x5f,0x5f,0xff,0x62,0x62,0x62,0xff,
-    0x63,0x63,0x63,0xff,0x64,0x64,0x64,0xff,0x65,0x65,0x65,0xff,0x65,0x65,0x65,0xff,0x65,0x65,0x65,0xff,
-    0x64,0x64,0x64,0xff,0x63,0x63,0x63,0xff,0x61,0x61,0x61,0xff,0x5e,0x5e,0x5e,0xff,0x5b,0x5b,0x5b,0xff,
-    0x58,0x58,0x58,0xff,0x54,0x54,0x54,0xff,0x4f,0x4f,0x4f,0xff,0x4a,0x4a,0x4a,0xff,0x43,0x43,0x43,0xff,
-    0x3a,0x3a,0x3a,0xfe,0x34,0x34,0x34,0xf7,0x3e,0x3e,0x3e,0xc8,0x58,0x58,0x58,0x79,0x73,0x73,0x73,0x44,
-    0x79,0x79,0x77,0x3c,0x7c,0x7b,0x77,0x4c,0xa3,0xa1,0x97,0x7c,0xc9,0xc6,0xb9,0xc4,0xe5,0xe1,0xd2,0xf8,
-    0xf0,0xec,0xdb,0xff,0xf0,0xec,0xdb,0xff,0xef,0xeb,0xd9,0xff,0xee,0xe9,0xd6,0xff,0xec,0xe7,0xd3,0xff,
-    0xeb,0xe5,0xcf,0xff,0xe1,0xdb,0xc3,0xff,0xb9,0xb3,0x9b,0xff,0x85,0x7f,0x67,0xff,0x51,0x4b,0x33,0xff,
-    0x38,0x31,0x18,0xff,0x42,0x3d,0x2e,0xff,0xa9,0xa9,0xa8,0xff,0xc1,0xc1,0xc1,0xff,0xbf,0xbf,0xbf,0xff,
-    0xbc,0xbc,0xbc,0xff,0xb8,0xb8,0xb8,0xff,0xb3,0xb3,0xb3,0xff,0xad,0xad,0xad,0xff,0xa7,0xa7,0xa7,0xff,
-    0xa0,0xa0,0xa0,0xff,0x99,0x99,0x99,0xff,0x92,0x92,0x92,0xff,0x8b,0x8b,0x8b,0xff,0x82,0x82,0x82,0xff,
-    0x7a,0x7a,0x7a,0xff,0x70,0x70,0x70,0xff,0x64,0x64,0x64,0xff,0x56,0x56,0x56,0xff,0x44,0x44,0x44,0xff,
-    0x30,0x30,0x30,0xff,0x1c,0x1c,0x1c,0xff,0x0e,0x0e,0x0e,0xf7,0x10,0x10,0x10,0x92,0x4b,0x4b,0x4b,0x05,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x49,0x49,0x49,0x11,0x19,0x19,0x19,0x9e,0x15,0x15,0x15,0xf7,0x27,0x27,0x27,0xff,0x3f,0x3f,0x3f,0xff,
-    0x58,0x58,0x58,0xff,0x6e,0x6e,0x6e,0xff,0x80,0x80,0x80,0xff,0x8d,0x8d,0x8d,0xff,0x98,0x98,0x98,0xff,
-    0xa0,0xa0,0xa0,0xff,0xa5,0xa5,0xa5,0xff,0xaa,0xaa,0xaa,0xff,0xae,0xae,0xae,0xff,0xb0,0xb0,0xb0,0xff,
-    0xb2,0xb2,0xb2,0xff,0xb2,0xb2,0xb2,0xff,0xb2,0xb2,0xb2,0xff,0xb2,0xb2,0xb2,0xff,0xb0,0xb0,0xb0,0xff,
-    0xae,0xae,0xae,0xff,0xaa,0xaa,0xaa,0xff,0xa4,0xa4,0xa4,0xff,0x6c,0x6b,0x68,0xff,0x38,0x31,0x19,0xff,
-    0x37,0x30,0x17,0xff,0x48,0x42,0x2a,0xff,0x75,0x6f,0x57,0xff,0xa4,0x9e,0x86,0xff,0xcf,0xc8,0xb0,0xff,
-    0xe6,0xe1,0xc9,0xff,0xeb,0xe5,0xcf,0xff,0xec,0xe7,0xd2,0xff,0xed,0xe8,0xd4,0xff,0xed,0xe8,0xd5,0xff,
-    0xed,0xe9,0xd6,0xff,0xed,0xe9,0xd6,0xff,0xed,0xe8,0xd5,0xff,0xec,0xe7,0xd3,0xff,0xeb,0xe6,0xd1,0xff,
-    0xe8,0xe2,0xcc,0xfe,0xc5,0xc0,0xac,0xfd,0x64,0x62,0x5a,0xff,0x47,0x47,0x47,0xff,0x4f,0x4f,0x4f,0xff,
-    0x58,0x58,0x58,0xff,0x5f,0x5f,0x5f,0xff,0x64,0x64,0x64,0xff,0x69,0x69,0x69,0xff,0x6c,0x6c,0x6c,0xff,
-    0x6f,0x6f,0x6f,0xff,0x71,0x71,0x71,0xff,0x73,0x73,0x73,0xff,0x75,0x75,0x75,0xff,0x76,0x76,0x76,0xff,
-    0x76,0x76,0x76,0xff,0x76,0x76,0x76,0xff,0x76,0x76,0x76,0xff,0x75,0x75,0x75,0xff,0x74,0x74,0x74,0xff,
-    0x73,0x73,0x73,0xff,0x71,0x71,0x71,0xff,0x6e,0x6e,0x6e,0xff,0x6b,0x6b,0x6b,0xff,0x67,0x67,0x67,0xff,
-    0x62,0x62,0x62,0xff,0x5d,0x5d,0x5d,0xff,0x52,0x52,0x52,0xff,0x45,0x45,0x45,0xff,0x3a,0x3a,0x3a,0xff,
-    0x3a,0x39,0x38,0xff,0x6f,0x6c,0x64,0xfb,0xaf,0xac,0x9d,0xe0,0xcc,0xc8,0xb8,0xe6,0xde,0xda,0xc9,0xf8,
-    0xec,0xe7,0xd6,0xfd,0xef,0xea,0xd9,0xff,0xef,0xeb,0xda,0xff,0xef,0xeb,0xd9,0xff,0xee,0xea,0xd8,0xff,
-    0xed,0xe9,0xd5,0xff,0xec,0xe7,0xd2,0xff,0xeb,0xe5,0xcf,0xff,0xe1,0xdb,0xc4,0xff,0xbc,0xb6,0x9e,0xff,
-    0x8b,0x84,0x6c,0xff,0x58,0x51,0x3a,0xff,0x39,0x32,0x1a,0xff,0x38,0x31,0x1a,0xff,0x7e,0x7d,0x7a,0xff,
-    0xbc,0xbc,0xbc,0xff,0xb7,0xb7,0xb7,0xff,0xb0,0xb0,0xb0,0xff,0xa7,0xa7,0xa7,0xff,0x9d,0x9d,0x9d,0xff,
-    0x93,0x93,0x93,0xff,0x89,0x89,0x89,0xff,0x7f,0x7f,0x7f,0xff,0x76,0x76,0x76,0xff,0x6d,0x6d,0x6d,0xff,
-    0x65,0x65,0x65,0xff,0x5e,0x5e,0x5e,0xff,0x57,0x57,0x57,0xff,0x50,0x50,0x50,0xff,0x49,0x49,0x49,0xff,
-    0x42,0x42,0x42,0xff,0x39,0x39,0x39,0xff,0x2e,0x2e,0x2e,0xff,0x21,0x21,0x21,0xff,0x14,0x14,0x14,0xff,
-    0x09,0x09,0x09,0xff,0x09,0x09,0x09,0xb3,0x3a,0x3a,0x3a,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x2f,0x2f,0x1f,0x07,0x07,0x07,0xf4,
-    0x12,0x12,0x12,0xff,0x24,0x24,0x24,0xff,0x3a,0x3a,0x3a,0xff,0x50,0x50,0x50,0xff,0x62,0x62,0x62,0xff,
-    0x72,0x72,0x72,0xff,0x7e,0x7e,0x7e,0xff,0x88,0x88,0x88,0xff,0x91,0x91,0x91,0xff,0x98,0x98,0x98,0xff,
-    0x9e,0x9e,0x9e,0xff,0xa4,0xa4,0xa4,0xff,0xa9,0xa9,0xa9,0xff,0xad,0xad,0xad,0xff,0xb0,0xb0,0xb0,0xff,
-    0xb3,0xb3,0xb3,0xff,0xb5,0xb5,0xb5,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,0xb6,0xb6,0xb6,0xff,
-    0xb4,0xb4,0xb4,0xff,0xa7,0xa7,0xa7,0xff,0x53,0x50,0x48,0xff,0x37,0x30,0x17,0xff,0x38,0x31,0x18,0xff,
-    0x4a,0x43,0x2c,0xff,0x75,0x6f,0x57,0xff,0xa1,0x9b,0x83,0xff,0xc9,0xc3,0xab,0xff,0xe3,0xdd,0xc6,0xff,
-    0xea,0xe4,0xce,0xff,0xeb,0xe6,0xd0,0xff,0xec,0xe7,0xd2,0xff,0xec,0xe7,0xd3,0xff,0xec,0xe7,0xd3,0xff,
-    0xec,0xe7,0xd2,0xff,0xec,0xe6,0xd1,0xff,0xeb,0xe5,0xcf,0xff,0xea,0xe4,0xcd,0xff,0xdd,0xd7,0xbf,0xff,
-    0xaf,0xa9,0x93,0xff,0x52,0x4d,0x4d,0xff,0x51,0x4e,0x51,0xff,0x5e,0x5e,0x5e,0xff,0x6b,0x6b,0x6b,0xff,
-    0x73,0x73,0x73,0xff,0x78,0x78,0x78,0xff,0x7b,0x7b,0x7b,0xff,0x7d,0x7d,0x7d,0xff,0x7f,0x7f,0x7f,0xff,
-    0x81,0x81,0x81,0xff,0x82,0x82,0x82,0xff,0x82,0x82,0x82,0xff,0x83,0x83,0x83,0xff,0x83,0x83,0x83,0xff,
-    0x83,0x83,0x83,0xff,0x82,0x82,0x82,0xff,0x82,0x82,0x82,0xff,0x80,0x80,0x80,0xff,0x7f,0x7f,0x7f,0xff,
-    0x7d,0x7d,0x7d,0xff,0x7a,0x7a,0x7a,0xff,0x77,0x77,0x77,0xff,0x73,0x73,0x73,0xff,0x6d,0x6d,0x6d,0xff,
-    0x5c,0x5c,0x5c,0xff,0x4b,0x48,0x4b,0xff,0x4f,0x49,0x4b,0xff,0xb1,0xac,0x9b,0xff,0xe5,0xdf,0xc9,0xff,
-    0xeb,0xe6,0xd1,0xff,0xed,0xe8,0xd4,0xff,0xee,0xe9,0xd6,0xff,0xee,0xe9,0xd7,0xff,0xee,0xea,0xd7,0xff,
-    0xee,0xe9,0xd7,0xff,0xee,0xe9,0xd6,0xff,0xed,0xe8,0xd4,0xff,0xec,0xe6,0xd1,0xff,0xea,0xe5,0xce,0xff,
-    0xe0,0xda,0xc2,0xff,0xbc,0xb6,0x9e,0xff,0x8d,0x87,0x6f,0xff,0x5c,0x56,0x3f,0xff,0x3b,0x34,0x1c,0xff,
-    0x37,0x30,0x17,0xff,0x4f,0x4b,0x43,0xff,0xa4,0xa4,0xa4,0xff,0xa5,0xa5,0xa5,0xff,0x98,0x98,0x98,0xff,
-    0x8a,0x8a,0x8a,0xff,0x7c,0x7c,0x7c,0xff,0x6e,0x6e,0x6e,0xff,0x62,0x62,0x62,0xff,0x56,0x56,0x56,0xff,
-    0x4c,0x4c,0x4c,0xff,0x43,0x43,0x43,0xff,0x3b,0x3b,0x3b,0xff,0x34,0x34,0x34,0xff,0x2f,0x2f,0x2f,0xff,
-    0x29,0x29,0x29,0xff,0x25,0x25,0x25,0xff,0x21,0x21,0x21,0xff,0x1d,0x1d,0x1d,0xff,0x19,0x19,0x19,0xff,
-    0x15,0x15,0x15,0xff,0x0f,0x0f,0x0f,0xff,0x08,0x08,0x08,0xff,0x04,0x04,0x04,0xfd,0x06,0x06,0x06,0x6e,
-    0x23,0x23,0x23,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x46,0x46,0x46,0x0a,0x07,0x07,0x07,0xd9,0x0c,0x0c,0x0c,0xff,0x19,0x19,0x19,0xff,
-    0x28,0x28,0x28,0xff,0x37,0x37,0x37,0xff,0x43,0x43,0x43,0xff,0x4f,0x4f,0x4f,0xff,0x59,0x59,0x59,0xff,
-    0x63,0x63,0x63,0xff,0x6c,0x6c,0x6c,0xff,0x75,0x75,0x75,0xff,0x7d,0x7d,0x7d,0xff,0x86,0x86,0x86,0xff,
-    0x8e,0x8e,0x8e,0xff,0x96,0x96,0x96,0xff,0x9d,0x9d,0x9d,0xff,0xa4,0xa4,0xa4,0xff,0xaa,0xaa,0xaa,0xff,
-    0xaf,0xaf,0xaf,0xff,0xb2,0xb2,0xb2,0xff,0xb5,0xb5,0xb5,0xff,0xb7,0xb7,0xb7,0xff,0xb8,0xb8,0xb8,0xff,
-    0x9b,0x9a,0x9a,0xff,0x41,0x3c,0x2d,0xff,0x37,0x30,0x17,0xff,0x38,0x31,0x18,0xff,0x4a,0x43,0x2b,0xff,
-    0x72,0x6c,0x54,0xff,0x9b,0x95,0x7d,0xff,0xc0,0xba,0xa3,0xff,0xdd,0xd7,0xbf,0xff,0xe9,0xe3,0xcb,0xff,
-    0xea,0xe5,0xce,0xff,0xeb,0xe6,0xd0,0xff,0xeb,0xe6,0xd0,0xff,0xeb,0xe6,0xd0,0xff,0xeb,0xe5,0xcf,0xff,
-    0xea,0xe5,0xce,0xff,0xe9,0xe3,0xcb,0xff,0xd6,0xd0,0xb8,0xff,0xb1,0xab,0x93,0xff,0x4f,0x46,0x48,0xff,
-    0x4a,0x40,0x4a,0xff,0x5d,0x59,0x5d,0xff,0x6e,0x6e,0x6e,0xff,0x7c,0x7c,0x7c,0xff,0x83,0x83,0x83,0xff,
-    0x86,0x86,0x86,0xff,0x88,0x88,0x88,0xff,0x89,0x89,0x89,0xff,0x8a,0x8a,0x8a,0xff,0x8b,0x8b,0x8b,0xff,
-    0x8b,0x8b,0x8b,0xff,0x8b,0x8b,0x8b,0xff,0x8b,0x8b,0x8b,0xff,0x8b,0x8b,0x8b,0xff,0x8b,0x8b,0x8b,0xff,
-    0x8a,0x8a,0x8a,0xff,0x8a,0x8a,0x8a,0xff,0x88,0x88,0x88,0xff,0x87,0x87,0x87,0xff,0x85,0x85,0x85,0xff,
-    0x83,0x83,0x83,0xff,0x81,0x81,0x81,0xff,0x7a,0x7a,0x7a,0xff,0x5f,0x5c,0x5f,0xff,0x4e,0x45,0x4c,0xff,
-    0x9d,0x98,0x86,0xff,0xe0,0xda,0xc2,0xff,0xea,0xe4,0xce,0xff,0xeb,0xe6,0xd0,0xff,0xec,0xe7,0xd2,0xff,
-    0xed,0xe8,0xd4,0xff,0xed,0xe8,0xd5,0xff,0xed,0xe8,0xd4,0xff,0xed,0xe8,0xd4,0xff,0xec,0xe7,0xd2,0xff,
-    0xeb,0xe6,0xd0,0xff,0xe9,0xe3,0xcd,0xff,0xdd,0xd7,0xbf,0xff,0xb9,0xb3,0x9b,0xff,0x8d,0x87,0x6f,0xff,
-    0x5f,0x58,0x41,0xff,0x3c,0x35,0x1d,0xff,0x37,0x30,0x17,0xff,0x3b,0x35,0x23,0xff,0x7d,0x7c,0x7b,0xff,
-    0x8e,0x8e,0x8e,0xff,0x7b,0x7b,0x7b,0xff,0x69,0x69,0x69,0xff,0x58,0x58,0x58,0xff,0x49,0x49,0x49,0xff,
-    0x3d,0x3d,0x3d,0xff,0x32,0x32,0x32,0xff,0x29,0x29,0x29,0xff,0x21,0x21,0x21,0xff,0x1b,0x1b,0x1b,0xff,
-    0x16,0x16,0x16,0xff,0x12,0x12,0x12,0xff,0x10,0x10,0x10,0xff,0x0d,0x0d,0x0d,0xff,0x0a,0x0a,0x0a,0xff,
-    0x09,0x09,0x09,0xff,0x07,0x07,0x07,0xff,0x06,0x06,0x06,0xff,0x05,0x05,0x05,0xff,0x03,0x03,0x03,0xff,
-    0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xe8,0x03,0x03,0x03,0x1d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x4c,0x4c,0x04,
-    0x08,0x08,0x08,0x9e,0x05,0x05,0x05,0xff,0x0c,0x0c,0x0c,0xff,0x13,0x13,0x13,0xff,0x1b,0x1b,0x1b,0xff,
-    0x22,0x22,0x22,0xff,0x29,0x29,0x29,0xff,0x31,0x31,0x31,0xff,0x38,0x38,0x38,0xff,0x41,0x41,0x41,0xff,
-    0x4a,0x4a,0x4a,0xff,0x53,0x53,0x53,0xff,0x5c,0x5c,0x5c,0xff,0x66,0x66,0x66,0xff,0x71,0x71,0x71,0xff,
-    0x7b,0x7b,0x7b,0xff,0x85,0x85,0x85,0xff,0x8f,0x8f,0x8f,0xff,0x99,0x99,0x99,0xff,0xa1,0xa1,0xa1,0xff,
-    0xa9,0xa9,0xa9,0xff,0xaf,0xaf,0xaf,0xff,0xb4,0xb4,0xb4,0xff,0xb5,0xb5,0xb5,0xff,0x86,0x86,0x84,0xff,
-    0x3b,0x35,0x21,0xff,0x37,0x30,0x17,0xff,0x38,0x31,0x18,0xff,0x48,0x41,0x29,0xff,0x6d,0x67,0x4f,0xff,
-    0x93,0x8d,0x74,0xff,0xb5,0xaf,0x97,0xff,0xd1,0xcb,0xb3,0xff,0xe3,0xdd,0xc5,0xff,0xe9,0xe3,0xcc,0xff,
-    0xea,0xe4,0xcd,0xff,0xea,0xe4,0xcd,0xff,0xea,0xe4,0xcd,0xff,0xe9,0xe3,0xcc,0xff,0xe2,0xdc,0xc4,0xff,
-    0xcb,0xc4,0xad,0xff,0x93,0x8d,0x7b,0xff,0x3a,0x2a,0x38,0xff,0x49,0x3d,0x49,0xff,0x5f,0x59,0x5f,0xff,
-    0x72,0x72,0x72,0xff,0x81,0x81,0x81,0xff,0x8a,0x8a,0x8a,0xff,0x8d,0x8d,0x8d,0xff,0x8e,0x8e,0x8e,0xff,
-    0x8f,0x8f,0x8f,0xff,0x8f,0x8f,0x8f,0xff,0x90,0x90,0x90,0xff,0x90,0x90,0x90,0xff,0x90,0x90,0x90,0xff,
-    0x90,0x90,0x90,0xff,0x90,0x90,0x90,0xff,0x90,0x90,0x90,0xff,0x90,0x90,0x90,0xff,0x8f,0x8f,0x8f,0xff,
-    0x8f,0x8f,0x8f,0xff,0x8e,0x8e,0x8e,0xff,0x8d,0x8d,0x8d,0xff,0x8b,0x8b,0x8b,0xff,0x89,0x89,0x89,0xff,
-    0x81,0x81,0x81,0xff,0x5d,0x55,0x5d,0xff,0x5b,0x53,0x52,0xff,0xb7,0xb0,0x99,0xff,0xdc,0xd6,0xbe,0xff,
-    0xea,0xe4,0xcd,0xff,0xeb,0xe5,0xcf,0xff,0xeb,0xe6,0xd1,0xff,0xec,0xe7,0xd1,0xff,0xec,0xe7,0xd2,0xff,
-    0xec,0xe6,0xd1,0xff,0xeb,0xe6,0xd0,0xff,0xea,0xe5,0xce,0xff,0xe7,0xe2,0xca,0xff,0xd6,0xd0,0xb8,0xff,
-    0xb4,0xad,0x95,0xff,0x8b,0x84,0x6c,0xff,0x5f,0x58,0x41,0xff,0x3d,0x36,0x1e,0xff,0x37,0x30,0x17,0xff,
-    0x38,0x31,0x19,0xff,0x57,0x55,0x51,0xff,0x72,0x72,0x72,0xff,0x5e,0x5e,0x5e,0xff,0x4a,0x4a,0x4a,0xff,
-    0x39,0x39,0x39,0xff,0x2b,0x2b,0x2b,0xff,0x20,0x20,0x20,0xff,0x18,0x18,0x18,0xff,0x11,0x11,0x11,0xff,
-    0x0d,0x0d,0x0d,0xff,0x09,0x09,0x09,0xff,0x06,0x06,0x06,0xff,0x05,0x05,0x05,0xff,0x03,0x03,0x03,0xff,
-    0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0x83,
-    0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x05,0x05,0x54,0x02,0x02,0x02,0xfb,
-    0x03,0x03,0x03,0xff,0x06,0x06,0x06,0xff,0x08,0x08,0x08,0xff,0x0b,0x0b,0x0b,0xff,0x0f,0x0f,0x0f,0xff,
-    0x13,0x13,0x13,0xff,0x18,0x18,0x18,0xff,0x1d,0x1d,0x1d,0xff,0x24,0x24,0x24,0xff,0x2a,0x2a,0x2a,0xff,
-    0x33,0x33,0x33,0xff,0x3b,0x3b,0x3b,0xff,0x45,0x45,0x45,0xff,0x50,0x50,0x50,0xff,0x5b,0x5b,0x5b,0xff,
-    0x68,0x68,0x68,0xff,0x74,0x74,0x74,0xff,0x81,0x81,0x81,0xff,0x8e,0x8e,0x8e,0xff,0x9a,0x9a,0x9a,0xff,
-    0xa4,0xa4,0xa4,0xff,0xad,0xad,0xad,0xff,0xaf,0xaf,0xaf,0xff,0x76,0x74,0x72,0xff,0x39,0x33,0x1d,0xff,
-    0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,0x44,0x3d,0x25,0xff,0x65,0x5f,0x47,0xff,0x88,0x82,0x6a,0xff,
-    0xa6,0xa0,0x88,0xff,0xc0,0xb9,0xa2,0xff,0xd3,0xcd,0xb5,0xff,0xde,0xd8,0xc1,0xff,0xe3,0xdd,0xc5,0xff,
-    0xe3,0xdd,0xc5,0xff,0xde,0xd8,0xc0,0xff,0xd0,0xca,0xb2,0xff,0xaf,0xaa,0x94,0xff,0x4b,0x44,0x43,0xff,
-    0x3a,0x28,0x3a,0xff,0x4f,0x44,0x4f,0xff,0x66,0x61,0x66,0xff,0x79,0x79,0x79,0xff,0x87,0x87,0x87,0xff,
-    0x8f,0x8f,0x8f,0xff,0x91,0x91,0x91,0xff,0x91,0x91,0x91,0xff,0x91,0x91,0x91,0xff,0x92,0x92,0x92,0xff,
-    0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,
-    0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,0x91,0x91,0x91,0xff,0x91,0x91,0x91,0xff,
-    0x90,0x90,0x90,0xff,0x90,0x90,0x90,0xff,0x8f,0x8f,0x8f,0xff,0x86,0x85,0x86,0xff,0x58,0x4e,0x58,0xff,
-    0x45,0x3a,0x3f,0xff,0xab,0xa6,0x8f,0xff,0xd3,0xcd,0xb5,0xff,0xe7,0xe1,0xca,0xff,0xea,0xe4,0xcd,0xff,
-    0xea,0xe5,0xce,0xff,0xeb,0xe5,0xcf,0xff,0xeb,0xe5,0xcf,0xff,0xea,0xe5,0xce,0xff,0xe9,0xe4,0xcc,0xff,
-    0xe2,0xdc,0xc4,0xff,0xcc,0xc6,0xae,0xff,0xab,0xa5,0x8d,0xff,0x85,0x7f,0x67,0xff,0x5d,0x56,0x3e,0xff,
-    0x3d,0x36,0x1e,0xff,0x37,0x30,0x17,0xff,0x37,0x30,0x18,0xff,0x42,0x3e,0x35,0xff,0x57,0x57,0x57,0xff,
-    0x45,0x45,0x45,0xff,0x31,0x31,0x31,0xff,0x22,0x22,0x22,0xff,0x16,0x16,0x16,0xff,0x0e,0x0e,0x0e,0xff,
-    0x09,0x09,0x09,0xff,0x05,0x05,0x05,0xff,0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xd0,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0xda,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x06,0x06,0x06,0xff,
-    0x09,0x09,0x09,0xff,0x0c,0x0c,0x0c,0xff,0x10,0x10,0x10,0xff,0x15,0x15,0x15,0xff,0x1a,0x1a,0x1a,0xff,
-    0x21,0x21,0x21,0xff,0x29,0x29,0x29,0xff,0x32,0x32,0x32,0xff,0x3d,0x3d,0x3d,0xff,0x4a,0x4a,0x4a,0xff,
-    0x58,0x58,0x58,0xff,0x67,0x67,0x67,0xff,0x78,0x78,0x78,0xff,0x88,0x88,0x88,0xff,0x97,0x97,0x97,0xff,
-    0xa4,0xa4,0xa4,0xff,0xa9,0xa9,0xa9,0xff,0x6e,0x6d,0x6a,0xff,0x39,0x32,0x1d,0xff,0x37,0x30,0x17,0xff,
-    0x37,0x30,0x17,0xff,0x40,0x39,0x21,0xff,0x5b,0x55,0x3d,0xff,0x7b,0x74,0x5c,0xff,0x95,0x8f,0x77,0xff,
-    0xab,0xa5,0x8d,0xff,0xbb,0xb5,0x9d,0xff,0xc5,0xbf,0xa6,0xff,0xc8,0xc2,0xaa,0xff,0xc4,0xbe,0xa6,0xff,
-    0xaf,0xa9,0x93,0xff,0x5a,0x54,0x4e,0xff,0x30,0x1d,0x30,0xff,0x44,0x35,0x44,0xff,0x5c,0x53,0x5c,0xff,
-    0x70,0x6f,0x70,0xff,0x82,0x82,0x82,0xff,0x8d,0x8d,0x8d,0xff,0x91,0x91,0x91,0xff,0x92,0x92,0x92,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,
-    0x91,0x91,0x91,0xff,0x89,0x88,0x89,0xff,0x56,0x4b,0x56,0xff,0x2c,0x1a,0x2b,0xff,0x7a,0x75,0x67,0xff,
-    0xc4,0xbe,0xa6,0xff,0xdc,0xd6,0xbe,0xff,0xe7,0xe1,0xc9,0xff,0xe9,0xe3,0xcc,0xff,0xe9,0xe3,0xcc,0xff,
-    0xe8,0xe2,0xcb,0xff,0xe3,0xdd,0xc5,0xff,0xd5,0xcf,0xb7,0xff,0xbe,0xb7,0x9f,0xff,0xa0,0x99,0x81,0xff,
-    0x7d,0x77,0x5f,0xff,0x58,0x51,0x3a,0xff,0x3c,0x35,0x1c,0xff,0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,
-    0x3b,0x36,0x28,0xff,0x42,0x42,0x41,0xff,0x32,0x32,0x32,0xff,0x1f,0x1f,0x1f,0xff,0x12,0x12,0x12,0xff,
-    0x0a,0x0a,0x0a,0xff,0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xec,0x00,0x00,0x00,0x3b,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x73,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,
-    0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x07,0x07,0x07,0xff,0x0a,0x0a,0x0a,0xff,0x0f,0x0f,0x0f,0xff,
-    0x14,0x14,0x14,0xff,0x1b,0x1b,0x1b,0xff,0x24,0x24,0x24,0xff,0x30,0x30,0x30,0xff,0x3e,0x3e,0x3e,0xff,
-    0x4e,0x4e,0x4e,0xff,0x61,0x61,0x61,0xff,0x75,0x75,0x75,0xff,0x89,0x89,0x89,0xff,0x9b,0x9b,0x9b,0xff,
-    0xa2,0xa2,0xa2,0xff,0x6e,0x6d,0x6a,0xff,0x3a,0x34,0x20,0xff,0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,
-    0x3b,0x34,0x1c,0xff,0x50,0x49,0x31,0xff,0x6b,0x64,0x4c,0xff,0x82,0x7c,0x64,0xff,0x94,0x8e,0x76,0xff,
-    0xa1,0x9b,0x82,0xff,0xa7,0xa0,0x89,0xff,0x99,0x93,0x7e,0xff,0x51,0x4b,0x46,0xff,0x2b,0x19,0x2b,0xff,
-    0x3f,0x2e,0x3f,0xff,0x55,0x4b,0x55,0xff,0x6b,0x67,0x6b,0xff,0x7e,0x7d,0x7e,0xff,0x8b,0x8b,0x8b,0xff,
-    0x91,0x91,0x91,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,0x8a,0x8a,0x8b,0xff,
-    0x5b,0x51,0x5c,0xff,0x2f,0x1b,0x2f,0xff,0x2d,0x23,0x2a,0xff,0x94,0x8f,0x7d,0xff,0xc6,0xc1,0xa8,0xff,
-    0xd4,0xce,0xb5,0xff,0xd9,0xd3,0xbb,0xff,0xd7,0xd1,0xb9,0xff,0xcf,0xc9,0xb1,0xff,0xc1,0xbb,0xa3,0xff,
-    0xac,0xa6,0x8e,0xff,0x92,0x8c,0x73,0xff,0x73,0x6c,0x54,0xff,0x51,0x4a,0x33,0xff,0x3a,0x33,0x1a,0xff,
-    0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,0x39,0x34,0x24,0xff,0x39,0x38,0x37,0xff,0x26,0x26,0x26,0xff,
-    0x15,0x15,0x15,0xff,0x0a,0x0a,0x0a,0xff,0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xf2,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0xd1,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x08,0x08,0x08,0xff,
-    0x0d,0x0d,0x0d,0xff,0x13,0x13,0x13,0xff,0x1c,0x1c,0x1c,0xff,0x29,0x29,0x29,0xff,0x3a,0x3a,0x3a,0xff,
-    0x4e,0x4e,0x4e,0xff,0x65,0x65,0x65,0xff,0x7e,0x7e,0x7e,0xff,0x91,0x91,0x91,0xff,0x94,0x94,0x94,0xff,
-    0x6b,0x69,0x68,0xff,0x3a,0x35,0x24,0xff,0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,0x38,0x31,0x18,0xff,
-    0x43,0x3d,0x25,0xff,0x59,0x53,0x3a,0xff,0x6d,0x67,0x4e,0xff,0x7b,0x74,0x5d,0xff,0x6e,0x68,0x58,0xff,
-    0x38,0x2f,0x32,0xff,0x2b,0x19,0x2b,0xff,0x3f,0x2e,0x3f,0xff,0x55,0x4a,0x55,0xff,0x6a,0x65,0x6a,0xff,
-    0x7c,0x7c,0x7c,0xff,0x8a,0x8a,0x8a,0xff,0x91,0x91,0x91,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x8d,0x8d,0x8d,0xff,0x65,0x5f,0x65,0xff,0x3e,0x2d,0x3e,0xff,
-    0x29,0x16,0x29,0xff,0x34,0x2a,0x2f,0xff,0x8f,0x8a,0x79,0xff,0xb6,0xb0,0x99,0xff,0xb9,0xb3,0x9b,0xff,
-    0xb5,0xae,0x96,0xff,0xa9,0xa3,0x8b,0xff,0x98,0x92,0x7a,0xff,0x81,0x7b,0x63,0xff,0x66,0x5f,0x47,0xff,
-    0x48,0x42,0x2a,0xff,0x38,0x31,0x19,0xff,0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,0x3a,0x35,0x26,0xff,
-    0x39,0x39,0x37,0xff,0x24,0x24,0x24,0xff,0x12,0x12,0x12,0xff,0x08,0x08,0x08,0xff,0x03,0x03,0x03,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x03,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0xf3,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,
-    0x09,0x09,0x09,0xff,0x11,0x11,0x11,0xff,0x1b,0x1b,0x1b,0xff,0x2b,0x2b,0x2b,0xff,0x41,0x41,0x41,0xff,
-    0x5c,0x5c,0x5c,0xff,0x75,0x75,0x75,0xff,0x80,0x80,0x80,0xff,0x5e,0x5b,0x5e,0xff,0x31,0x2a,0x2f,0xff,
-    0x37,0x31,0x2a,0xff,0x38,0x31,0x1d,0xff,0x37,0x30,0x18,0xff,0x37,0x31,0x19,0xff,0x3b,0x34,0x1e,0xff,
-    0x45,0x3f,0x30,0xff,0x3b,0x35,0x31,0xff,0x26,0x17,0x25,0xff,0x31,0x1f,0x31,0xff,0x45,0x35,0x45,0xff,
-    0x59,0x50,0x59,0xff,0x6d,0x69,0x6d,0xff,0x7e,0x7d,0x7e,0xff,0x8a,0x8a,0x8a,0xff,0x90,0x90,0x90,0xff,
-    0x92,0x92,0x92,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x8f,0x8f,0x8f,0xff,0x73,0x6f,0x73,0xff,0x51,0x46,0x51,0xff,0x3c,0x2a,0x3c,0xff,0x2c,0x18,0x2c,0xff,
-    0x2f,0x23,0x2c,0xff,0x73,0x6d,0x5f,0xff,0x95,0x8f,0x78,0xff,0x90,0x8a,0x72,0xff,0x82,0x7c,0x64,0xff,
-    0x6f,0x68,0x50,0xff,0x57,0x50,0x38,0xff,0x40,0x39,0x21,0xff,0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,
-    0x37,0x30,0x18,0xff,0x39,0x35,0x28,0xff,0x39,0x38,0x36,0xff,0x2c,0x2c,0x2c,0xff,0x19,0x19,0x19,0xff,
-    0x0d,0x0d,0x0d,0xff,0x06,0x06,0x06,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xe3,
-    0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x76,0x00,0x00,0x00,0xfa,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,
-    0x0a,0x0a,0x0a,0xff,0x15,0x15,0x15,0xff,0x26,0x26,0x26,0xff,0x3e,0x3e,0x3e,0xff,0x58,0x58,0x58,0xff,
-    0x4f,0x4f,0x4f,0xff,0x2e,0x2a,0x2e,0xff,0x2f,0x25,0x2f,0xff,0x2e,0x1e,0x2e,0xff,0x2f,0x24,0x2c,0xff,
-    0x31,0x29,0x28,0xff,0x2f,0x28,0x27,0xff,0x2a,0x21,0x27,0xff,0x24,0x13,0x23,0xff,0x2d,0x1b,0x2d,0xff,
-    0x3d,0x2d,0x3d,0xff,0x4e,0x43,0x4e,0xff,0x5e,0x58,0x5e,0xff,0x6c,0x6a,0x6c,0xff,0x78,0x77,0x78,0xff,
-    0x7f,0x7f,0x7f,0xff,0x84,0x84,0x84,0xff,0x87,0x87,0x87,0xff,0x8b,0x8b,0x8b,0xff,0x8e,0x8e,0x8e,0xff,
-    0x91,0x91,0x91,0xff,0x92,0x92,0x92,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x91,0x91,0x91,0xff,0x7f,0x7f,0x7f,0xff,
-    0x66,0x5f,0x66,0xff,0x50,0x44,0x50,0xff,0x40,0x2f,0x40,0xff,0x33,0x20,0x33,0xff,0x2c,0x1b,0x2c,0xff,
-    0x48,0x41,0x3e,0xff,0x63,0x5d,0x4a,0xff,0x5b,0x54,0x3d,0xff,0x47,0x40,0x29,0xff,0x3a,0x33,0x1a,0xff,
-    0x37,0x30,0x17,0xff,0x37,0x30,0x17,0xff,0x38,0x31,0x1d,0xff,0x3c,0x37,0x32,0xff,0x3d,0x3c,0x3c,0xff,
-    0x30,0x30,0x30,0xff,0x25,0x25,0x25,0xff,0x18,0x18,0x18,0xff,0x0e,0x0e,0x0e,0xff,0x08,0x08,0x08,0xff,
-    0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xc2,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
-    0x00,0x00,0x00,0x8c,0x00,0x00,0x00,0xfa,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,0x0c,0x0c,0x0c,0xff,
-    0x18,0x18,0x18,0xff,0x2b,0x2b,0x2b,0xff,0x33,0x33,0x33,0xff,0x2e,0x2e,0x2e,0xff,0x37,0x36,0x37,0xff,
-    0x3e,0x39,0x3e,0xff,0x40,0x35,0x40,0xff,0x3c,0x2e,0x3c,0xff,0x38,0x28,0x38,0xff,0x37,0x28,0x37,0xff,
-    0x3d,0x2f,0x3d,0xff,0x47,0x3b,0x47,0xff,0x51,0x48,0x51,0xff,0x5b,0x56,0x5b,0xff,0x64,0x62,0x64,0xff,
-    0x6d,0x6d,0x6d,0xff,0x73,0x73,0x73,0xff,0x77,0x77,0x77,0xff,0x78,0x78,0x78,0xff,0x79,0x79,0x79,0xff,
-    0x78,0x78,0x78,0xff,0x7a,0x7a,0x7a,0xff,0x7d,0x7d,0x7d,0xff,0x84,0x84,0x84,0xff,0x8b,0x8b,0x8b,0xff,
-    0x90,0x90,0x90,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,0x8a,0x8a,0x8a,0xff,0x77,0x76,0x77,0xff,0x65,0x5f,0x65,0xff,
-    0x55,0x4a,0x55,0xff,0x47,0x38,0x47,0xff,0x3d,0x2b,0x3d,0xff,0x36,0x22,0x35,0xff,0x33,0x24,0x32,0xff,
-    0x39,0x30,0x32,0xff,0x39,0x33,0x2b,0xff,0x39,0x34,0x25,0xff,0x39,0x33,0x24,0xff,0x3a,0x33,0x2d,0xff,
-    0x38,0x2e,0x35,0xff,0x40,0x37,0x40,0xff,0x47,0x46,0x47,0xff,0x3a,0x3a,0x3a,0xff,0x2b,0x2b,0x2b,0xff,
-    0x1e,0x1e,0x1e,0xff,0x13,0x13,0x13,0xff,0x0b,0x0b,0x0b,0xff,0x06,0x06,0x06,0xff,0x03,0x03,0x03,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x0f,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,
-    0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,0x0b,0x0b,0x0b,0xff,0x14,0x14,0x14,0xff,0x20,0x20,0x20,0xff,
-    0x2a,0x2a,0x2a,0xff,0x39,0x39,0x39,0xff,0x48,0x48,0x48,0xff,0x54,0x54,0x54,0xff,0x5d,0x5d,0x5d,0xff,
-    0x64,0x62,0x64,0xff,0x68,0x66,0x68,0xff,0x6b,0x68,0x6b,0xff,0x6b,0x69,0x6b,0xff,0x6a,0x69,0x6a,0xff,
-    0x6a,0x6a,0x6a,0xff,0x6f,0x6f,0x6f,0xff,0x77,0x77,0x77,0xff,0x82,0x82,0x82,0xff,0x8a,0x8a,0x8a,0xff,
-    0x8e,0x8e,0x8e,0xff,0x8f,0x8f,0x8f,0xff,0x8d,0x8d,0x8d,0xff,0x87,0x87,0x87,0xff,0x7f,0x7f,0x7f,0xff,
-    0x78,0x78,0x78,0xff,0x75,0x75,0x75,0xff,0x7a,0x7a,0x7a,0xff,0x83,0x83,0x83,0xff,0x8c,0x8c,0x8c,0xff,
-    0x92,0x92,0x92,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x90,0x90,0x90,0xff,0x86,0x86,0x86,0xff,0x76,0x76,0x76,0xff,0x6a,0x64,0x6a,0xff,0x5e,0x54,0x5e,0xff,
-    0x51,0x46,0x51,0xff,0x48,0x3b,0x48,0xff,0x42,0x33,0x43,0xff,0x3e,0x2e,0x3e,0xff,0x3d,0x2c,0x3d,0xff,
-    0x3c,0x2d,0x3c,0xff,0x3d,0x2e,0x3c,0xff,0x3e,0x2f,0x3e,0xff,0x42,0x36,0x42,0xff,0x4d,0x47,0x4d,0xff,
-    0x52,0x51,0x52,0xff,0x44,0x44,0x44,0xff,0x33,0x33,0x33,0xff,0x25,0x25,0x25,0xff,0x18,0x18,0x18,0xff,
-    0x0e,0x0e,0x0e,0xff,0x08,0x08,0x08,0xff,0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xf9,0x00,0x00,0x00,0xb8,
-    0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0xe5,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x07,0x07,0x07,0xff,
-    0x0d,0x0d,0x0d,0xff,0x17,0x17,0x17,0xff,0x23,0x23,0x23,0xff,0x31,0x31,0x31,0xff,0x42,0x42,0x42,0xff,
-    0x53,0x53,0x53,0xff,0x64,0x64,0x64,0xff,0x71,0x71,0x71,0xff,0x7c,0x7c,0x7c,0xff,0x80,0x80,0x80,0xff,
-    0x7c,0x7c,0x7c,0xff,0x74,0x74,0x74,0xff,0x71,0x71,0x71,0xff,0x78,0x78,0x78,0xff,0x87,0x87,0x87,0xff,
-    0x96,0x96,0x96,0xff,0xa1,0xa1,0xa1,0xff,0xa8,0xa8,0xa8,0xff,0xac,0xac,0xac,0xff,0xad,0xad,0xad,0xff,
-    0xab,0xab,0xab,0xff,0xa5,0xa5,0xa5,0xff,0x9c,0x9c,0x9c,0xff,0x90,0x90,0x90,0xff,0x80,0x80,0x80,0xff,
-    0x74,0x74,0x74,0xff,0x72,0x72,0x72,0xff,0x7c,0x7c,0x7c,0xff,0x88,0x88,0x88,0xff,0x90,0x90,0x90,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,0x8e,0x8e,0x8e,0xff,
-    0x86,0x86,0x86,0xff,0x7a,0x7a,0x7a,0xff,0x6f,0x6e,0x6f,0xff,0x67,0x61,0x67,0xff,0x60,0x57,0x60,0xff,
-    0x59,0x4f,0x59,0xff,0x54,0x49,0x54,0xff,0x51,0x45,0x51,0xff,0x50,0x44,0x50,0xff,0x50,0x45,0x50,0xff,
-    0x53,0x49,0x53,0xff,0x56,0x50,0x56,0xff,0x5b,0x5a,0x5b,0xff,0x5c,0x5c,0x5c,0xff,0x4d,0x4d,0x4d,0xff,
-    0x3c,0x3c,0x3c,0xff,0x2c,0x2c,0x2c,0xff,0x1e,0x1e,0x1e,0xff,0x13,0x13,0x13,0xff,0x0a,0x0a,0x0a,0xff,
-    0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xfb,
-    0x00,0x00,0x00,0xca,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0xae,0x00,0x00,0x00,0xf9,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x04,0x04,0x04,0xff,0x09,0x09,0x09,0xff,0x10,0x10,0x10,0xff,0x1b,0x1b,0x1b,0xff,
-    0x29,0x29,0x29,0xff,0x39,0x39,0x39,0xff,0x4a,0x4a,0x4a,0xff,0x5b,0x5b,0x5b,0xff,0x6b,0x6b,0x6b,0xff,
-    0x78,0x78,0x78,0xff,0x7e,0x7e,0x7e,0xff,0x78,0x78,0x78,0xff,0x70,0x70,0x70,0xff,0x6f,0x6f,0x6f,0xff,
-    0x7c,0x7c,0x7c,0xff,0x8f,0x8f,0x8f,0xff,0x9e,0x9e,0x9e,0xff,0xa6,0xa6,0xa6,0xff,0xa8,0xa8,0xa8,0xff,
-    0xa5,0xa5,0xa5,0xff,0xa2,0xa2,0xa2,0xff,0xa1,0xa1,0xa1,0xff,0xa3,0xa3,0xa3,0xff,0xa6,0xa6,0xa6,0xff,
-    0xa8,0xa8,0xa8,0xff,0xa3,0xa3,0xa3,0xff,0x98,0x98,0x98,0xff,0x86,0x86,0x86,0xff,0x75,0x75,0x75,0xff,
-    0x6d,0x6d,0x6d,0xff,0x77,0x77,0x77,0xff,0x85,0x85,0x85,0xff,0x90,0x90,0x90,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,0x8e,0x8e,0x8e,0xff,0x88,0x88,0x88,0xff,
-    0x81,0x81,0x81,0xff,0x78,0x78,0x78,0xff,0x71,0x70,0x71,0xff,0x6c,0x69,0x6d,0xff,0x69,0x64,0x69,0xff,
-    0x66,0x61,0x66,0xff,0x65,0x60,0x65,0xff,0x66,0x61,0x66,0xff,0x65,0x64,0x66,0xff,0x67,0x67,0x67,0xff,
-    0x6a,0x6a,0x6a,0xff,0x65,0x65,0x65,0xff,0x55,0x55,0x55,0xff,0x44,0x44,0x44,0xff,0x33,0x33,0x33,0xff,
-    0x23,0x23,0x23,0xff,0x17,0x17,0x17,0xff,0x0d,0x0d,0x0d,0xff,0x07,0x07,0x07,0xff,0x03,0x03,0x03,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0xc4,0x00,0x00,0x00,0x59,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0xc8,0x00,0x00,0x00,0xfa,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,
-    0x0b,0x0b,0x0b,0xff,0x14,0x14,0x14,0xff,0x20,0x20,0x20,0xff,0x2f,0x2f,0x2f,0xff,0x3f,0x3f,0x3f,0xff,
-    0x51,0x51,0x51,0xff,0x63,0x63,0x63,0xff,0x71,0x71,0x71,0xff,0x79,0x79,0x79,0xff,0x74,0x74,0x74,0xff,
-    0x6b,0x6b,0x6b,0xff,0x6a,0x6a,0x6a,0xff,0x7a,0x7a,0x7a,0xff,0x8e,0x8e,0x8e,0xff,0x98,0x98,0x98,0xff,
-    0x92,0x92,0x92,0xff,0x7f,0x7f,0x7f,0xff,0x6a,0x6a,0x6a,0xff,0x63,0x63,0x63,0xff,0x68,0x68,0x68,0xff,
-    0x6a,0x6a,0x6a,0xff,0x67,0x67,0x67,0xff,0x66,0x66,0x66,0xff,0x75,0x75,0x75,0xff,0x8a,0x8a,0x8a,0xff,
-    0x97,0x97,0x97,0xff,0x94,0x94,0x94,0xff,0x85,0x85,0x85,0xff,0x71,0x71,0x71,0xff,0x69,0x69,0x69,0xff,
-    0x74,0x74,0x74,0xff,0x85,0x85,0x85,0xff,0x90,0x90,0x90,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,
-    0x92,0x92,0x92,0xff,0x90,0x90,0x90,0xff,0x8f,0x8f,0x8f,0xff,0x8d,0x8d,0x8d,0xff,0x8b,0x8b,0x8b,0xff,
-    0x8a,0x8a,0x8a,0xff,0x8a,0x8a,0x8a,0xff,0x89,0x89,0x89,0xff,0x86,0x86,0x86,0xff,0x84,0x84,0x84,0xff,
-    0x81,0x81,0x81,0xff,0x7d,0x7d,0x7d,0xff,0x7a,0x7a,0x7a,0xff,0x78,0x78,0x78,0xff,0x77,0x77,0x77,0xff,
-    0x78,0x78,0x78,0xff,0x79,0x79,0x79,0xff,0x79,0x79,0x79,0xff,0x76,0x76,0x76,0xff,0x6c,0x6c,0x6c,0xff,
-    0x5c,0x5c,0x5c,0xff,0x4a,0x4a,0x4a,0xff,0x39,0x39,0x39,0xff,0x29,0x29,0x29,0xff,0x1a,0x1a,0x1a,0xff,
-    0x10,0x10,0x10,0xff,0x08,0x08,0x08,0xff,0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xee,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,0x45,0x00,0x00,0x00,0x08,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0xbd,0x00,0x00,0x00,0xf6,
-    0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x07,0x07,0x07,0xff,0x0d,0x0d,0x0d,0xff,0x17,0x17,0x17,0xff,
-    0x24,0x24,0x24,0xff,0x34,0x34,0x34,0xff,0x45,0x45,0x45,0xff,0x57,0x57,0x57,0xff,0x68,0x68,0x68,0xff,
-    0x74,0x74,0x74,0xff,0x71,0x71,0x71,0xff,0x67,0x67,0x67,0xff,0x64,0x64,0x64,0xff,0x73,0x73,0x73,0xff,
-    0x85,0x85,0x85,0xff,0x86,0x86,0x86,0xff,0x6d,0x6d,0x6d,0xff,0x59,0x59,0x59,0xff,0x75,0x75,0x75,0xff,
-    0x9e,0x9e,0x9e,0xff,0xc1,0xc1,0xc1,0xff,0xd0,0xd0,0xd0,0xff,0xd5,0xd5,0xd5,0xff,0xcf,0xcf,0xcf,0xff,
-    0xbc,0xbc,0xbc,0xff,0x94,0x94,0x94,0xff,0x6a,0x6a,0x6a,0xff,0x61,0x61,0x61,0xff,0x7d,0x7d,0x7d,0xff,
-    0x88,0x88,0x88,0xff,0x7d,0x7d,0x7d,0xff,0x6b,0x6b,0x6b,0xff,0x65,0x65,0x65,0xff,0x74,0x74,0x74,0xff,
-    0x88,0x88,0x88,0xff,0x92,0x92,0x92,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,
-    0x92,0x92,0x92,0xff,0x90,0x90,0x90,0xff,0x8c,0x8c,0x8c,0xff,0x87,0x87,0x87,0xff,0x83,0x83,0x83,0xff,
-    0x7f,0x7f,0x7f,0xff,0x7d,0x7d,0x7d,0xff,0x7c,0x7c,0x7c,0xff,0x7b,0x7b,0x7b,0xff,0x7c,0x7c,0x7c,0xff,
-    0x7c,0x7c,0x7c,0xff,0x7c,0x7c,0x7c,0xff,0x7d,0x7d,0x7d,0xff,0x7e,0x7e,0x7e,0xff,0x80,0x80,0x80,0xff,
-    0x83,0x83,0x83,0xff,0x85,0x85,0x85,0xff,0x86,0x86,0x86,0xff,0x86,0x86,0x86,0xff,0x86,0x86,0x86,0xff,
-    0x83,0x83,0x83,0xff,0x7d,0x7d,0x7d,0xff,0x71,0x71,0x71,0xff,0x62,0x62,0x62,0xff,0x50,0x50,0x50,0xff,
-    0x3e,0x3e,0x3e,0xff,0x2d,0x2d,0x2d,0xff,0x1f,0x1f,0x1f,0xff,0x12,0x12,0x12,0xff,0x0a,0x0a,0x0a,0xff,
-    0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xf7,0x02,0x02,0x02,0xc1,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,
-    0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x8e,0x00,0x00,0x00,0xdd,
-    0x00,0x00,0x00,0xfa,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,
-    0x08,0x08,0x08,0xff,0x0f,0x0f,0x0f,0xff,0x1a,0x1a,0x1a,0xff,0x27,0x27,0x27,0xff,0x38,0x38,0x38,0xff,
-    0x4a,0x4a,0x4a,0xff,0x5c,0x5c,0x5c,0xff,0x6b,0x6b,0x6b,0xff,0x6f,0x6f,0x6f,0xff,0x65,0x65,0x65,0xff,
-    0x5d,0x5d,0x5d,0xff,0x68,0x68,0x68,0xff,0x78,0x78,0x78,0xff,0x71,0x71,0x71,0xff,0x50,0x50,0x50,0xff,
-    0x6e,0x6e,0x6e,0xff,0xa5,0xa5,0xa5,0xff,0xd7,0xd7,0xd7,0xff,0xef,0xef,0xef,0xff,0xf4,0xf4,0xf4,0xff,
-    0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf5,0xf5,0xf5,0xff,0xf3,0xf3,0xf3,0xff,0xed,0xed,0xed,0xff,
-    0xd2,0xd2,0xd2,0xff,0x98,0x98,0x98,0xff,0x5c,0x5c,0x5c,0xff,0x63,0x63,0x63,0xff,0x79,0x79,0x79,0xff,
-    0x71,0x71,0x71,0xff,0x61,0x61,0x61,0xff,0x62,0x62,0x62,0xff,0x77,0x77,0x77,0xff,0x8c,0x8c,0x8c,0xff,
-    0x92,0x92,0x92,0xff,0x92,0x92,0x92,0xff,0x8f,0x8f,0x8f,0xff,0x8a,0x8a,0x8a,0xff,0x83,0x83,0x83,0xff,
-    0x7c,0x7c,0x7c,0xff,0x77,0x77,0x77,0xff,0x76,0x76,0x76,0xff,0x77,0x77,0x77,0xff,0x78,0x78,0x78,0xff,
-    0x7a,0x7a,0x7a,0xff,0x7c,0x7c,0x7c,0xff,0x7c,0x7c,0x7c,0xff,0x7a,0x7a,0x7a,0xff,0x78,0x78,0x78,0xff,
-    0x76,0x76,0x76,0xff,0x75,0x75,0x75,0xff,0x77,0x77,0x77,0xff,0x7b,0x7b,0x7b,0xff,0x81,0x81,0x81,0xff,
-    0x87,0x87,0x87,0xff,0x8c,0x8c,0x8c,0xff,0x8c,0x8c,0x8c,0xff,0x88,0x88,0x88,0xff,0x81,0x81,0x81,0xff,
-    0x75,0x75,0x75,0xff,0x66,0x66,0x66,0xff,0x56,0x56,0x56,0xff,0x43,0x43,0x43,0xff,0x31,0x31,0x31,0xff,
-    0x22,0x22,0x22,0xff,0x15,0x15,0x15,0xff,0x0c,0x0c,0x0c,0xff,0x06,0x06,0x06,0xfe,0x11,0x11,0x11,0x7c,
-    0x63,0x63,0x63,0x08,0x46,0x46,0x46,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x93,
-    0x01,0x01,0x01,0xd8,0x02,0x02,0x02,0xfa,0x04,0x04,0x04,0xff,0x09,0x09,0x09,0xff,0x11,0x11,0x11,0xff,
-    0x1c,0x1c,0x1c,0xff,0x2a,0x2a,0x2a,0xff,0x3b,0x3b,0x3b,0xff,0x4e,0x4e,0x4e,0xff,0x5f,0x5f,0x5f,0xff,
-    0x6a,0x6a,0x6a,0xff,0x64,0x64,0x64,0xff,0x59,0x59,0x59,0xff,0x5b,0x5b,0x5b,0xff,0x6a,0x6a,0x6a,0xff,
-    0x61,0x61,0x61,0xff,0x47,0x47,0x47,0xff,0x82,0x82,0x82,0xff,0xbe,0xbe,0xbe,0xff,0xec,0xec,0xec,0xff,
-    0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xe9,0xe9,0xe9,0xff,
-    0xb5,0xb5,0xb5,0xff,0x67,0x67,0x67,0xff,0x53,0x53,0x53,0xff,0x6a,0x6a,0x6a,0xff,0x62,0x62,0x62,0xff,
-    0x58,0x58,0x58,0xff,0x65,0x65,0x65,0xff,0x7e,0x7e,0x7e,0xff,0x8e,0x8e,0x8e,0xff,0x8c,0x8c,0x8c,0xff,
-    0x83,0x83,0x83,0xff,0x7a,0x7a,0x7a,0xff,0x73,0x73,0x73,0xff,0x73,0x73,0x73,0xff,0x77,0x77,0x77,0xff,
-    0x7e,0x7e,0x7e,0xff,0x84,0x84,0x84,0xff,0x87,0x87,0x87,0xff,0x89,0x89,0x89,0xff,0x89,0x89,0x89,0xff,
-    0x88,0x88,0x88,0xff,0x87,0x87,0x87,0xff,0x84,0x84,0x84,0xff,0x81,0x81,0x81,0xff,0x7b,0x7b,0x7b,0xff,
-    0x76,0x76,0x76,0xff,0x72,0x72,0x72,0xff,0x74,0x74,0x74,0xff,0x7b,0x7b,0x7b,0xff,0x84,0x84,0x84,0xff,
-    0x8a,0x8a,0x8a,0xff,0x89,0x89,0x89,0xff,0x83,0x83,0x83,0xff,0x78,0x78,0x78,0xff,0x6a,0x6a,0x6a,0xff,
-    0x59,0x59,0x59,0xff,0x47,0x47,0x47,0xff,0x35,0x35,0x35,0xff,0x24,0x24,0x24,0xff,0x17,0x17,0x17,0xff,
-    0x0d,0x0d,0x0d,0xff,0x07,0x07,0x07,0xf9,0x2a,0x2a,0x2a,0x43,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x38,0x38,0x38,0x0b,0x0e,0x0e,0x0e,0x7f,
-    0x04,0x04,0x04,0xfd,0x09,0x09,0x09,0xff,0x12,0x12,0x12,0xff,0x1e,0x1e,0x1e,0xff,0x2d,0x2d,0x2d,0xff,
-    0x3e,0x3e,0x3e,0xff,0x50,0x50,0x50,0xff,0x60,0x60,0x60,0xff,0x63,0x63,0x63,0xff,0x58,0x58,0x58,0xff,
-    0x51,0x51,0x51,0xff,0x5a,0x5a,0x5a,0xff,0x57,0x57,0x57,0xff,0x40,0x40,0x40,0xff,0x86,0x86,0x86,0xff,
-    0xc6,0xc6,0xc6,0xff,0xf1,0xf1,0xf1,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf0,0xf0,0xf0,0xff,0xbd,0xbd,0xbd,0xff,
-    0x66,0x66,0x66,0xff,0x4a,0x4a,0x4a,0xff,0x5c,0x5c,0x5c,0xff,0x53,0x53,0x53,0xff,0x55,0x55,0x55,0xff,
-    0x6b,0x6b,0x6b,0xff,0x7f,0x7f,0x7f,0xff,0x7c,0x7c,0x7c,0xff,0x72,0x72,0x72,0xff,0x6d,0x6d,0x6d,0xff,
-    0x73,0x73,0x73,0xff,0x7c,0x7c,0x7c,0xff,0x82,0x82,0x82,0xff,0x80,0x80,0x80,0xff,0x77,0x77,0x77,0xff,
-    0x6b,0x6b,0x6b,0xff,0x61,0x61,0x61,0xff,0x5b,0x5b,0x5b,0xff,0x58,0x58,0x58,0xff,0x5b,0x5b,0x5b,0xff,
-    0x61,0x61,0x61,0xff,0x6a,0x6a,0x6a,0xff,0x73,0x73,0x73,0xff,0x78,0x78,0x78,0xff,0x76,0x76,0x76,0xff,
-    0x71,0x71,0x71,0xff,0x6e,0x6e,0x6e,0xff,0x73,0x73,0x73,0xff,0x7d,0x7d,0x7d,0xff,0x84,0x84,0x84,0xff,
-    0x83,0x83,0x83,0xff,0x7a,0x7a,0x7a,0xff,0x6d,0x6d,0x6d,0xff,0x5b,0x5b,0x5b,0xff,0x49,0x49,0x49,0xff,
-    0x37,0x37,0x37,0xff,0x27,0x27,0x27,0xff,0x18,0x18,0x18,0xff,0x0e,0x0e,0x0e,0xff,0x09,0x09,0x09,0xf2,
-    0x55,0x55,0x55,0x1a,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x2c,0x2c,0x2b,0x05,0x05,0x05,0xf5,0x0a,0x0a,0x0a,0xff,
-    0x12,0x12,0x12,0xff,0x1e,0x1e,0x1e,0xff,0x2e,0x2e,0x2e,0xff,0x3f,0x3f,0x3f,0xff,0x52,0x52,0x52,0xff,
-    0x5e,0x5e,0x5e,0xff,0x58,0x58,0x58,0xff,0x4c,0x4c,0x4c,0xff,0x4b,0x4b,0x4b,0xff,0x4e,0x4e,0x4e,0xff,
-    0x36,0x36,0x36,0xff,0x7b,0x7b,0x7b,0xff,0xc0,0xc0,0xc0,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf5,0xf5,0xf5,0xff,0xec,0xec,0xec,0xff,0xb2,0xb2,0xb2,0xff,0x55,0x55,0x55,0xff,
-    0x45,0x45,0x45,0xff,0x4d,0x4d,0x4d,0xff,0x48,0x48,0x48,0xff,0x55,0x55,0x55,0xff,0x66,0x66,0x66,0xff,
-    0x69,0x69,0x69,0xff,0x6a,0x6a,0x6a,0xff,0x72,0x72,0x72,0xff,0x78,0x78,0x78,0xff,0x72,0x72,0x72,0xff,
-    0x60,0x60,0x60,0xff,0x53,0x53,0x53,0xff,0x62,0x62,0x62,0xff,0x75,0x75,0x75,0xff,0x84,0x84,0x84,0xff,
-    0x8f,0x8f,0x8f,0xff,0x92,0x92,0x92,0xff,0x8f,0x8f,0x8f,0xff,0x84,0x84,0x84,0xff,0x73,0x73,0x73,0xff,
-    0x60,0x60,0x60,0xff,0x53,0x53,0x53,0xff,0x5e,0x5e,0x5e,0xff,0x6a,0x6a,0x6a,0xff,0x6b,0x6b,0x6b,0xff,
-    0x68,0x68,0x68,0xff,0x6c,0x6c,0x6c,0xff,0x76,0x76,0x76,0xff,0x7c,0x7c,0x7c,0xff,0x7a,0x7a,0x7a,0xff,
-    0x6e,0x6e,0x6e,0xff,0x5d,0x5d,0x5d,0xff,0x4b,0x4b,0x4b,0xff,0x38,0x38,0x38,0xff,0x28,0x28,0x28,0xff,
-    0x19,0x19,0x19,0xff,0x0f,0x0f,0x0f,0xff,0x10,0x10,0x10,0xd3,0x8b,0x8b,0x8b,0x0b,0xff,0xff,0xff,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x6e,0x6e,0x6e,0x09,0x0c,0x0c,0x0c,0xce,0x0a,0x0a,0x0a,0xff,0x13,0x13,0x13,0xff,0x1f,0x1f,0x1f,0xff,
-    0x2e,0x2e,0x2e,0xff,0x40,0x40,0x40,0xff,0x51,0x51,0x51,0xff,0x58,0x58,0x58,0xff,0x4d,0x4d,0x4d,0xff,
-    0x42,0x42,0x42,0xff,0x43,0x43,0x43,0xff,0x35,0x35,0x35,0xff,0x5e,0x5e,0x5e,0xff,0xa8,0xa8,0xa8,0xff,
-    0xd8,0xd8,0xd8,0xff,0xe6,0xe6,0xe6,0xff,0xee,0xee,0xee,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,0xf2,0xf2,0xf2,0xff,
-    0xef,0xef,0xef,0xff,0xe0,0xe0,0xe0,0xff,0x98,0x98,0x98,0xff,0x39,0x39,0x39,0xff,0x3f,0x3f,0x3f,0xff,
-    0x3f,0x3f,0x3f,0xff,0x41,0x41,0x41,0xff,0x4d,0x4d,0x4d,0xff,0x5f,0x5f,0x5f,0xff,0x6c,0x6c,0x6c,0xff,
-    0x6c,0x6c,0x6c,0xff,0x5a,0x5a,0x5a,0xff,0x5b,0x5b,0x5b,0xff,0x7f,0x7f,0x7f,0xff,0xa0,0xa0,0xa0,0xff,
-    0xb4,0xb4,0xb4,0xff,0xc0,0xc0,0xc0,0xff,0xca,0xca,0xca,0xff,0xe4,0xe4,0xe4,0xff,0xed,0xed,0xed,0xff,
-    0xeb,0xeb,0xeb,0xff,0xe2,0xe2,0xe2,0xff,0xd4,0xd4,0xd4,0xff,0xbb,0xbb,0xbb,0xff,0x9e,0x9e,0x9e,0xff,
-    0x7b,0x7b,0x7b,0xff,0x57,0x57,0x57,0xff,0x58,0x58,0x58,0xff,0x61,0x61,0x61,0xff,0x61,0x61,0x61,0xff,
-    0x66,0x66,0x66,0xff,0x70,0x70,0x70,0xff,0x74,0x74,0x74,0xff,0x6d,0x6d,0x6d,0xff,0x5e,0x5e,0x5e,0xff,
-    0x4b,0x4b,0x4b,0xff,0x39,0x39,0x39,0xff,0x28,0x28,0x28,0xff,0x19,0x19,0x19,0xff,0x0f,0x0f,0x0f,0xff,
-    0x1b,0x1b,0x1b,0xae,0xad,0xad,0xad,0x07,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb7,0xb7,0xb7,0x03,0x19,0x19,0x19,0x8f,
-    0x0a,0x0a,0x0a,0xff,0x12,0x12,0x12,0xff,0x1e,0x1e,0x1e,0xff,0x2e,0x2e,0x2e,0xff,0x3f,0x3f,0x3f,0xff,
-    0x4f,0x4f,0x4f,0xff,0x4f,0x4f,0x4f,0xff,0x42,0x42,0x42,0xff,0x39,0x39,0x39,0xff,0x34,0x34,0x34,0xff,
-    0x32,0x32,0x32,0xff,0x93,0x93,0x93,0xff,0xc3,0xc3,0xc3,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd3,0xd3,0xd3,0xff,0xd7,0xd7,0xd7,0xff,0xe4,0xe4,0xe4,0xff,0xf2,0xf2,0xf2,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf6,0xf6,0xf6,0xff,0xf4,0xf4,0xf4,0xff,
-    0xf3,0xf3,0xf3,0xff,0xf0,0xf0,0xf0,0xff,0xee,0xee,0xee,0xff,0xec,0xec,0xec,0xff,0xe9,0xe9,0xe9,0xff,
-    0xc8,0xc8,0xc8,0xff,0x6e,0x6e,0x6e,0xff,0x2b,0x2b,0x2b,0xff,0x34,0x34,0x34,0xff,0x33,0x33,0x33,0xff,
-    0x3e,0x3e,0x3e,0xff,0x58,0x58,0x58,0xff,0x5c,0x5c,0x5c,0xff,0x52,0x52,0x52,0xff,0x7c,0x7c,0x7c,0xff,
-    0xa7,0xa7,0xa7,0xff,0xc0,0xc0,0xc0,0xff,0xcd,0xcd,0xcd,0xff,0xd1,0xd1,0xd1,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd5,0xd5,0xd5,0xff,0xe8,0xe8,0xe8,0xff,0xf5,0xf5,0xf5,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf5,0xf5,0xf5,0xff,0xf2,0xf2,0xf2,0xff,0xe6,0xe6,0xe6,0xff,0xcb,0xcb,0xcb,0xff,0xa5,0xa5,0xa5,0xff,
-    0x76,0x76,0x76,0xff,0x4e,0x4e,0x4e,0xff,0x55,0x55,0x55,0xff,0x59,0x59,0x59,0xff,0x60,0x60,0x60,0xff,
-    0x68,0x68,0x68,0xff,0x68,0x68,0x68,0xff,0x5c,0x5c,0x5c,0xff,0x4a,0x4a,0x4a,0xff,0x38,0x38,0x38,0xff,
-    0x27,0x27,0x27,0xff,0x19,0x19,0x19,0xff,0x0f,0x0f,0x0f,0xff,0x25,0x25,0x25,0x8d,0xdb,0xdb,0xdb,0x04,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xfd,0xfd,0xfd,0x02,0x2e,0x2e,0x2e,0x54,0x0a,0x0a,0x0a,0xfb,0x11,0x11,0x11,0xff,
-    0x1d,0x1d,0x1d,0xff,0x2c,0x2c,0x2c,0xff,0x3d,0x3d,0x3d,0xff,0x4b,0x4b,0x4b,0xff,0x46,0x46,0x46,0xff,
-    0x38,0x38,0x38,0xff,0x2d,0x2d,0x2d,0xff,0x22,0x22,0x22,0xff,0x64,0x64,0x64,0xff,0xb0,0xb0,0xb0,0xff,
-    0xcf,0xcf,0xcf,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd6,0xd6,0xd6,0xff,0xe6,0xe6,0xe6,0xff,0xf4,0xf4,0xf4,0xff,0xf6,0xf6,0xf6,0xff,
-    0xf5,0xf5,0xf5,0xff,0xf3,0xf3,0xf3,0xff,0xf1,0xf1,0xf1,0xff,0xef,0xef,0xef,0xff,0xed,0xed,0xed,0xff,
-    0xeb,0xeb,0xeb,0xff,0xe9,0xe9,0xe9,0xff,0xe6,0xe6,0xe6,0xff,0xdd,0xdd,0xdd,0xff,0xa0,0xa0,0xa0,0xff,
-    0x33,0x33,0x33,0xff,0x27,0x27,0x27,0xff,0x27,0x27,0x27,0xff,0x32,0x32,0x32,0xff,0x43,0x43,0x43,0xff,
-    0x55,0x55,0x55,0xff,0x92,0x92,0x92,0xff,0xb9,0xb9,0xb9,0xff,0xcd,0xcd,0xcd,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd3,0xd3,0xd3,0xff,0xe5,0xe5,0xe5,0xff,0xf4,0xf4,0xf4,0xff,0xf3,0xf3,0xf3,0xff,0xf0,0xf0,0xf0,0xff,
-    0xed,0xed,0xed,0xff,0xeb,0xeb,0xeb,0xff,0xe0,0xe0,0xe0,0xff,0xbf,0xbf,0xbf,0xff,0x8c,0x8c,0x8c,0xff,
-    0x4f,0x4f,0x4f,0xff,0x4b,0x4b,0x4b,0xff,0x52,0x52,0x52,0xff,0x5a,0x5a,0x5a,0xff,0x5e,0x5e,0x5e,0xff,
-    0x59,0x59,0x59,0xff,0x49,0x49,0x49,0xff,0x36,0x36,0x36,0xff,0x26,0x26,0x26,0xff,0x18,0x18,0x18,0xff,
-    0x0e,0x0e,0x0e,0xfd,0x2d,0x2d,0x2d,0x70,0xfb,0xfb,0xfb,0x03,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x02,
-    0x54,0x54,0x54,0x21,0x0a,0x0a,0x0a,0xf4,0x10,0x10,0x10,0xff,0x1b,0x1b,0x1b,0xff,0x2a,0x2a,0x2a,0xff,
-    0x3a,0x3a,0x3a,0xff,0x45,0x45,0x45,0xff,0x3b,0x3b,0x3b,0xff,0x2a,0x2a,0x2a,0xff,0x1f,0x1f,0x1f,0xff,
-    0x20,0x20,0x20,0xff,0x8c,0x8c,0x8c,0xff,0xc3,0xc3,0xc3,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xda,0xda,0xda,0xff,0xee,0xee,0xee,0xff,0xf1,0xf1,0xf1,0xff,0xf0,0xf0,0xf0,0xff,
-    0xee,0xee,0xee,0xff,0xec,0xec,0xec,0xff,0xea,0xea,0xea,0xff,0xe7,0xe7,0xe7,0xff,0xe5,0xe5,0xe5,0xff,
-    0xe3,0xe3,0xe3,0xff,0xe0,0xe0,0xe0,0xff,0xbe,0xbe,0xbe,0xff,0x61,0x61,0x61,0xff,0x19,0x19,0x19,0xff,
-    0x1c,0x1c,0x1c,0xff,0x21,0x21,0x21,0xff,0x4b,0x4b,0x4b,0xff,0x97,0x97,0x97,0xff,0xc0,0xc0,0xc0,0xff,
-    0xd0,0xd0,0xd0,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd3,0xd3,0xd3,0xff,
-    0xe3,0xe3,0xe3,0xff,0xee,0xee,0xee,0xff,0xec,0xec,0xec,0xff,0xea,0xea,0xea,0xff,0xe7,0xe7,0xe7,0xff,
-    0xe5,0xe5,0xe5,0xff,0xe0,0xe0,0xe0,0xff,0xc8,0xc8,0xc8,0xff,0x92,0x92,0x92,0xff,0x49,0x49,0x49,0xff,
-    0x43,0x43,0x43,0xff,0x4c,0x4c,0x4c,0xff,0x53,0x53,0x53,0xff,0x52,0x52,0x52,0xff,0x45,0x45,0x45,0xff,
-    0x34,0x34,0x34,0xff,0x24,0x24,0x24,0xff,0x17,0x17,0x17,0xff,0x0e,0x0e,0x0e,0xfb,0x37,0x37,0x37,0x58,
-    0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0x8a,0x8a,0x8a,0x0b,0x10,0x10,0x10,0xd4,
-    0x0f,0x0f,0x0f,0xff,0x19,0x19,0x19,0xff,0x27,0x27,0x27,0xff,0x36,0x36,0x36,0xff,0x3f,0x3f,0x3f,0xff,
-    0x31,0x31,0x31,0xff,0x1d,0x1d,0x1d,0xff,0x13,0x13,0x13,0xff,0x43,0x43,0x43,0xff,0xa5,0xa5,0xa5,0xff,
-    0xcd,0xcd,0xcd,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd5,0xd5,0xd5,0xff,0xe5,0xe5,0xe5,0xff,0xec,0xec,0xec,0xff,0xea,0xea,0xea,0xff,0xe8,0xe8,0xe8,0xff,
-    0xe1,0xe1,0xe1,0xff,0xc9,0xc9,0xc9,0xff,0xd4,0xd4,0xd4,0xff,0xd8,0xd8,0xd8,0xff,0xdd,0xdd,0xdd,0xff,
-    0xcd,0xcd,0xcd,0xff,0x86,0x86,0x86,0xff,0x17,0x17,0x17,0xff,0x11,0x11,0x11,0xff,0x2e,0x2e,0x2e,0xff,
-    0x8d,0x8d,0x8d,0xff,0xbe,0xbe,0xbe,0xff,0xd1,0xd1,0xd1,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd3,0xd3,0xd3,0xff,0xe3,0xe3,0xe3,0xff,
-    0xe7,0xe7,0xe7,0xff,0xe6,0xe6,0xe6,0xff,0xe3,0xe3,0xe3,0xff,0xe0,0xe0,0xe0,0xff,0xde,0xde,0xde,0xff,
-    0xdb,0xdb,0xdb,0xff,0xc2,0xc2,0xc2,0xff,0x86,0x86,0x86,0xff,0x38,0x38,0x38,0xff,0x3e,0x3e,0x3e,0xff,
-    0x48,0x48,0x48,0xff,0x49,0x49,0x49,0xff,0x41,0x41,0x41,0xff,0x30,0x30,0x30,0xff,0x21,0x21,0x21,0xff,
-    0x14,0x14,0x14,0xff,0x0d,0x0d,0x0d,0xf9,0x3f,0x3f,0x3f,0x44,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xff,0xff,0xff,0x01,0xaa,0xaa,0xaa,0x06,0x19,0x19,0x19,0xa9,0x0d,0x0d,0x0d,0xff,0x16,0x16,0x16,0xff,
-    0x23,0x23,0x23,0xff,0x31,0x31,0x31,0xff,0x38,0x38,0x38,0xff,0x29,0x29,0x29,0xff,0x13,0x13,0x13,0xff,
-    0x0a,0x0a,0x0a,0xff,0x64,0x64,0x64,0xff,0xb4,0xb4,0xb4,0xff,0xd1,0xd1,0xd1,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd3,0xd3,0xd3,0xff,
-    0xe0,0xe0,0xe0,0xff,0xe6,0xe6,0xe6,0xff,0xda,0xda,0xda,0xff,0x7a,0x7a,0x7a,0xff,0x4a,0x4a,0x4a,0xff,
-    0xee,0xee,0xee,0xff,0xe0,0xe0,0xe0,0xff,0xcb,0xcb,0xcb,0xff,0xd1,0xd1,0xd1,0xff,0x9f,0x9f,0x9f,0xff,
-    0x28,0x28,0x28,0xff,0x0d,0x0d,0x0d,0xff,0x6e,0x6e,0x6e,0xff,0xb3,0xb3,0xb3,0xff,0xd0,0xd0,0xd0,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd4,0xd4,0xd4,0xff,0xe1,0xe1,0xe1,0xff,0xdc,0xdc,0xdc,0xff,
-    0xbc,0xbc,0xbc,0xff,0xbd,0xbd,0xbd,0xff,0xc4,0xc4,0xc4,0xff,0xd7,0xd7,0xd7,0xff,0xd2,0xd2,0xd2,0xff,
-    0xae,0xae,0xae,0xff,0x64,0x64,0x64,0xff,0x2f,0x2f,0x2f,0xff,0x3b,0x3b,0x3b,0xff,0x40,0x40,0x40,0xff,
-    0x3a,0x3a,0x3a,0xff,0x2c,0x2c,0x2c,0xff,0x1d,0x1d,0x1d,0xff,0x12,0x12,0x12,0xff,0x0b,0x0b,0x0b,0xf8,
-    0x43,0x43,0x43,0x38,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xdd,0xdd,0xdd,0x03,
-    0x1f,0x1f,0x1f,0x85,0x0a,0x0a,0x0a,0xff,0x13,0x13,0x13,0xff,0x1e,0x1e,0x1e,0xff,0x2c,0x2c,0x2c,0xff,
-    0x31,0x31,0x31,0xff,0x23,0x23,0x23,0xff,0x0b,0x0b,0x0b,0xff,0x0a,0x0a,0x0a,0xff,0x7a,0x7a,0x7a,0xff,
-    0xbf,0xbf,0xbf,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd3,0xd3,0xd3,0xff,0xda,0xda,0xda,0xff,
-    0x8e,0x8e,0x8e,0xff,0x08,0x08,0x08,0xff,0x1b,0x1b,0x1b,0xff,0xb0,0xb0,0xb0,0xff,0xc2,0xc2,0xc2,0xff,
-    0xa5,0xa5,0xa5,0xff,0xc7,0xc7,0xc7,0xff,0xaa,0xaa,0xaa,0xff,0x46,0x46,0x46,0xff,0x2f,0x2f,0x2f,0xff,
-    0x99,0x99,0x99,0xff,0xc7,0xc7,0xc7,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xcf,0xcf,0xcf,0xff,0x7a,0x7a,0x7a,0xff,0x55,0x55,0x55,0xff,0xed,0xed,0xed,0xff,
-    0xcd,0xcd,0xcd,0xff,0xb2,0xb2,0xb2,0xff,0xd1,0xd1,0xd1,0xff,0xc3,0xc3,0xc3,0xff,0x90,0x90,0x90,0xff,
-    0x2d,0x2d,0x2d,0xff,0x2e,0x2e,0x2e,0xff,0x35,0x35,0x35,0xff,0x33,0x33,0x33,0xff,0x27,0x27,0x27,0xff,
-    0x19,0x19,0x19,0xff,0x0f,0x0f,0x0f,0xff,0x0a,0x0a,0x0a,0xf8,0x41,0x41,0x41,0x32,0xff,0xff,0xff,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xfe,0xfe,0x01,0x1e,0x1e,0x1e,0x68,0x08,0x08,0x08,0xfd,
-    0x0f,0x0f,0x0f,0xff,0x1a,0x1a,0x1a,0xff,0x26,0x26,0x26,0xff,0x2b,0x2b,0x2b,0xff,0x1e,0x1e,0x1e,0xff,
-    0x09,0x09,0x09,0xff,0x12,0x12,0x12,0xff,0x89,0x89,0x89,0xff,0xc7,0xc7,0xc7,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xc2,0xc2,0xc2,0xff,0x3a,0x3a,0x3a,0xff,0x00,0x00,0x00,0xff,
-    0x02,0x02,0x02,0xff,0x65,0x65,0x65,0xff,0x80,0x80,0x80,0xff,0x6e,0x6e,0x6e,0xff,0xa0,0xa0,0xa0,0xff,
-    0xb1,0xb1,0xb1,0xff,0x59,0x59,0x59,0xff,0x5d,0x5d,0x5d,0xff,0xae,0xae,0xae,0xff,0xd0,0xd0,0xd0,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd1,0xd1,0xd1,0xff,0x98,0x98,0x98,0xff,
-    0x10,0x10,0x10,0xff,0x20,0x20,0x20,0xff,0xb0,0xb0,0xb0,0xff,0xb8,0xb8,0xb8,0xff,0x96,0x96,0x96,0xff,
-    0xc0,0xc0,0xc0,0xff,0xce,0xce,0xce,0xff,0xa7,0xa7,0xa7,0xff,0x4e,0x4e,0x4e,0xff,0x22,0x22,0x22,0xff,
-    0x2b,0x2b,0x2b,0xff,0x2b,0x2b,0x2b,0xff,0x22,0x22,0x22,0xff,0x15,0x15,0x15,0xff,0x0c,0x0c,0x0c,0xff,
-    0x07,0x07,0x07,0xf8,0x33,0x33,0x33,0x36,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xff,0xff,0xff,0x01,0x23,0x23,0x23,0x55,0x07,0x07,0x07,0xfb,0x0c,0x0c,0x0c,0xff,0x15,0x15,0x15,0xff,
-    0x20,0x20,0x20,0xff,0x25,0x25,0x25,0xff,0x1a,0x1a,0x1a,0xff,0x07,0x07,0x07,0xff,0x17,0x17,0x17,0xff,
-    0x94,0x94,0x94,0xff,0xce,0xce,0xce,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xaa,0xaa,0xaa,0xff,0x2e,0x2e,0x2e,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x2b,0x2b,0x2b,0xff,
-    0x3d,0x3d,0x3d,0xff,0x2a,0x2a,0x2a,0xff,0x77,0x77,0x77,0xff,0xb4,0xb4,0xb4,0xff,0x64,0x64,0x64,0xff,
-    0x75,0x75,0x75,0xff,0xbb,0xbb,0xbb,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xcd,0xcd,0xcd,0xff,0x58,0x58,0x58,0xff,0x07,0x07,0x07,0xff,0x06,0x06,0x06,0xff,
-    0x69,0x69,0x69,0xff,0x7c,0x7c,0x7c,0xff,0x69,0x69,0x69,0xff,0x9a,0x9a,0x9a,0xff,0xd0,0xd0,0xd0,0xff,
-    0xb4,0xb4,0xb4,0xff,0x68,0x68,0x68,0xff,0x17,0x17,0x17,0xff,0x21,0x21,0x21,0xff,0x24,0x24,0x24,0xff,
-    0x1c,0x1c,0x1c,0xff,0x11,0x11,0x11,0xff,0x09,0x09,0x09,0xff,0x05,0x05,0x05,0xfa,0x22,0x22,0x22,0x46,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0x1f,0x1f,0x1f,0x4e,
-    0x05,0x05,0x05,0xfa,0x09,0x09,0x09,0xff,0x11,0x11,0x11,0xff,0x1a,0x1a,0x1a,0xff,0x1f,0x1f,0x1f,0xff,
-    0x17,0x17,0x17,0xff,0x07,0x07,0x07,0xff,0x18,0x18,0x18,0xff,0x97,0x97,0x97,0xff,0xd3,0xd3,0xd3,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0x9f,0x9f,0x9f,0xff,0x30,0x30,0x30,0xff,
-    0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,0x00,0x00,0x00,0xff,
-    0x66,0x66,0x66,0xff,0xb5,0xb5,0xb5,0xff,0x67,0x67,0x67,0xff,0x81,0x81,0x81,0xff,0xc0,0xc0,0xc0,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xc2,0xc2,0xc2,0xff,
-    0x3c,0x3c,0x3c,0xff,0x12,0x12,0x12,0xff,0x00,0x00,0x00,0xff,0x31,0x31,0x31,0xff,0x41,0x41,0x41,0xff,
-    0x2b,0x2b,0x2b,0xff,0x73,0x73,0x73,0xff,0xd0,0xd0,0xd0,0xff,0xba,0xba,0xba,0xff,0x73,0x73,0x73,0xff,
-    0x11,0x11,0x11,0xff,0x19,0x19,0x19,0xff,0x1d,0x1d,0x1d,0xff,0x16,0x16,0x16,0xff,0x0d,0x0d,0x0d,0xff,
-    0x07,0x07,0x07,0xff,0x03,0x03,0x03,0xfd,0x12,0x12,0x12,0x66,0xee,0xee,0xee,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x16,0x16,0x57,0x03,0x03,0x03,0xfb,0x07,0x07,0x07,0xff,
-    0x0c,0x0c,0x0c,0xff,0x15,0x15,0x15,0xff,0x1a,0x1a,0x1a,0xff,0x15,0x15,0x15,0xff,0x07,0x07,0x07,0xff,
-    0x17,0x17,0x17,0xff,0x95,0x95,0x95,0xff,0xd8,0xd8,0xd8,0xff,0xd3,0xd3,0xd3,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xa3,0xa3,0xa3,0xff,0x32,0x32,0x32,0xff,0x0c,0x0c,0x0c,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x6d,0x6d,0x6d,0xff,0xb4,0xb4,0xb4,0xff,
-    0x65,0x65,0x65,0xff,0x82,0x82,0x82,0xff,0xc0,0xc0,0xc0,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xbd,0xbd,0xbd,0xff,0x3a,0x3a,0x3a,0xff,0x20,0x20,0x20,0xff,
-    0x00,0x00,0x00,0xff,0x05,0x05,0x05,0xff,0x05,0x05,0x05,0xff,0x01,0x01,0x01,0xff,0x65,0x65,0x65,0xff,
-    0xcf,0xcf,0xcf,0xff,0xba,0xba,0xba,0xff,0x73,0x73,0x73,0xff,0x0d,0x0d,0x0d,0xff,0x14,0x14,0x14,0xff,
-    0x18,0x18,0x18,0xff,0x11,0x11,0x11,0xff,0x0a,0x0a,0x0a,0xff,0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,
-    0x07,0x07,0x07,0x9b,0x23,0x23,0x23,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x07,0x07,0x07,0x76,0x02,0x02,0x02,0xfe,0x05,0x05,0x05,0xff,0x09,0x09,0x09,0xff,0x0f,0x0f,0x0f,0xff,
-    0x15,0x15,0x15,0xff,0x13,0x13,0x13,0xff,0x08,0x08,0x08,0xff,0x13,0x13,0x13,0xff,0x8b,0x8b,0x8b,0xff,
-    0xd9,0xd9,0xd9,0xff,0xd8,0xd8,0xd8,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xb7,0xb7,0xb7,0xff,
-    0x31,0x31,0x31,0xff,0x19,0x19,0x19,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x03,0x03,0x03,0xff,0x8c,0x8c,0x8c,0xff,0xb0,0xb0,0xb0,0xff,0x5a,0x5a,0x5a,0xff,0x77,0x77,0x77,0xff,
-    0xbb,0xbb,0xbb,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xc4,0xc4,0xc4,0xff,0x37,0x37,0x37,0xff,0x25,0x25,0x25,0xff,0x03,0x03,0x03,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x78,0x78,0x78,0xff,0xcf,0xcf,0xcf,0xff,0xb5,0xb5,0xb5,0xff,
-    0x68,0x68,0x68,0xff,0x08,0x08,0x08,0xff,0x11,0x11,0x11,0xff,0x12,0x12,0x12,0xff,0x0d,0x0d,0x0d,0xff,
-    0x07,0x07,0x07,0xff,0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xe5,0x02,0x02,0x02,0x1a,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0x72,0x72,0x72,0x08,0x06,0x06,0x06,0xb9,0x02,0x02,0x02,0xff,
-    0x03,0x03,0x03,0xff,0x06,0x06,0x06,0xff,0x0b,0x0b,0x0b,0xff,0x10,0x10,0x10,0xff,0x10,0x10,0x10,0xff,
-    0x08,0x08,0x08,0xff,0x0b,0x0b,0x0b,0xff,0x7b,0x7b,0x7b,0xff,0xd3,0xd3,0xd3,0xff,0xe0,0xe0,0xe0,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xce,0xce,0xce,0xff,0x61,0x61,0x61,0xff,0x15,0x15,0x15,0xff,
-    0x09,0x09,0x09,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x28,0x28,0x28,0xff,0xb6,0xb6,0xb6,0xff,
-    0xa9,0xa9,0xa9,0xff,0x47,0x47,0x47,0xff,0x5e,0x5e,0x5e,0xff,0xaf,0xaf,0xaf,0xff,0xd0,0xd0,0xd0,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xcf,0xcf,0xcf,0xff,0x60,0x60,0x60,0xff,
-    0x20,0x20,0x20,0xff,0x10,0x10,0x10,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x0b,0x0b,0x0b,0xff,
-    0x9c,0x9c,0x9c,0xff,0xce,0xce,0xce,0xff,0xa8,0xa8,0xa8,0xff,0x4e,0x4e,0x4e,0xff,0x06,0x06,0x06,0xff,
-    0x0e,0x0e,0x0e,0xff,0x0e,0x0e,0x0e,0xff,0x09,0x09,0x09,0xff,0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,
-    0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xfe,0x05,0x05,0x05,0xa3,0x47,0x47,0x47,0x12,0xab,0xab,0xab,0x04,
-    0xfa,0xfa,0xfa,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x03,
-    0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x06,0xec,0xec,0xec,0x07,0xb1,0xb1,0xb1,0x0d,
-    0x2c,0x2c,0x2c,0x65,0x04,0x04,0x04,0xf9,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,0x04,0x04,0x04,0xff,
-    0x07,0x07,0x07,0xff,0x0c,0x0c,0x0c,0xff,0x0e,0x0e,0x0e,0xff,0x09,0x09,0x09,0xff,0x03,0x03,0x03,0xff,
-    0x65,0x65,0x65,0xff,0xc6,0xc6,0xc6,0xff,0xe6,0xe6,0xe6,0xff,0xd7,0xd7,0xd7,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xb5,0xb5,0xb5,0xff,0x3a,0x3a,0x3a,0xff,0x05,0x05,0x05,0xff,0x01,0x01,0x01,0xff,
-    0x1a,0x1a,0x1a,0xff,0x90,0x90,0x90,0xff,0xc9,0xc9,0xc9,0xff,0x9c,0x9c,0x9c,0xff,0x28,0x28,0x28,0xff,
-    0x33,0x33,0x33,0xff,0x9b,0x9b,0x9b,0xff,0xc8,0xc8,0xc8,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xa5,0xa5,0xa5,0xff,0x21,0x21,0x21,0xff,0x0f,0x0f,0x0f,0xff,
-    0x04,0x04,0x04,0xff,0x00,0x00,0x00,0xff,0x48,0x48,0x48,0xff,0xc5,0xc5,0xc5,0xff,0xc4,0xc4,0xc4,0xff,
-    0x92,0x92,0x92,0xff,0x21,0x21,0x21,0xff,0x06,0x06,0x06,0xff,0x0b,0x0b,0x0b,0xff,0x0a,0x0a,0x0a,0xff,
-    0x06,0x06,0x06,0xff,0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,
-    0x05,0x05,0x05,0xfd,0x0c,0x0c,0x0c,0xd7,0x1c,0x1c,0x1c,0x96,0x30,0x30,0x30,0x5d,0x60,0x60,0x60,0x22,
-    0xae,0xae,0xae,0x0a,0xef,0xef,0xef,0x04,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x04,
-    0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x08,0xfd,0xfd,0xfd,0x0b,0xdf,0xdf,0xdf,0x11,0xa4,0xa4,0xa4,0x22,
-    0x5f,0x5f,0x5f,0x55,0x3c,0x3c,0x3c,0x8b,0x23,0x23,0x23,0xc2,0x0e,0x0e,0x0e,0xf8,0x09,0x09,0x09,0xff,
-    0x06,0x06,0x06,0xff,0x04,0x04,0x04,0xff,0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x08,0x08,0x08,0xff,
-    0x0b,0x0b,0x0b,0xff,0x09,0x09,0x09,0xff,0x03,0x03,0x03,0xff,0x44,0x44,0x44,0xff,0xb1,0xb1,0xb1,0xff,
-    0xe4,0xe4,0xe4,0xff,0xe4,0xe4,0xe4,0xff,0xd3,0xd3,0xd3,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd1,0xd1,0xd1,0xff,
-    0xb9,0xb9,0xb9,0xff,0x83,0x83,0x83,0xff,0x79,0x79,0x79,0xff,0xa5,0xa5,0xa5,0xff,0xcf,0xcf,0xcf,0xff,
-    0xc2,0xc2,0xc2,0xff,0x84,0x84,0x84,0xff,0x11,0x11,0x11,0xff,0x09,0x09,0x09,0xff,0x72,0x72,0x72,0xff,
-    0xb5,0xb5,0xb5,0xff,0xd0,0xd0,0xd0,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xcf,0xcf,0xcf,0xff,0x8d,0x8d,0x8d,0xff,0x2a,0x2a,0x2a,0xff,0x1a,0x1a,0x1a,0xff,0x47,0x47,0x47,0xff,
-    0xb1,0xb1,0xb1,0xff,0xce,0xce,0xce,0xff,0xae,0xae,0xae,0xff,0x64,0x64,0x64,0xff,0x05,0x05,0x05,0xff,
-    0x06,0x06,0x06,0xff,0x09,0x09,0x09,0xff,0x07,0x07,0x07,0xff,0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,
-    0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x09,0x09,0x09,0xff,0x0e,0x0e,0x0e,0xff,0x13,0x13,0x13,0xff,
-    0x14,0x14,0x14,0xff,0x15,0x15,0x15,0xfc,0x15,0x15,0x15,0xf2,0x22,0x22,0x22,0xbe,0x3b,0x3b,0x3b,0x72,
-    0x78,0x78,0x78,0x25,0xd2,0xd2,0xd2,0x0a,0xfd,0xfd,0xfd,0x04,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x03,
-    0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x0b,0xef,0xef,0xef,0x10,0xae,0xae,0xae,0x26,
-    0x61,0x61,0x61,0x6c,0x3d,0x3d,0x3d,0xb5,0x28,0x28,0x28,0xed,0x26,0x26,0x26,0xfb,0x24,0x24,0x24,0xfe,
-    0x20,0x20,0x20,0xff,0x1b,0x1b,0x1b,0xff,0x13,0x13,0x13,0xff,0x0c,0x0c,0x0c,0xff,0x07,0x07,0x07,0xff,
-    0x04,0x04,0x04,0xff,0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x08,0x08,0x08,0xff,0x08,0x08,0x08,0xff,
-    0x04,0x04,0x04,0xff,0x19,0x19,0x19,0xff,0x92,0x92,0x92,0xff,0xd9,0xd9,0xd9,0xff,0xe9,0xe9,0xe9,0xff,
-    0xde,0xde,0xde,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd1,0xd1,0xd1,0xff,
-    0xd0,0xd0,0xd0,0xff,0xd2,0xd2,0xd2,0xff,0xd0,0xd0,0xd0,0xff,0xb1,0xb1,0xb1,0xff,0x62,0x62,0x62,0xff,
-    0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,0x2e,0x2e,0x2e,0xff,0x91,0x91,0x91,0xff,0xc0,0xc0,0xc0,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd0,0xd0,0xd0,0xff,
-    0xbd,0xbd,0xbd,0xff,0xb0,0xb0,0xb0,0xff,0xc7,0xc7,0xc7,0xff,0xd1,0xd1,0xd1,0xff,0xbc,0xbc,0xbc,0xff,
-    0x87,0x87,0x87,0xff,0x20,0x20,0x20,0xff,0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,0x06,0x06,0x06,0xff,
-    0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,0x0a,0x0a,0x0a,0xff,
-    0x14,0x14,0x14,0xff,0x1e,0x1e,0x1e,0xff,0x27,0x27,0x27,0xff,0x2c,0x2c,0x2c,0xff,0x2c,0x2c,0x2c,0xff,
-    0x29,0x29,0x29,0xff,0x25,0x25,0x25,0xff,0x20,0x20,0x20,0xfd,0x1f,0x1f,0x1f,0xee,0x33,0x33,0x33,0xa5,
-    0x64,0x64,0x64,0x44,0xcc,0xcc,0xcc,0x0f,0xfd,0xfd,0xfd,0x06,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x0b,0xec,0xec,0xec,0x14,
-    0x96,0x96,0x96,0x3b,0x4f,0x4f,0x4f,0x99,0x30,0x30,0x30,0xe8,0x30,0x30,0x30,0xfc,0x36,0x36,0x36,0xff,
-    0x3b,0x3b,0x3b,0xff,0x3e,0x3e,0x3e,0xff,0x3c,0x3c,0x3c,0xff,0x37,0x37,0x37,0xff,0x2d,0x2d,0x2d,0xff,
-    0x21,0x21,0x21,0xff,0x15,0x15,0x15,0xff,0x0b,0x0b,0x0b,0xff,0x06,0x06,0x06,0xff,0x03,0x03,0x03,0xff,
-    0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x06,0x06,0x06,0xff,0x05,0x05,0x05,0xff,0x04,0x04,0x04,0xff,
-    0x66,0x66,0x66,0xff,0xc1,0xc1,0xc1,0xff,0xe5,0xe5,0xe5,0xff,0xea,0xea,0xea,0xff,0xdb,0xdb,0xdb,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xc7,0xc7,0xc7,0xff,0x99,0x99,0x99,0xff,0x31,0x31,0x31,0xff,0x09,0x09,0x09,0xff,0x0a,0x0a,0x0a,0xff,
-    0x0a,0x0a,0x0a,0xff,0x48,0x48,0x48,0xff,0x9b,0x9b,0x9b,0xff,0xc7,0xc7,0xc7,0xff,0xd8,0xd8,0xd8,0xff,
-    0xd6,0xd6,0xd6,0xff,0xd3,0xd3,0xd3,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd3,0xd3,0xd3,0xff,
-    0xd5,0xd5,0xd5,0xff,0xc6,0xc6,0xc6,0xff,0x96,0x96,0x96,0xff,0x3a,0x3a,0x3a,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,
-    0x03,0x03,0x03,0xff,0x07,0x07,0x07,0xff,0x11,0x11,0x11,0xff,0x21,0x21,0x21,0xff,0x32,0x32,0x32,0xff,
-    0x40,0x40,0x40,0xff,0x48,0x48,0x48,0xff,0x4b,0x4b,0x4b,0xff,0x48,0x48,0x48,0xff,0x42,0x42,0x42,0xff,
-    0x3c,0x3c,0x3c,0xff,0x34,0x34,0x34,0xff,0x2b,0x2b,0x2b,0xff,0x25,0x25,0x25,0xf7,0x34,0x34,0x34,0xb7,
-    0x6c,0x6c,0x6c,0x48,0xda,0xda,0xda,0x0f,0xfe,0xfe,0xfe,0x06,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x0a,
-    0xf7,0xf7,0xf7,0x12,0xa4,0xa4,0xa4,0x34,0x50,0x50,0x50,0x9f,0x32,0x32,0x32,0xf1,0x37,0x37,0x37,0xfe,
-    0x41,0x41,0x41,0xff,0x4a,0x4a,0x4a,0xff,0x52,0x52,0x52,0xff,0x58,0x58,0x58,0xff,0x5a,0x5a,0x5a,0xff,
-    0x58,0x58,0x58,0xff,0x4f,0x4f,0x4f,0xff,0x41,0x41,0x41,0xff,0x30,0x30,0x30,0xff,0x1f,0x1f,0x1f,0xff,
-    0x11,0x11,0x11,0xff,0x08,0x08,0x08,0xff,0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,
-    0x04,0x04,0x04,0xff,0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,0x2c,0x2c,0x2c,0xff,0x9a,0x9a,0x9a,0xff,
-    0xd7,0xd7,0xd7,0xff,0xe8,0xe8,0xe8,0xff,0xeb,0xeb,0xeb,0xff,0xdb,0xdb,0xdb,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd0,0xd0,0xd0,0xff,0xb2,0xb2,0xb2,0xff,0x70,0x70,0x70,0xff,
-    0x19,0x19,0x19,0xff,0x17,0x17,0x17,0xff,0x18,0x18,0x18,0xff,0x17,0x17,0x17,0xff,0x17,0x17,0x17,0xff,
-    0x4d,0x4d,0x4d,0xff,0x96,0x96,0x96,0xff,0xc3,0xc3,0xc3,0xff,0xdc,0xdc,0xdc,0xff,0xe0,0xe0,0xe0,0xff,
-    0xdc,0xdc,0xdc,0xff,0xd8,0xd8,0xd8,0xff,0xd3,0xd3,0xd3,0xff,0xd3,0xd3,0xd3,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd3,0xd3,0xd3,0xff,
-    0xd5,0xd5,0xd5,0xff,0xda,0xda,0xda,0xff,0xda,0xda,0xda,0xff,0xc7,0xc7,0xc7,0xff,0x95,0x95,0x95,0xff,
-    0x3e,0x3e,0x3e,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,
-    0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x0a,0x0a,0x0a,0xff,
-    0x18,0x18,0x18,0xff,0x2d,0x2d,0x2d,0xff,0x44,0x44,0x44,0xff,0x58,0x58,0x58,0xff,0x65,0x65,0x65,0xff,
-    0x68,0x68,0x68,0xff,0x67,0x67,0x67,0xff,0x62,0x62,0x62,0xff,0x5b,0x5b,0x5b,0xff,0x52,0x52,0x52,0xff,
-    0x49,0x49,0x49,0xff,0x3e,0x3e,0x3e,0xff,0x32,0x32,0x32,0xff,0x29,0x29,0x29,0xf6,0x3e,0x3e,0x3e,0xa6,
-    0x8d,0x8d,0x8d,0x30,0xf3,0xf3,0xf3,0x0b,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x04,
-    0xff,0xff,0xff,0x08,0xfe,0xfe,0xfe,0x0e,0xd5,0xd5,0xd5,0x1e,0x65,0x65,0x65,0x7c,0x36,0x36,0x36,0xe8,
-    0x3a,0x3a,0x3a,0xfe,0x47,0x47,0x47,0xff,0x53,0x53,0x53,0xff,0x5e,0x5e,0x5e,0xff,0x67,0x67,0x67,0xff,
-    0x6f,0x6f,0x6f,0xff,0x74,0x74,0x74,0xff,0x75,0x75,0x75,0xff,0x71,0x71,0x71,0xff,0x66,0x66,0x66,0xff,
-    0x54,0x54,0x54,0xff,0x3f,0x3f,0x3f,0xff,0x29,0x29,0x29,0xff,0x17,0x17,0x17,0xff,0x0a,0x0a,0x0a,0xff,
-    0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x04,0x04,0x04,0xff,
-    0x03,0x03,0x03,0xff,0x04,0x04,0x04,0xff,0x60,0x60,0x60,0xff,0xb7,0xb7,0xb7,0xff,0xdf,0xdf,0xdf,0xff,
-    0xe9,0xe9,0xe9,0xff,0xeb,0xeb,0xeb,0xff,0xde,0xde,0xde,0xff,0xd3,0xd3,0xd3,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd1,0xd1,0xd1,0xff,
-    0xc0,0xc0,0xc0,0xff,0x92,0x92,0x92,0xff,0x39,0x39,0x39,0xff,0x24,0x24,0x24,0xff,0x26,0x26,0x26,0xff,
-    0x26,0x26,0x26,0xff,0x26,0x26,0x26,0xff,0x23,0x23,0x23,0xff,0x21,0x21,0x21,0xff,0x3e,0x3e,0x3e,0xff,
-    0x80,0x80,0x80,0xff,0xb0,0xb0,0xb0,0xff,0xd0,0xd0,0xd0,0xff,0xe0,0xe0,0xe0,0xff,0xe5,0xe5,0xe5,0xff,
-    0xe6,0xe6,0xe6,0xff,0xe4,0xe4,0xe4,0xff,0xe1,0xe1,0xe1,0xff,0xdf,0xdf,0xdf,0xff,0xde,0xde,0xde,0xff,
-    0xdf,0xdf,0xdf,0xff,0xe0,0xe0,0xe0,0xff,0xe2,0xe2,0xe2,0xff,0xe0,0xe0,0xe0,0xff,0xd4,0xd4,0xd4,0xff,
-    0xb6,0xb6,0xb6,0xff,0x7c,0x7c,0x7c,0xff,0x2c,0x2c,0x2c,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x0c,0x0c,0x0c,0xff,0x1d,0x1d,0x1d,0xff,0x36,0x36,0x36,0xff,
-    0x51,0x51,0x51,0xff,0x69,0x69,0x69,0xff,0x79,0x79,0x79,0xff,0x7f,0x7f,0x7f,0xff,0x7f,0x7f,0x7f,0xff,
-    0x7c,0x7c,0x7c,0xff,0x77,0x77,0x77,0xff,0x70,0x70,0x70,0xff,0x67,0x67,0x67,0xff,0x5c,0x5c,0x5c,0xff,
-    0x4f,0x4f,0x4f,0xff,0x41,0x41,0x41,0xff,0x33,0x33,0x33,0xfe,0x2d,0x2d,0x2d,0xe7,0x5b,0x5b,0x5b,0x6f,
-    0xd2,0xd2,0xd2,0x14,0xfe,0xfe,0xfe,0x07,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x0a,0xf9,0xf9,0xf9,0x12,0x9e,0x9e,0x9e,0x3d,
-    0x46,0x46,0x46,0xbf,0x37,0x37,0x37,0xfc,0x45,0x45,0x45,0xff,0x54,0x54,0x54,0xff,0x62,0x62,0x62,0xff,
-    0x6e,0x6e,0x6e,0xff,0x78,0x78,0x78,0xff,0x81,0x81,0x81,0xff,0x87,0x87,0x87,0xff,0x8b,0x8b,0x8b,0xff,
-    0x8b,0x8b,0x8b,0xff,0x85,0x85,0x85,0xff,0x78,0x78,0x78,0xff,0x64,0x64,0x64,0xff,0x4b,0x4b,0x4b,0xff,
-    0x32,0x32,0x32,0xff,0x1d,0x1d,0x1d,0xff,0x0d,0x0d,0x0d,0xff,0x05,0x05,0x05,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,
-    0x17,0x17,0x17,0xff,0x7f,0x7f,0x7f,0xff,0xc3,0xc3,0xc3,0xff,0xe0,0xe0,0xe0,0xff,0xe8,0xe8,0xe8,0xff,
-    0xeb,0xeb,0xeb,0xff,0xe4,0xe4,0xe4,0xff,0xd6,0xd6,0xd6,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd1,0xd1,0xd1,0xff,0xc5,0xc5,0xc5,0xff,0xa1,0xa1,0xa1,0xff,0x5b,0x5b,0x5b,0xff,
-    0x2f,0x2f,0x2f,0xff,0x32,0x32,0x32,0xff,0x34,0x34,0x34,0xff,0x35,0x35,0x35,0xff,0x34,0x34,0x34,0xff,
-    0x32,0x32,0x32,0xff,0x2e,0x2e,0x2e,0xff,0x29,0x29,0x29,0xff,0x2a,0x2a,0x2a,0xff,0x55,0x55,0x55,0xff,
-    0x85,0x85,0x85,0xff,0xaa,0xaa,0xaa,0xff,0xc3,0xc3,0xc3,0xff,0xd3,0xd3,0xd3,0xff,0xdb,0xdb,0xdb,0xff,
-    0xdf,0xdf,0xdf,0xff,0xe0,0xe0,0xe0,0xff,0xdf,0xdf,0xdf,0xff,0xdc,0xdc,0xdc,0xff,0xd5,0xd5,0xd5,0xff,
-    0xc7,0xc7,0xc7,0xff,0xaf,0xaf,0xaf,0xff,0x84,0x84,0x84,0xff,0x49,0x49,0x49,0xff,0x0d,0x0d,0x0d,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x04,0x04,0x04,0xff,
-    0x0d,0x0d,0x0d,0xff,0x1f,0x1f,0x1f,0xff,0x3a,0x3a,0x3a,0xff,0x57,0x57,0x57,0xff,0x72,0x72,0x72,0xff,
-    0x83,0x83,0x83,0xff,0x8c,0x8c,0x8c,0xff,0x8d,0x8d,0x8d,0xff,0x8c,0x8c,0x8c,0xff,0x88,0x88,0x88,0xff,
-    0x84,0x84,0x84,0xff,0x7e,0x7e,0x7e,0xff,0x76,0x76,0x76,0xff,0x6b,0x6b,0x6b,0xff,0x5e,0x5e,0x5e,0xff,
-    0x4f,0x4f,0x4f,0xff,0x3e,0x3e,0x3e,0xff,0x2f,0x2f,0x2f,0xfa,0x41,0x41,0x41,0xac,0xa3,0xa3,0xa3,0x27,
-    0xfc,0xfc,0xfc,0x0a,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x0b,
-    0xec,0xec,0xec,0x16,0x77,0x77,0x77,0x65,0x39,0x39,0x39,0xe6,0x3f,0x3f,0x3f,0xff,0x4f,0x4f,0x4f,0xff,
-    0x5f,0x5f,0x5f,0xff,0x6e,0x6e,0x6e,0xff,0x7b,0x7b,0x7b,0xff,0x85,0x85,0x85,0xff,0x8d,0x8d,0x8d,0xff,
-    0x93,0x93,0x93,0xff,0x97,0x97,0x97,0xff,0x99,0x99,0x99,0xff,0x98,0x98,0x98,0xff,0x91,0x91,0x91,0xff,
-    0x83,0x83,0x83,0xff,0x6e,0x6e,0x6e,0xff,0x53,0x53,0x53,0xff,0x38,0x38,0x38,0xff,0x21,0x21,0x21,0xff,
-    0x10,0x10,0x10,0xff,0x06,0x06,0x06,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x2d,0x2d,0x2d,0xff,
-    0x8c,0x8c,0x8c,0xff,0xc5,0xc5,0xc5,0xff,0xdf,0xdf,0xdf,0xff,0xe6,0xe6,0xe6,0xff,0xe9,0xe9,0xe9,0xff,
-    0xe7,0xe7,0xe7,0xff,0xde,0xde,0xde,0xff,0xd5,0xd5,0xd5,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd2,0xd2,0xd2,0xff,0xd1,0xd1,0xd1,0xff,0xc4,0xc4,0xc4,0xff,
-    0xa4,0xa4,0xa4,0xff,0x6c,0x6c,0x6c,0xff,0x3a,0x3a,0x3a,0xff,0x3d,0x3d,0x3d,0xff,0x40,0x40,0x40,0xff,
-    0x42,0x42,0x42,0xff,0x43,0x43,0x43,0xff,0x42,0x42,0x42,0xff,0x40,0x40,0x40,0xff,0x3c,0x3c,0x3c,0xff,
-    0x36,0x36,0x36,0xff,0x30,0x30,0x30,0xff,0x29,0x29,0x29,0xff,0x26,0x26,0x26,0xff,0x3d,0x3d,0x3d,0xff,
-    0x61,0x61,0x61,0xff,0x7a,0x7a,0x7a,0xff,0x8c,0x8c,0x8c,0xff,0x98,0x98,0x98,0xff,0x9d,0x9d,0x9d,0xff,
-    0x9a,0x9a,0x9a,0xff,0x8e,0x8e,0x8e,0xff,0x79,0x79,0x79,0xff,0x5d,0x5d,0x5d,0xff,0x32,0x32,0x32,0xff,
-    0x0d,0x0d,0x0d,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x0c,0x0c,0x0c,0xff,0x1f,0x1f,0x1f,0xff,
-    0x3a,0x3a,0x3a,0xff,0x58,0x58,0x58,0xff,0x74,0x74,0x74,0xff,0x86,0x86,0x86,0xff,0x90,0x90,0x90,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,0x90,0x90,0x90,0xff,0x8c,0x8c,0x8c,0xff,
-    0x88,0x88,0x88,0xff,0x81,0x81,0x81,0xff,0x77,0x77,0x77,0xff,0x6a,0x6a,0x6a,0xff,0x5a,0x5a,0x5a,0xff,
-    0x48,0x48,0x48,0xff,0x35,0x35,0x35,0xfe,0x36,0x36,0x36,0xd2,0x85,0x85,0x85,0x3f,0xf8,0xf8,0xf8,0x0c,
-    0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x0c,0xd9,0xd9,0xd9,0x1c,0x5d,0x5d,0x5d,0x8c,0x36,0x36,0x36,0xf6,
-    0x44,0x44,0x44,0xff,0x57,0x57,0x57,0xff,0x68,0x68,0x68,0xff,0x77,0x77,0x77,0xff,0x84,0x84,0x84,0xff,
-    0x8e,0x8e,0x8e,0xff,0x95,0x95,0x95,0xff,0x9a,0x9a,0x9a,0xff,0x9d,0x9d,0x9d,0xff,0x9e,0x9e,0x9e,0xff,
-    0x9f,0x9f,0x9f,0xff,0x9c,0x9c,0x9c,0xff,0x95,0x95,0x95,0xff,0x87,0x87,0x87,0xff,0x72,0x72,0x72,0xff,
-    0x57,0x57,0x57,0xff,0x3b,0x3b,0x3b,0xff,0x23,0x23,0x23,0xff,0x11,0x11,0x11,0xff,0x07,0x07,0x07,0xff,
-    0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x32,0x32,0x32,0xff,0x88,0x88,0x88,0xff,
-    0xbe,0xbe,0xbe,0xff,0xd8,0xd8,0xd8,0xff,0xe3,0xe3,0xe3,0xff,0xe5,0xe5,0xe5,0xff,0xe5,0xe5,0xe5,0xff,
-    0xe2,0xe2,0xe2,0xff,0xdb,0xdb,0xdb,0xff,0xd6,0xd6,0xd6,0xff,0xd3,0xd3,0xd3,0xff,0xd1,0xd1,0xd1,0xff,
-    0xcc,0xcc,0xcc,0xff,0xbb,0xbb,0xbb,0xff,0x9f,0x9f,0x9f,0xff,0x6d,0x6d,0x6d,0xff,0x41,0x41,0x41,0xff,
-    0x45,0x45,0x45,0xff,0x4b,0x4b,0x4b,0xff,0x4f,0x4f,0x4f,0xff,0x51,0x51,0x51,0xff,0x52,0x52,0x52,0xff,
-    0x50,0x50,0x50,0xff,0x4e,0x4e,0x4e,0xff,0x4a,0x4a,0x4a,0xff,0x44,0x44,0x44,0xff,0x3d,0x3d,0x3d,0xff,
-    0x35,0x35,0x35,0xff,0x2c,0x2c,0x2c,0xff,0x22,0x22,0x22,0xff,0x17,0x17,0x17,0xff,0x12,0x12,0x12,0xff,
-    0x12,0x12,0x12,0xff,0x16,0x16,0x16,0xff,0x17,0x17,0x17,0xff,0x16,0x16,0x16,0xff,0x11,0x11,0x11,0xff,
-    0x07,0x07,0x07,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x03,0x03,0x03,0xff,0x0b,0x0b,0x0b,0xff,0x1c,0x1c,0x1c,0xff,0x35,0x35,0x35,0xff,0x53,0x53,0x53,0xff,
-    0x6f,0x6f,0x6f,0xff,0x83,0x83,0x83,0xff,0x8e,0x8e,0x8e,0xff,0x92,0x92,0x92,0xff,0x93,0x93,0x93,0xff,
-    0x93,0x93,0x93,0xff,0x93,0x93,0x93,0xff,0x92,0x92,0x92,0xff,0x90,0x90,0x90,0xff,0x8d,0x8d,0x8d,0xff,
-    0x87,0x87,0x87,0xff,0x7f,0x7f,0x7f,0xff,0x72,0x72,0x72,0xff,0x62,0x62,0x62,0xff,0x4f,0x4f,0x4f,0xff,
-    0x3b,0x3b,0x3b,0xff,0x32,0x32,0x32,0xe5,0x76,0x76,0x76,0x51,0xf4,0xf4,0xf4,0x0d,0xff,0xff,0xff,0x05,
-    0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x0c,0xc6,0xc6,0xc6,0x22,
-    0x4d,0x4d,0x4d,0xaa,0x37,0x37,0x37,0xfb,0x49,0x49,0x49,0xff,0x5d,0x5d,0x5d,0xff,0x6f,0x6f,0x6f,0xff,
-    0x7e,0x7e,0x7e,0xff,0x8a,0x8a,0x8a,0xff,0x93,0x93,0x93,0xff,0x99,0x99,0x99,0xff,0x9d,0x9d,0x9d,0xff,
-    0x9f,0x9f,0x9f,0xff,0x9e,0x9e,0x9e,0xff,0x9e,0x9e,0x9e,0xff,0x9c,0x9c,0x9c,0xff,0x98,0x98,0x98,0xff,
-    0x91,0x91,0x91,0xff,0x83,0x83,0x83,0xff,0x6f,0x6f,0x6f,0xff,0x55,0x55,0x55,0xff,0x3b,0x3b,0x3b,0xff,
-    0x23,0x23,0x23,0xff,0x11,0x11,0x11,0xff,0x07,0x07,0x07,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x23,0x23,0x23,0xff,0x71,0x71,0x71,0xff,0xa9,0xa9,0xa9,0xff,
-    0xc7,0xc7,0xc7,0xff,0xd6,0xd6,0xd6,0xff,0xdc,0xdc,0xdc,0xff,0xdd,0xdd,0xdd,0xff,0xdb,0xdb,0xdb,0xff,
-    0xd6,0xd6,0xd6,0xff,0xcc,0xcc,0xcc,0xff,0xbc,0xbc,0xbc,0xff,0xa9,0xa9,0xa9,0xff,0x8e,0x8e,0x8e,0xff,
-    0x5e,0x5e,0x5e,0xff,0x44,0x44,0x44,0xff,0x4b,0x4b,0x4b,0xff,0x52,0x52,0x52,0xff,0x58,0x58,0x58,0xff,
-    0x5d,0x5d,0x5d,0xff,0x5f,0x5f,0x5f,0xff,0x60,0x60,0x60,0xff,0x5f,0x5f,0x5f,0xff,0x5c,0x5c,0x5c,0xff,
-    0x58,0x58,0x58,0xff,0x51,0x51,0x51,0xff,0x4a,0x4a,0x4a,0xff,0x41,0x41,0x41,0xff,0x37,0x37,0x37,0xff,
-    0x2d,0x2d,0x2d,0xff,0x21,0x21,0x21,0xff,0x15,0x15,0x15,0xff,0x08,0x08,0x08,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x02,0x02,0x02,0xff,0x09,0x09,0x09,0xff,
-    0x18,0x18,0x18,0xff,0x2f,0x2f,0x2f,0xff,0x4a,0x4a,0x4a,0xff,0x65,0x65,0x65,0xff,0x78,0x78,0x78,0xff,
-    0x84,0x84,0x84,0xff,0x8a,0x8a,0x8a,0xff,0x8c,0x8c,0x8c,0xff,0x8e,0x8e,0x8e,0xff,0x8f,0x8f,0x8f,0xff,
-    0x91,0x91,0x91,0xff,0x91,0x91,0x91,0xff,0x91,0x91,0x91,0xff,0x90,0x90,0x90,0xff,0x8b,0x8b,0x8b,0xff,
-    0x84,0x84,0x84,0xff,0x78,0x78,0x78,0xff,0x68,0x68,0x68,0xff,0x54,0x54,0x54,0xff,0x3f,0x3f,0x3f,0xff,
-    0x31,0x31,0x31,0xec,0x71,0x71,0x71,0x58,0xf3,0xf3,0xf3,0x0d,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x05,
-    0xff,0xff,0xff,0x0b,0xc3,0xc3,0xc3,0x22,0x47,0x47,0x47,0xb4,0x37,0x37,0x37,0xfd,0x4b,0x4b,0x4b,0xff,
-    0x60,0x60,0x60,0xff,0x73,0x73,0x73,0xff,0x82,0x82,0x82,0xff,0x8f,0x8f,0x8f,0xff,0x97,0x97,0x97,0xff,
-    0x9b,0x9b,0x9b,0xff,0x9e,0x9e,0x9e,0xff,0x9d,0x9d,0x9d,0xff,0x9b,0x9b,0x9b,0xff,0x98,0x98,0x98,0xff,
-    0x94,0x94,0x94,0xff,0x91,0x91,0x91,0xff,0x8c,0x8c,0x8c,0xff,0x84,0x84,0x84,0xff,0x78,0x78,0x78,0xff,
-    0x65,0x65,0x65,0xff,0x4e,0x4e,0x4e,0xff,0x36,0x36,0x36,0xff,0x20,0x20,0x20,0xff,0x10,0x10,0x10,0xff,
-    0x06,0x06,0x06,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x0a,0x0a,0x0a,0xff,0x40,0x40,0x40,0xff,0x77,0x77,0x77,0xff,0x9e,0x9e,0x9e,0xff,
-    0xb1,0xb1,0xb1,0xff,0xb9,0xb9,0xb9,0xff,0xb8,0xb8,0xb8,0xff,0xb0,0xb0,0xb0,0xff,0xa1,0xa1,0xa1,0xff,
-    0x88,0x88,0x88,0xff,0x66,0x66,0x66,0xff,0x44,0x44,0x44,0xff,0x45,0x45,0x45,0xff,0x4f,0x4f,0x4f,0xff,
-    0x58,0x58,0x58,0xff,0x60,0x60,0x60,0xff,0x66,0x66,0x66,0xff,0x6b,0x6b,0x6b,0xff,0x6e,0x6e,0x6e,0xff,
-    0x6f,0x6f,0x6f,0xff,0x6d,0x6d,0x6d,0xff,0x6a,0x6a,0x6a,0xff,0x65,0x65,0x65,0xff,0x5f,0x5f,0x5f,0xff,
-    0x56,0x56,0x56,0xff,0x4d,0x4d,0x4d,0xff,0x42,0x42,0x42,0xff,0x37,0x37,0x37,0xff,0x2b,0x2b,0x2b,0xff,
-    0x1f,0x1f,0x1f,0xff,0x11,0x11,0x11,0xff,0x04,0x04,0x04,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,0x12,0x12,0x12,0xff,0x25,0x25,0x25,0xff,
-    0x3c,0x3c,0x3c,0xff,0x54,0x54,0x54,0xff,0x66,0x66,0x66,0xff,0x72,0x72,0x72,0xff,0x79,0x79,0x79,0xff,
-    0x7c,0x7c,0x7c,0xff,0x7f,0x7f,0x7f,0xff,0x83,0x83,0x83,0xff,0x87,0x87,0x87,0xff,0x8b,0x8b,0x8b,0xff,
-    0x8e,0x8e,0x8e,0xff,0x90,0x90,0x90,0xff,0x90,0x90,0x90,0xff,0x8d,0x8d,0x8d,0xff,0x86,0x86,0x86,0xff,
-    0x7b,0x7b,0x7b,0xff,0x6b,0x6b,0x6b,0xff,0x56,0x56,0x56,0xff,0x40,0x40,0x40,0xff,0x31,0x31,0x31,0xed,
-    0x76,0x76,0x76,0x53,0xf8,0xf8,0xf8,0x0c,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x0a,0xce,0xce,0xce,0x1d,0x48,0x48,0x48,0xaf,
-    0x36,0x36,0x36,0xfd,0x4b,0x4b,0x4b,0xff,0x61,0x61,0x61,0xff,0x74,0x74,0x74,0xff,0x85,0x85,0x85,0xff,
-    0x91,0x91,0x91,0xff,0x98,0x98,0x98,0xff,0x9c,0x9c,0x9c,0xff,0x9c,0x9c,0x9c,0xff,0x9a,0x9a,0x9a,0xff,
-    0x96,0x96,0x96,0xff,0x90,0x90,0x90,0xff,0x8a,0x8a,0x8a,0xff,0x83,0x83,0x83,0xff,0x7d,0x7d,0x7d,0xff,
-    0x77,0x77,0x77,0xff,0x6f,0x6f,0x6f,0xff,0x64,0x64,0x64,0xff,0x54,0x54,0x54,0xff,0x41,0x41,0x41,0xff,
-    0x2d,0x2d,0x2d,0xff,0x1b,0x1b,0x1b,0xff,0x0d,0x0d,0x0d,0xff,0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x08,0x08,0x08,0xff,0x1f,0x1f,0x1f,0xff,0x40,0x40,0x40,0xff,0x53,0x53,0x53,0xff,
-    0x56,0x56,0x56,0xff,0x4e,0x4e,0x4e,0xff,0x3b,0x3b,0x3b,0xff,0x30,0x30,0x30,0xff,0x37,0x37,0x37,0xff,
-    0x43,0x43,0x43,0xff,0x4f,0x4f,0x4f,0xff,0x5a,0x5a,0x5a,0xff,0x64,0x64,0x64,0xff,0x6d,0x6d,0x6d,0xff,
-    0x74,0x74,0x74,0xff,0x79,0x79,0x79,0xff,0x7c,0x7c,0x7c,0xff,0x7d,0x7d,0x7d,0xff,0x7b,0x7b,0x7b,0xff,
-    0x78,0x78,0x78,0xff,0x73,0x73,0x73,0xff,0x6b,0x6b,0x6b,0xff,0x63,0x63,0x63,0xff,0x59,0x59,0x59,0xff,
-    0x4e,0x4e,0x4e,0xff,0x42,0x42,0x42,0xff,0x35,0x35,0x35,0xff,0x28,0x28,0x28,0xff,0x1a,0x1a,0x1a,0xff,
-    0x0c,0x0c,0x0c,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x04,0x04,0x04,0xff,0x0b,0x0b,0x0b,0xff,0x19,0x19,0x19,0xff,0x2b,0x2b,0x2b,0xff,0x3d,0x3d,0x3d,0xff,
-    0x4d,0x4d,0x4d,0xff,0x57,0x57,0x57,0xff,0x5e,0x5e,0x5e,0xff,0x62,0x62,0x62,0xff,0x66,0x66,0x66,0xff,
-    0x6d,0x6d,0x6d,0xff,0x73,0x73,0x73,0xff,0x7b,0x7b,0x7b,0xff,0x82,0x82,0x82,0xff,0x88,0x88,0x88,0xff,
-    0x8c,0x8c,0x8c,0xff,0x8e,0x8e,0x8e,0xff,0x8d,0x8d,0x8d,0xff,0x87,0x87,0x87,0xff,0x7c,0x7c,0x7c,0xff,
-    0x6c,0x6c,0x6c,0xff,0x57,0x57,0x57,0xff,0x3f,0x3f,0x3f,0xff,0x33,0x33,0x33,0xe6,0x85,0x85,0x85,0x42,
-    0xfc,0xfc,0xfc,0x0a,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x09,
-    0xe1,0xe1,0xe1,0x16,0x50,0x50,0x50,0x99,0x34,0x34,0x34,0xfc,0x49,0x49,0x49,0xff,0x5f,0x5f,0x5f,0xff,
-    0x74,0x74,0x74,0xff,0x85,0x85,0x85,0xff,0x91,0x91,0x91,0xff,0x99,0x99,0x99,0xff,0x9b,0x9b,0x9b,0xff,
-    0x9a,0x9a,0x9a,0xff,0x96,0x96,0x96,0xff,0x90,0x90,0x90,0xff,0x87,0x87,0x87,0xff,0x7e,0x7e,0x7e,0xff,
-    0x74,0x74,0x74,0xff,0x6b,0x6b,0x6b,0xff,0x63,0x63,0x63,0xff,0x5c,0x5c,0x5c,0xff,0x55,0x55,0x55,0xff,
-    0x4c,0x4c,0x4c,0xff,0x3f,0x3f,0x3f,0xff,0x31,0x31,0x31,0xff,0x21,0x21,0x21,0xff,0x14,0x14,0x14,0xff,
-    0x09,0x09,0x09,0xff,0x04,0x04,0x04,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x06,0x06,0x06,0xff,0x15,0x15,0x15,0xff,
-    0x24,0x24,0x24,0xff,0x32,0x32,0x32,0xff,0x40,0x40,0x40,0xff,0x4d,0x4d,0x4d,0xff,0x5a,0x5a,0x5a,0xff,
-    0x65,0x65,0x65,0xff,0x70,0x70,0x70,0xff,0x79,0x79,0x79,0xff,0x81,0x81,0x81,0xff,0x87,0x87,0x87,0xff,
-    0x8a,0x8a,0x8a,0xff,0x8b,0x8b,0x8b,0xff,0x8a,0x8a,0x8a,0xff,0x86,0x86,0x86,0xff,0x80,0x80,0x80,0xff,
-    0x78,0x78,0x78,0xff,0x6f,0x6f,0x6f,0xff,0x64,0x64,0x64,0xff,0x58,0x58,0x58,0xff,0x4b,0x4b,0x4b,0xff,
-    0x3e,0x3e,0x3e,0xff,0x30,0x30,0x30,0xff,0x22,0x22,0x22,0xff,0x13,0x13,0x13,0xff,0x04,0x04,0x04,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,
-    0x0e,0x0e,0x0e,0xff,0x1a,0x1a,0x1a,0xff,0x26,0x26,0x26,0xff,0x31,0x31,0x31,0xff,0x39,0x39,0x39,0xff,
-    0x3e,0x3e,0x3e,0xff,0x42,0x42,0x42,0xff,0x47,0x47,0x47,0xff,0x4f,0x4f,0x4f,0xff,0x58,0x58,0x58,0xff,
-    0x62,0x62,0x62,0xff,0x6d,0x6d,0x6d,0xff,0x77,0x77,0x77,0xff,0x80,0x80,0x80,0xff,0x87,0x87,0x87,0xff,
-    0x8b,0x8b,0x8b,0xff,0x8c,0x8c,0x8c,0xff,0x87,0x87,0x87,0xff,0x7c,0x7c,0x7c,0xff,0x6b,0x6b,0x6b,0xff,
-    0x55,0x55,0x55,0xff,0x3c,0x3c,0x3c,0xff,0x37,0x37,0x37,0xd5,0xa2,0xa2,0xa2,0x2b,0xfe,0xfe,0xfe,0x09,
-    0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x07,0xf2,0xf2,0xf2,0x10,0x62,0x62,0x62,0x75,0x31,0x31,0x31,0xfa,
-    0x45,0x45,0x45,0xff,0x5c,0x5c,0x5c,0xff,0x72,0x72,0x72,0xff,0x84,0x84,0x84,0xff,0x91,0x91,0x91,0xff,
-    0x98,0x98,0x98,0xff,0x9a,0x9a,0x9a,0xff,0x97,0x97,0x97,0xff,0x91,0x91,0x91,0xff,0x89,0x89,0x89,0xff,
-    0x7e,0x7e,0x7e,0xff,0x72,0x72,0x72,0xff,0x65,0x65,0x65,0xff,0x59,0x59,0x59,0xff,0x4e,0x4e,0x4e,0xff,
-    0x46,0x46,0x46,0xff,0x3f,0x3f,0x3f,0xff,0x39,0x39,0x39,0xff,0x32,0x32,0x32,0xff,0x2a,0x2a,0x2a,0xff,
-    0x20,0x20,0x20,0xff,0x16,0x16,0x16,0xff,0x0d,0x0d,0x0d,0xff,0x06,0x06,0x06,0xff,0x02,0x02,0x02,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x0c,0x0c,0x0c,0xff,0x1c,0x1c,0x1c,0xff,0x2b,0x2b,0x2b,0xff,0x3a,0x3a,0x3a,0xff,
-    0x48,0x48,0x48,0xff,0x56,0x56,0x56,0xff,0x63,0x63,0x63,0xff,0x70,0x70,0x70,0xff,0x7b,0x7b,0x7b,0xff,
-    0x86,0x86,0x86,0xff,0x8e,0x8e,0x8e,0xff,0x94,0x94,0x94,0xff,0x98,0x98,0x98,0xff,0x9a,0x9a,0x9a,0xff,
-    0x98,0x98,0x98,0xff,0x94,0x94,0x94,0xff,0x8d,0x8d,0x8d,0xff,0x84,0x84,0x84,0xff,0x7a,0x7a,0x7a,0xff,
-    0x6e,0x6e,0x6e,0xff,0x61,0x61,0x61,0xff,0x54,0x54,0x54,0xff,0x46,0x46,0x46,0xff,0x37,0x37,0x37,0xff,
-    0x29,0x29,0x29,0xff,0x1a,0x1a,0x1a,0xff,0x0a,0x0a,0x0a,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,0x0c,0x0c,0x0c,0xff,
-    0x13,0x13,0x13,0xff,0x19,0x19,0x19,0xff,0x1d,0x1d,0x1d,0xff,0x21,0x21,0x21,0xff,0x25,0x25,0x25,0xff,
-    0x2a,0x2a,0x2a,0xff,0x30,0x30,0x30,0xff,0x39,0x39,0x39,0xff,0x44,0x44,0x44,0xff,0x50,0x50,0x50,0xff,
-    0x5e,0x5e,0x5e,0xff,0x6b,0x6b,0x6b,0xff,0x77,0x77,0x77,0xff,0x81,0x81,0x81,0xff,0x88,0x88,0x88,0xff,
-    0x8a,0x8a,0x8a,0xff,0x86,0x86,0x86,0xff,0x7b,0x7b,0x7b,0xff,0x69,0x69,0x69,0xff,0x51,0x51,0x51,0xff,
-    0x38,0x38,0x38,0xfe,0x42,0x42,0x42,0xb3,0xd1,0xd1,0xd1,0x18,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x05,0xfd,0xfd,0xfd,0x0c,
-    0x84,0x84,0x84,0x47,0x30,0x30,0x30,0xee,0x40,0x40,0x40,0xff,0x57,0x57,0x57,0xff,0x6e,0x6e,0x6e,0xff,
-    0x81,0x81,0x81,0xff,0x8f,0x8f,0x8f,0xff,0x96,0x96,0x96,0xff,0x97,0x97,0x97,0xff,0x93,0x93,0x93,0xff,
-    0x8c,0x8c,0x8c,0xff,0x81,0x81,0x81,0xff,0x75,0x75,0x75,0xff,0x66,0x66,0x66,0xff,0x58,0x58,0x58,0xff,
-    0x4a,0x4a,0x4a,0xff,0x3d,0x3d,0x3d,0xff,0x33,0x33,0x33,0xff,0x2b,0x2b,0x2b,0xff,0x25,0x25,0x25,0xff,
-    0x20,0x20,0x20,0xff,0x1c,0x1c,0x1c,0xff,0x17,0x17,0x17,0xff,0x12,0x12,0x12,0xff,0x0c,0x0c,0x0c,0xff,
-    0x07,0x07,0x07,0xff,0x03,0x03,0x03,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x03,0x03,0x03,0xff,0x12,0x12,0x12,0xff,
-    0x22,0x22,0x22,0xff,0x31,0x31,0x31,0xff,0x40,0x40,0x40,0xff,0x4f,0x4f,0x4f,0xff,0x5e,0x5e,0x5e,0xff,
-    0x6c,0x6c,0x6c,0xff,0x79,0x79,0x79,0xff,0x86,0x86,0x86,0xff,0x91,0x91,0x91,0xff,0x9b,0x9b,0x9b,0xff,
-    0xa2,0xa2,0xa2,0xff,0xa7,0xa7,0xa7,0xff,0xa8,0xa8,0xa8,0xff,0xa6,0xa6,0xa6,0xff,0xa1,0xa1,0xa1,0xff,
-    0x99,0x99,0x99,0xff,0x90,0x90,0x90,0xff,0x85,0x85,0x85,0xff,0x78,0x78,0x78,0xff,0x6a,0x6a,0x6a,0xff,
-    0x5c,0x5c,0x5c,0xff,0x4d,0x4d,0x4d,0xff,0x3e,0x3e,0x3e,0xff,0x2f,0x2f,0x2f,0xff,0x20,0x20,0x20,0xff,
-    0x10,0x10,0x10,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x04,0x04,0x04,0xff,0x07,0x07,0x07,0xff,0x09,0x09,0x09,0xff,
-    0x0b,0x0b,0x0b,0xff,0x0d,0x0d,0x0d,0xff,0x0f,0x0f,0x0f,0xff,0x13,0x13,0x13,0xff,0x18,0x18,0x18,0xff,
-    0x1e,0x1e,0x1e,0xff,0x27,0x27,0x27,0xff,0x33,0x33,0x33,0xff,0x41,0x41,0x41,0xff,0x50,0x50,0x50,0xff,
-    0x5f,0x5f,0x5f,0xff,0x6e,0x6e,0x6e,0xff,0x7b,0x7b,0x7b,0xff,0x84,0x84,0x84,0xff,0x87,0x87,0x87,0xff,
-    0x83,0x83,0x83,0xff,0x77,0x77,0x77,0xff,0x64,0x64,0x64,0xff,0x4b,0x4b,0x4b,0xff,0x33,0x33,0x33,0xfb,
-    0x5c,0x5c,0x5c,0x7b,0xf1,0xf1,0xf1,0x0e,0xff,0xff,0xff,0x05,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x09,0xbd,0xbd,0xbd,0x21,0x38,0x38,0x38,0xcd,0x38,0x38,0x38,0xff,
-    0x50,0x50,0x50,0xff,0x68,0x68,0x68,0xff,0x7d,0x7d,0x7d,0xff,0x8b,0x8b,0x8b,0xff,0x93,0x93,0x93,0xff,
-    0x94,0x94,0x94,0xff,0x8f,0x8f,0x8f,0xff,0x86,0x86,0x86,0xff,0x7a,0x7a,0x7a,0xff,0x6c,0x6c,0x6c,0xff,
-    0x5c,0x5c,0x5c,0xff,0x4c,0x4c,0x4c,0xff,0x3e,0x3e,0x3e,0xff,0x30,0x30,0x30,0xff,0x25,0x25,0x25,0xff,
-    0x1c,0x1c,0x1c,0xff,0x16,0x16,0x16,0xff,0x12,0x12,0x12,0xff,0x0f,0x0f,0x0f,0xff,0x0d,0x0d,0x0d,0xff,
-    0x0a,0x0a,0x0a,0xff,0x07,0x07,0x07,0xff,0x05,0x05,0x05,0xff,0x03,0x03,0x03,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x07,0x07,0x07,0xff,0x17,0x17,0x17,0xff,0x27,0x27,0x27,0xff,0x37,0x37,0x37,0xff,
-    0x47,0x47,0x47,0xff,0x56,0x56,0x56,0xff,0x65,0x65,0x65,0xff,0x74,0x74,0x74,0xff,0x83,0x83,0x83,0xff,
-    0x90,0x90,0x90,0xff,0x9c,0x9c,0x9c,0xff,0xa7,0xa7,0xa7,0xff,0xaf,0xaf,0xaf,0xff,0xb5,0xb5,0xb5,0xff,
-    0xb6,0xb6,0xb6,0xff,0xb4,0xb4,0xb4,0xff,0xae,0xae,0xae,0xff,0xa6,0xa6,0xa6,0xff,0x9b,0x9b,0x9b,0xff,
-    0x8e,0x8e,0x8e,0xff,0x81,0x81,0x81,0xff,0x72,0x72,0x72,0xff,0x63,0x63,0x63,0xff,0x54,0x54,0x54,0xff,
-    0x45,0x45,0x45,0xff,0x35,0x35,0x35,0xff,0x25,0x25,0x25,0xff,0x15,0x15,0x15,0xff,0x05,0x05,0x05,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,
-    0x04,0x04,0x04,0xff,0x06,0x06,0x06,0xff,0x08,0x08,0x08,0xff,0x0c,0x0c,0x0c,0xff,0x12,0x12,0x12,0xff,
-    0x1b,0x1b,0x1b,0xff,0x26,0x26,0x26,0xff,0x33,0x33,0x33,0xff,0x44,0x44,0x44,0xff,0x55,0x55,0x55,0xff,
-    0x65,0x65,0x65,0xff,0x74,0x74,0x74,0xff,0x7f,0x7f,0x7f,0xff,0x83,0x83,0x83,0xff,0x7f,0x7f,0x7f,0xff,
-    0x73,0x73,0x73,0xff,0x5d,0x5d,0x5d,0xff,0x44,0x44,0x44,0xff,0x32,0x32,0x32,0xed,0x8b,0x8b,0x8b,0x3d,
-    0xfe,0xfe,0xfe,0x09,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x06,0xee,0xee,0xee,0x10,
-    0x53,0x53,0x53,0x8b,0x31,0x31,0x31,0xfd,0x48,0x48,0x48,0xff,0x60,0x60,0x60,0xff,0x76,0x76,0x76,0xff,
-    0x86,0x86,0x86,0xff,0x8f,0x8f,0x8f,0xff,0x90,0x90,0x90,0xff,0x8b,0x8b,0x8b,0xff,0x81,0x81,0x81,0xff,
-    0x73,0x73,0x73,0xff,0x63,0x63,0x63,0xff,0x52,0x52,0x52,0xff,0x42,0x42,0x42,0xff,0x33,0x33,0x33,0xff,
-    0x26,0x26,0x26,0xff,0x1b,0x1b,0x1b,0xff,0x13,0x13,0x13,0xff,0x0d,0x0d,0x0d,0xff,0x09,0x09,0x09,0xff,
-    0x07,0x07,0x07,0xff,0x05,0x05,0x05,0xff,0x04,0x04,0x04,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,
-    0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x0b,0x0b,0x0b,0xff,
-    0x1b,0x1b,0x1b,0xff,0x2b,0x2b,0x2b,0xff,0x3c,0x3c,0x3c,0xff,0x4c,0x4c,0x4c,0xff,0x5c,0x5c,0x5c,0xff,
-    0x6c,0x6c,0x6c,0xff,0x7b,0x7b,0x7b,0xff,0x8a,0x8a,0x8a,0xff,0x99,0x99,0x99,0xff,0xa7,0xa7,0xa7,0xff,
-    0xb3,0xb3,0xb3,0xff,0xbd,0xbd,0xbd,0xff,0xc3,0xc3,0xc3,0xff,0xc6,0xc6,0xc6,0xff,0xc3,0xc3,0xc3,0xff,
-    0xbc,0xbc,0xbc,0xff,0xb2,0xb2,0xb2,0xff,0xa6,0xa6,0xa6,0xff,0x98,0x98,0x98,0xff,0x89,0x89,0x89,0xff,
-    0x7a,0x7a,0x7a,0xff,0x6a,0x6a,0x6a,0xff,0x5a,0x5a,0x5a,0xff,0x4a,0x4a,0x4a,0xff,0x39,0x39,0x39,0xff,
-    0x29,0x29,0x29,0xff,0x19,0x19,0x19,0xff,0x08,0x08,0x08,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x06,0x06,0x06,0xff,0x0b,0x0b,0x0b,0xff,0x12,0x12,0x12,0xff,
-    0x1c,0x1c,0x1c,0xff,0x29,0x29,0x29,0xff,0x39,0x39,0x39,0xff,0x4b,0x4b,0x4b,0xff,0x5e,0x5e,0x5e,0xff,
-    0x6e,0x6e,0x6e,0xff,0x7a,0x7a,0x7a,0xff,0x7f,0x7f,0x7f,0xff,0x7b,0x7b,0x7b,0xff,0x6c,0x6c,0x6c,0xff,
-    0x55,0x55,0x55,0xff,0x3b,0x3b,0x3b,0xff,0x41,0x41,0x41,0xb9,0xd7,0xd7,0xd7,0x17,0xff,0xff,0xff,0x06,
-    0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x04,0xfe,0xfe,0xfe,0x0a,0x8a,0x8a,0x8a,0x3d,0x2d,0x2d,0x2d,0xef,0x3e,0x3e,0x3e,0xff,
-    0x57,0x57,0x57,0xff,0x6e,0x6e,0x6e,0xff,0x80,0x80,0x80,0xff,0x8a,0x8a,0x8a,0xff,0x8b,0x8b,0x8b,0xff,
-    0x86,0x86,0x86,0xff,0x7b,0x7b,0x7b,0xff,0x6c,0x6c,0x6c,0xff,0x5b,0x5b,0x5b,0xff,0x4a,0x4a,0x4a,0xff,
-    0x39,0x39,0x39,0xff,0x2b,0x2b,0x2b,0xff,0x1e,0x1e,0x1e,0xff,0x15,0x15,0x15,0xff,0x0d,0x0d,0x0d,0xff,
-    0x08,0x08,0x08,0xff,0x05,0x05,0x05,0xff,0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x0e,0x0e,0x0e,0xff,0x1e,0x1e,0x1e,0xff,0x2f,0x2f,0x2f,0xff,
-    0x40,0x40,0x40,0xff,0x51,0x51,0x51,0xff,0x63,0x63,0x63,0xff,0x76,0x76,0x76,0xff,0x8a,0x8a,0x8a,0xff,
-    0x9d,0x9d,0x9d,0xff,0xaf,0xaf,0xaf,0xff,0xbf,0xbf,0xbf,0xff,0xcd,0xcd,0xcd,0xff,0xd8,0xd8,0xd8,0xff,
-    0xde,0xde,0xde,0xff,0xe1,0xe1,0xe1,0xff,0xdf,0xdf,0xdf,0xff,0xd9,0xd9,0xd9,0xff,0xd0,0xd0,0xd0,0xff,
-    0xc5,0xc5,0xc5,0xff,0xb7,0xb7,0xb7,0xff,0xa7,0xa7,0xa7,0xff,0x95,0x95,0x95,0xff,0x80,0x80,0x80,0xff,
-    0x6b,0x6b,0x6b,0xff,0x56,0x56,0x56,0xff,0x41,0x41,0x41,0xff,0x2e,0x2e,0x2e,0xff,0x1d,0x1d,0x1d,0xff,
-    0x0b,0x0b,0x0b,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x06,0x06,0x06,0xff,0x0c,0x0c,0x0c,0xff,0x15,0x15,0x15,0xff,
-    0x21,0x21,0x21,0xff,0x31,0x31,0x31,0xff,0x43,0x43,0x43,0xff,0x57,0x57,0x57,0xff,0x68,0x68,0x68,0xff,
-    0x75,0x75,0x75,0xff,0x7a,0x7a,0x7a,0xff,0x74,0x74,0x74,0xff,0x63,0x63,0x63,0xff,0x4b,0x4b,0x4b,0xff,
-    0x33,0x33,0x33,0xfa,0x6d,0x6d,0x6d,0x62,0xfb,0xfb,0xfb,0x0c,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x06,0xe0,0xe0,0xe0,0x13,
-    0x41,0x41,0x41,0xae,0x33,0x33,0x33,0xff,0x4b,0x4b,0x4b,0xff,0x63,0x63,0x63,0xff,0x77,0x77,0x77,0xff,
-    0x82,0x82,0x82,0xff,0x86,0x86,0x86,0xff,0x80,0x80,0x80,0xff,0x75,0x75,0x75,0xff,0x65,0x65,0x65,0xff,
-    0x54,0x54,0x54,0xff,0x42,0x42,0x42,0xff,0x32,0x32,0x32,0xff,0x24,0x24,0x24,0xff,0x18,0x18,0x18,0xff,
-    0x10,0x10,0x10,0xff,0x09,0x09,0x09,0xff,0x05,0x05,0x05,0xff,0x03,0x03,0x03,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x02,0x02,0x02,0xff,
-    0x10,0x10,0x10,0xff,0x23,0x23,0x23,0xff,0x39,0x39,0x39,0xff,0x55,0x55,0x55,0xff,0x74,0x74,0x74,0xff,
-    0x93,0x93,0x93,0xff,0xaf,0xaf,0xaf,0xff,0xc6,0xc6,0xc6,0xff,0xd8,0xd8,0xd8,0xff,0xe5,0xe5,0xe5,0xff,
-    0xee,0xee,0xee,0xff,0xf3,0xf3,0xf3,0xff,0xf7,0xf7,0xf7,0xff,0xfa,0xfa,0xfa,0xff,0xfa,0xfa,0xfa,0xff,
-    0xfa,0xfa,0xfa,0xff,0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xf3,0xf3,0xf3,0xff,0xee,0xee,0xee,0xff,
-    0xe7,0xe7,0xe7,0xff,0xdd,0xdd,0xdd,0xff,0xce,0xce,0xce,0xff,0xbb,0xbb,0xbb,0xff,0xa1,0xa1,0xa1,0xff,
-    0x82,0x82,0x82,0xff,0x5f,0x5f,0x5f,0xff,0x3b,0x3b,0x3b,0xff,0x1c,0x1c,0x1c,0xff,0x04,0x04,0x04,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x04,0x04,0x04,0xff,0x08,0x08,0x08,0xff,0x10,0x10,0x10,0xff,0x1b,0x1b,0x1b,0xff,
-    0x2a,0x2a,0x2a,0xff,0x3d,0x3d,0x3d,0xff,0x51,0x51,0x51,0xff,0x63,0x63,0x63,0xff,0x70,0x70,0x70,0xff,
-    0x74,0x74,0x74,0xff,0x6b,0x6b,0x6b,0xff,0x59,0x59,0x59,0xff,0x40,0x40,0x40,0xff,0x39,0x39,0x39,0xd2,
-    0xc7,0xc7,0xc7,0x1d,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x02,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x01,
-    0xff,0xff,0xff,0x04,0xfe,0xfe,0xfe,0x09,0x79,0x79,0x79,0x4a,0x2b,0x2b,0x2b,0xf7,0x3e,0x3e,0x3e,0xff,
-    0x56,0x56,0x56,0xff,0x6b,0x6b,0x6b,0xff,0x7a,0x7a,0x7a,0xff,0x7e,0x7e,0x7e,0xff,0x7a,0x7a,0x7a,0xff,
-    0x6f,0x6f,0x6f,0xff,0x5f,0x5f,0x5f,0xff,0x4d,0x4d,0x4d,0xff,0x3c,0x3c,0x3c,0xff,0x2c,0x2c,0x2c,0xff,
-    0x1e,0x1e,0x1e,0xff,0x14,0x14,0x14,0xff,0x0c,0x0c,0x0c,0xff,0x07,0x07,0x07,0xff,0x03,0x03,0x03,0xff,
-    0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x08,0x08,0x08,0xff,0x29,0x29,0x29,0xff,0x55,0x55,0x55,0xff,
-    0x84,0x84,0x84,0xff,0xaf,0xaf,0xaf,0xff,0xce,0xce,0xce,0xff,0xe3,0xe3,0xe3,0xff,0xef,0xef,0xef,0xff,
-    0xf5,0xf5,0xf5,0xff,0xf8,0xf8,0xf8,0xff,0xf9,0xf9,0xf8,0xff,0xfa,0xf9,0xf8,0xff,0xfa,0xf8,0xf7,0xff,
-    0xfa,0xf9,0xf7,0xff,0xfa,0xf8,0xf7,0xff,0xfa,0xf9,0xf7,0xff,0xfa,0xf9,0xf7,0xff,0xfa,0xf9,0xf8,0xff,
-    0xfa,0xf9,0xf8,0xff,0xfb,0xfa,0xf9,0xff,0xfb,0xfb,0xfa,0xff,0xfb,0xfb,0xfb,0xff,0xfb,0xfb,0xfb,0xff,
-    0xf9,0xf9,0xf9,0xff,0xf6,0xf6,0xf6,0xff,0xef,0xef,0xef,0xff,0xe2,0xe2,0xe2,0xff,0xcc,0xcc,0xcc,0xff,
-    0xaa,0xaa,0xaa,0xff,0x7d,0x7d,0x7d,0xff,0x4b,0x4b,0x4b,0xff,0x23,0x23,0x23,0xff,0x09,0x09,0x09,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x03,0x03,0x03,0xff,0x06,0x06,0x06,0xff,0x0d,0x0d,0x0d,0xff,0x17,0x17,0x17,0xff,0x26,0x26,0x26,0xff,
-    0x38,0x38,0x38,0xff,0x4c,0x4c,0x4c,0xff,0x5e,0x5e,0x5e,0xff,0x6b,0x6b,0x6b,0xff,0x6c,0x6c,0x6c,0xff,
-    0x61,0x61,0x61,0xff,0x4c,0x4c,0x4c,0xff,0x34,0x34,0x34,0xfb,0x67,0x67,0x67,0x6c,0xfb,0xfb,0xfb,0x0c,
-    0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x01,0xff,0xff,0xff,0x02,0xff,0xff,0xff,0x05,0xde,0xde,0xde,0x12,
-    0x3d,0x3d,0x3d,0xb2,0x31,0x31,0x31,0xff,0x48,0x48,0x48,0xff,0x5e,0x5e,0x5e,0xff,0x6e,0x6e,0x6e,0xff,
-    0x75,0x75,0x75,0xff,0x73,0x73,0x73,0xff,0x68,0x68,0x68,0xff,0x59,0x59,0x59,0xff,0x47,0x47,0x47,0xff,
-    0x36,0x36,0x36,0xff,0x26,0x26,0x26,0xff,0x19,0x19,0x19,0xff,0x10,0x10,0x10,0xff,0x09,0x09,0x09,0xff,
-    0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x04,0x04,0x04,0xff,0x1f,0x1f,0x1f,0xff,
-    0x50,0x50,0x50,0xff,0x8d,0x8d,0x8d,0xff,0xbe,0xbe,0xbe,0xff,0xdc,0xdc,0xdc,0xff,0xea,0xea,0xea,0xff,
-    0xef,0xef,0xee,0xff,0xf0,0xee,0xec,0xff,0xef,0xe5,0xdd,0xff,0xec,0xd8,0xc6,0xff,0xe9,0xcd,0xb1,0xff,
-    0xe7,0xc4,0x9d,0xff,0xe5,0xbe,0x8b,0xff,0xe4,0xb9,0x79,0xff,0xe3,0xb8,0x71,0xff,0xe2,0xb7,0x64,0xff,
-    0xe2,0xb9,0x62,0xff,0xe3,0xbb,0x6a,0xff,0xe4,0xbc,0x77,0xff,0xe5,0xbf,0x80,0xff,0xe6,0xc4,0x93,0xff,
-    0xe8,0xc9,0xa4,0xff,0xea,0xd1,0xb6,0xff,0xed,0xdb,0xca,0xff,0xf0,0xe7,0xdf,0xff,0xf3,0xf0,0xee,0xff,
-    0xf4,0xf3,0xf2,0xff,0xf5,0xf5,0xf5,0xff,0xf4,0xf4,0xf4,0xff,0xef,0xef,0xef,0xff,0xe1,0xe1,0xe1,0xff,
-    0xc4,0xc4,0xc4,0xff,0x96,0x96,0x96,0xff,0x5d,0x5d,0x5d,0xff,0x28,0x28,0x28,0xff,0x07,0x07,0x07,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,
-    0x05,0x05,0x05,0xff,0x0a,0x0a,0x0a,0xff,0x14,0x14,0x14,0xff,0x22,0x22,0x22,0xff,0x34,0x34,0x34,0xff,
-    0x48,0x48,0x48,0xff,0x5a,0x5a,0x5a,0xff,0x64,0x64,0x64,0xff,0x62,0x62,0x62,0xff,0x54,0x54,0x54,0xff,
-    0x3e,0x3e,0x3e,0xff,0x3b,0x3b,0x3b,0xce,0xd3,0xd3,0xd3,0x1a,0xff,0xff,0xff,0x07,0xff,0xff,0xff,0x02,
-    0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x08,0x80,0x80,0x80,0x3e,0x27,0x27,0x27,0xf5,0x38,0x38,0x38,0xff,
-    0x4d,0x4d,0x4d,0xff,0x5f,0x5f,0x5f,0xff,0x69,0x69,0x69,0xff,0x6a,0x6a,0x6a,0xff,0x61,0x61,0x61,0xff,
-    0x53,0x53,0x53,0xff,0x41,0x41,0x41,0xff,0x30,0x30,0x30,0xff,0x21,0x21,0x21,0xff,0x16,0x16,0x16,0xff,
-    0x0d,0x0d,0x0d,0xff,0x07,0x07,0x07,0xff,0x04,0x04,0x04,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x10,0x10,0x10,0xff,0x41,0x41,0x41,0xff,0x83,0x83,0x83,0xff,0xba,0xba,0xba,0xff,0xd9,0xd9,0xd9,0xff,
-    0xe4,0xe4,0xe4,0xff,0xe6,0xe3,0xe1,0xff,0xe4,0xd0,0xc2,0xff,0xe2,0xb7,0x95,0xff,0xe0,0x9f,0x59,0xff,
-    0xdf,0x96,0x2c,0xff,0xde,0x97,0x1a,0xff,0xde,0x99,0x06,0xff,0xde,0x9c,0x00,0xff,0xde,0xa0,0x02,0xff,
-    0xe1,0xab,0x23,0xff,0xe5,0xb8,0x3f,0xff,0xe8,0xc3,0x53,0xff,0xea,0xcb,0x61,0xff,0xec,0xcf,0x6e,0xff,
-    0xed,0xd0,0x77,0xff,0xed,0xcf,0x7f,0xff,0xed,0xcd,0x82,0xff,0xec,0xc9,0x83,0xff,0xea,0xc3,0x7f,0xff,
-    0xe8,0xba,0x75,0xff,0xe4,0xad,0x63,0xff,0xe1,0xa6,0x61,0xff,0xe3,0xb6,0x8f,0xff,0xe6,0xcc,0xb9,0xff,
-    0xe9,0xe1,0xdd,0xff,0xea,0xe9,0xe9,0xff,0xeb,0xeb,0xeb,0xff,0xeb,0xeb,0xeb,0xff,0xe3,0xe3,0xe3,0xff,
-    0xc8,0xc8,0xc8,0xff,0x94,0x94,0x94,0xff,0x50,0x50,0x50,0xff,0x19,0x19,0x19,0xff,0x02,0x02,0x02,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x04,0x04,0x04,0xff,
-    0x09,0x09,0x09,0xff,0x12,0x12,0x12,0xff,0x1f,0x1f,0x1f,0xff,0x31,0x31,0x31,0xff,0x44,0x44,0x44,0xff,
-    0x54,0x54,0x54,0xff,0x5b,0x5b,0x5b,0xff,0x56,0x56,0x56,0xff,0x46,0x46,0x46,0xff,0x32,0x32,0x32,0xf9,
-    0x78,0x78,0x78,0x57,0xfe,0xfe,0xfe,0x0b,0xff,0xff,0xff,0x04,0xff,0xff,0xff,0x04,0xea,0xea,0xea,0x0c,
-    0x42,0x42,0x42,0x96,0x28,0x28,0x28,0xfe,0x3c,0x3c,0x3c,0xff,0x4e,0x4e,0x4e,0xff,0x5b,0x5b,0x5b,0xff,
-    0x5e,0x5e,0x5e,0xff,0x58,0x58,0x58,0xff,0x4c,0x4c,0x4c,0xff,0x3c,0x3c,0x3c,0xff,0x2c,0x2c,0x2c,0xff,
-    0x1d,0x1d,0x1d,0xff,0x12,0x12,0x12,0xff,0x0a,0x0a,0x0a,0xff,0x06,0x06,0x06,0xff,0x03,0x03,0x03,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x1a,0x1a,0x1a,0xff,0x5c,0x5c,0x5c,0xff,0xa3,0xa3,0xa3,0xff,
-    0xcd,0xcd,0xcd,0xff,0xd9,0xd9,0xd9,0xff,0xda,0xd9,0xd8,0xff,0xdc,0xc3,0xb4,0xff,0xde,0x9a,0x63,0xff,
-    0xde,0x8a,0x1f,0xff,0xde,0x8b,0x01,0xff,0xde,0x8e,0x00,0xff,0xde,0x92,0x00,0xff,0xde,0x95,0x00,0xff,
-    0xde,0x98,0x00,0xff,0xde,0x9b,0x00,0xff,0xde,0x9f,0x00,0xff,0xde,0xa2,0x02,0xff,0xde,0xa5,0x08,0xff,
-    0xdf,0xab,0x1b,0xff,0xe2,0xb3,0x32,0xff,0xe5,0xbb,0x48,0xff,0xe9,0xc3,0x5d,0xff,0xec,0xcb,0x71,0xff,
-    0xee,0xcf,0x7f,0xff,0xf0,0xd3,0x8c,0xff,0xf1,0xd6,0x99,0xff,0xf3,0xda,0xa4,0xff,0xf4,0xdd,0xaf,0xff,
-    0xf4,0xdc,0xb3,0xff,0xf0,0xcf,0xa5,0xff,0xea,0xba,0x89,0xff,0xe2,0xa1,0x63,0xff,0xdf,0xb0,0x91,0xff,
-    0xde,0xd2,0xca,0xff,0xdf,0xde,0xde,0xff,0xe1,0xe1,0xe1,0xff,0xe1,0xe1,0xe1,0xff,0xd8,0xd8,0xd8,0xff,
-    0xb5,0xb5,0xb5,0xff,0x6f,0x6f,0x6f,0xff,0x26,0x26,0x26,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x03,0x03,0x03,0xff,0x07,0x07,0x07,0xff,
-    0x10,0x10,0x10,0xff,0x1d,0x1d,0x1d,0xff,0x2f,0x2f,0x2f,0xff,0x40,0x40,0x40,0xff,0x4e,0x4e,0x4e,0xff,
-    0x51,0x51,0x51,0xff,0x48,0x48,0x48,0xff,0x36,0x36,0x36,0xff,0x48,0x48,0x48,0xac,0xe9,0xe9,0xe9,0x13,
-    0xff,0xff,0xff,0x06,0xff,0xff,0xff,0x05,0xa7,0xa7,0xa7,0x1c,0x23,0x23,0x23,0xe4,0x2a,0x2a,0x2a,0xff,
-    0x3b,0x3b,0x3b,0xff,0x49,0x49,0x49,0xff,0x50,0x50,0x50,0xff,0x4e,0x4e,0x4e,0xff,0x44,0x44,0x44,0xff,
-    0x36,0x36,0x36,0xff,0x27,0x27,0x27,0xff,0x1a,0x1a,0x1a,0xff,0x10,0x10,0x10,0xff,0x09,0x09,0x09,0xff,
-    0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x18,0x18,0x18,0xff,
-    0x63,0x63,0x63,0xff,0xad,0xad,0xad,0xff,0xcc,0xcc,0xcc,0xff,0xd0,0xd0,0xd0,0xff,0xcf,0xcd,0xcc,0xff,
-    0xd8,0xa8,0x8e,0xff,0xde,0x83,0x22,0xff,0xde,0x83,0x01,0xff,0xde,0x87,0x00,0xff,0xde,0x8a,0x00,0xff,
-    0xde,0x8d,0x00,0xff,0xde,0x90,0x00,0xff,0xde,0x93,0x00,0xff,0xde,0x96,0x00,0xff,0xde,0x99,0x00,0xff,
-    0xde,0x9c,0x00,0xff,0xde,0x9e,0x00,0xff,0xde,0xa0,0x00,0xff,0xde,0xa1,0x00,0xff,0xde,0xa2,0x00,0xff,
-    0xde,0xa2,0x02,0xff,0xde,0xa1,0x09,0xff,0xdf,0xa3,0x1d,0xff,0xe3,0xac,0x3e,0xff,0xe7,0xb8,0x5c,0xff,
-    0xec,0xc5,0x76,0xff,0xef,0xcc,0x87,0xff,0xf1,0xd1,0x95,0xff,0xf3,0xd5,0xa1,0xff,0xf5,0xda,0xae,0xff,
-    0xf6,0xde,0xb9,0xff,0xf6,0xdf,0xbe,0xff,0xef,0xc9,0xa5,0xff,0xe3,0xa1,0x6e,0xff,0xd8,0xb5,0xa4,0xff,
-    0xd2,0xd1,0xd1,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,0xd5,0xd5,0xd5,0xff,0xbd,0xbd,0xbd,0xff,
-    0x78,0x78,0x78,0xff,0x25,0x25,0x25,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x07,0x07,0x07,0xff,0x0f,0x0f,0x0f,0xff,
-    0x1c,0x1c,0x1c,0xff,0x2c,0x2c,0x2c,0xff,0x3c,0x3c,0x3c,0xff,0x45,0x45,0x45,0xff,0x44,0x44,0x44,0xff,
-    0x38,0x38,0x38,0xff,0x2e,0x2e,0x2e,0xed,0xac,0xac,0xac,0x2a,0xff,0xff,0xff,0x09,0xfe,0xfe,0xfe,0x05,
-    0x51,0x51,0x51,0x59,0x1a,0x1a,0x1a,0xfb,0x28,0x28,0x28,0xff,0x35,0x35,0x35,0xff,0x3e,0x3e,0x3e,0xff,
-    0x40,0x40,0x40,0xff,0x3b,0x3b,0x3b,0xff,0x30,0x30,0x30,0xff,0x23,0x23,0x23,0xff,0x17,0x17,0x17,0xff,
-    0x0e,0x0e,0x0e,0xff,0x07,0x07,0x07,0xff,0x03,0x03,0x03,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x0a,0x0a,0x0a,0xff,0x51,0x51,0x51,0xff,0xa4,0xa4,0xa4,0xff,0xc3,0xc3,0xc3,0xff,
-    0xc4,0xc4,0xc4,0xff,0xc2,0xc2,0xc2,0xff,0xcd,0xaa,0x99,0xff,0xde,0x81,0x24,0xff,0xdf,0x81,0x11,0xff,
-    0xde,0x82,0x01,0xff,0xde,0x85,0x01,0xff,0xde,0x88,0x00,0xff,0xdd,0x8a,0x00,0xff,0xd6,0x89,0x00,0xff,
-    0xc0,0x7d,0x00,0xff,0xb0,0x75,0x00,0xff,0xad,0x75,0x00,0xff,0xb5,0x7c,0x00,0xff,0xc7,0x8a,0x00,0xff,
-    0xda,0x98,0x00,0xff,0xde,0x9b,0x00,0xff,0xde,0x9c,0x00,0xff,0xde,0x9b,0x00,0xff,0xde,0x9a,0x00,0xff,
-    0xd5,0x93,0x00,0xff,0xba,0x7f,0x00,0xff,0xa9,0x73,0x05,0xff,0xa6,0x74,0x1c,0xff,0xb5,0x8e,0x48,0xff,
-    0xcb,0xa6,0x63,0xff,0xe5,0xbe,0x7e,0xff,0xf0,0xcb,0x90,0xff,0xf2,0xd0,0x9d,0xff,0xf4,0xd5,0xa9,0xff,
-    0xf5,0xda,0xb6,0xff,0xf6,0xda,0xba,0xff,0xe7,0xaa,0x7e,0xff,0xcf,0xb0,0xa2,0xff,0xc6,0xc6,0xc6,0xff,
-    0xc9,0xc9,0xc9,0xff,0xcc,0xcc,0xcc,0xff,0xcc,0xcc,0xcc,0xff,0xb6,0xb6,0xb6,0xff,0x67,0x67,0x67,0xff,
-    0x14,0x14,0x14,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,0x0e,0x0e,0x0e,0xff,0x1b,0x1b,0x1b,0xff,
-    0x29,0x29,0x29,0xff,0x35,0x35,0x35,0xff,0x3a,0x3a,0x3a,0xff,0x34,0x34,0x34,0xff,0x29,0x29,0x29,0xfc,
-    0x62,0x62,0x62,0x6a,0xfe,0xfe,0xfe,0x0b,0xd2,0xd2,0xd2,0x08,0x2a,0x2a,0x2a,0xa0,0x17,0x17,0x17,0xff,
-    0x21,0x21,0x21,0xff,0x2b,0x2b,0x2b,0xff,0x30,0x30,0x30,0xff,0x2f,0x2f,0x2f,0xff,0x28,0x28,0x28,0xff,
-    0x1e,0x1e,0x1e,0xff,0x14,0x14,0x14,0xff,0x0c,0x0c,0x0c,0xff,0x06,0x06,0x06,0xff,0x03,0x03,0x03,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x20,0x20,0x20,0xff,0x04,0x04,0x04,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x28,0x28,0x28,0xff,
-    0x86,0x86,0x86,0xff,0xb6,0xb6,0xb6,0xff,0xb9,0xb9,0xb9,0xff,0xb7,0xb7,0xb7,0xff,0xb5,0xb3,0xb2,0xff,
-    0xd5,0x8c,0x5f,0xff,0xe8,0xa6,0x5f,0xff,0xe9,0xa8,0x5e,0xff,0xe1,0x8e,0x34,0xff,0xde,0x83,0x0a,0xff,
-    0xdc,0x83,0x01,0xff,0xaa,0x67,0x00,0xff,0x53,0x32,0x00,0xff,0x35,0x23,0x00,0xff,0x41,0x2d,0x00,0xff,
-    0x54,0x3a,0x00,0xff,0x67,0x47,0x00,0xff,0x6c,0x4b,0x00,0xff,0x80,0x57,0x00,0xff,0xc7,0x86,0x00,0xff,
-    0xde,0x95,0x00,0xff,0xde,0x95,0x00,0xff,0xc1,0x81,0x00,0xff,0x5a,0x3c,0x00,0xff,0x35,0x24,0x00,0xff,
-    0x42,0x2e,0x00,0xff,0x55,0x3b,0x00,0xff,0x6a,0x49,0x00,0xff,0x7d,0x57,0x06,0xff,0x88,0x63,0x1f,0xff,
-    0xc4,0x9a,0x5d,0xff,0xee,0xbf,0x7f,0xff,0xf0,0xc5,0x8c,0xff,0xf2,0xca,0x98,0xff,0xf4,0xcf,0xa5,0xff,
-    0xf2,0xca,0xa3,0xff,0xd5,0x8e,0x69,0xff,0xb9,0xb7,0xb6,0xff,0xbb,0xbb,0xbb,0xff,0xbe,0xbe,0xbe,0xff,
-    0xc1,0xc1,0xc1,0xff,0xc0,0xc0,0xc0,0xff,0x9b,0x9b,0x9b,0xff,0x3a,0x3a,0x3a,0xff,0x02,0x02,0x02,0xff,
-    0x00,0x00,0x00,0xff,0x02,0x02,0x02,0xff,0x14,0x14,0x14,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,0x0e,0x0e,0x0e,0xff,0x19,0x19,0x19,0xff,0x25,0x25,0x25,0xff,
-    0x2c,0x2c,0x2c,0xff,0x2c,0x2c,0x2c,0xff,0x24,0x24,0x24,0xff,0x3c,0x3c,0x3c,0xab,0xe5,0xe5,0xe5,0x10,
-    0x8d,0x8d,0x8d,0x10,0x12,0x12,0x12,0xdf,0x12,0x12,0x12,0xff,0x19,0x19,0x19,0xff,0x1f,0x1f,0x1f,0xff,
-    0x21,0x21,0x21,0xff,0x1e,0x1e,0x1e,0xff,0x18,0x18,0x18,0xff,0x11,0x11,0x11,0xff,0x0a,0x0a,0x0a,0xff,
-    0x05,0x05,0x05,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x34,0x34,0x34,0xff,0x8f,0x8f,0x8f,0xff,0x18,0x18,0x18,0xff,
-    0x00,0x00,0x00,0xff,0x04,0x04,0x04,0xff,0x44,0x44,0x44,0xff,0x9b,0x9b,0x9b,0xff,0xaf,0xaf,0xaf,0xff,
-    0xac,0xac,0xac,0xff,0xa9,0xa9,0xa9,0xff,0xa8,0xa5,0xa4,0xff,0xd5,0x88,0x55,0xff,0xeb,0xaf,0x6b,0xff,
-    0xec,0xb2,0x6e,0xff,0xec,0xb2,0x6c,0xff,0xe8,0xa6,0x59,0xff,0xc7,0x80,0x32,0xff,0x2a,0x16,0x02,0xff,
-    0x06,0x04,0x00,0xff,0x1a,0x12,0x00,0xff,0x2e,0x20,0x00,0xff,0x3f,0x2c,0x00,0xff,0x4e,0x36,0x00,0xff,
-    0x55,0x3b,0x00,0xff,0x52,0x39,0x00,0xff,0x80,0x53,0x00,0xff,0xdc,0x8e,0x00,0xff,0xdc,0x8d,0x00,0xff,
-    0x7b,0x4d,0x00,0xff,0x0e,0x09,0x00,0xff,0x21,0x17,0x00,0xff,0x34,0x24,0x00,0xff,0x47,0x31,0x00,0xff,
-    0x58,0x3d,0x00,0xff,0x66,0x47,0x00,0xff,0x6a,0x49,0x00,0xff,0x70,0x50,0x14,0xff,0xe1,0xa6,0x5e,0xff,
-    0xec,0xb4,0x6f,0xff,0xee,0xb9,0x7b,0xff,0xef,0xbe,0x87,0xff,0xeb,0xaf,0x7b,0xff,0xd1,0x84,0x5b,0xff,
-    0xab,0xa9,0xa8,0xff,0xad,0xad,0xad,0xff,0xb0,0xb0,0xb0,0xff,0xb3,0xb3,0xb3,0xff,0xb6,0xb6,0xb6,0xff,
-    0xab,0xab,0xab,0xff,0x5b,0x5b,0x5b,0xff,0x0a,0x0a,0x0a,0xff,0x00,0x00,0x00,0xff,0x19,0x19,0x19,0xff,
-    0x8a,0x8a,0x8a,0xff,0x31,0x31,0x31,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,
-    0x06,0x06,0x06,0xff,0x0e,0x0e,0x0e,0xff,0x16,0x16,0x16,0xff,0x1d,0x1d,0x1d,0xff,0x20,0x20,0x20,0xff,
-    0x1d,0x1d,0x1d,0xff,0x1f,0x1f,0x1f,0xe2,0xb5,0xb5,0xb5,0x17,0x3d,0x3d,0x3d,0x36,0x08,0x08,0x08,0xf8,
-    0x0c,0x0c,0x0c,0xff,0x11,0x11,0x11,0xff,0x13,0x13,0x13,0xff,0x14,0x14,0x14,0xff,0x11,0x11,0x11,0xff,
-    0x0d,0x0d,0x0d,0xff,0x08,0x08,0x08,0xff,0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x19,0x19,0x19,0xff,
-    0xa5,0xa5,0xa5,0xff,0xa9,0xa9,0xa9,0xff,0x0c,0x0c,0x0c,0xff,0x00,0x00,0x00,0xff,0x06,0x06,0x06,0xff,
-    0x4f,0x4f,0x4f,0xff,0x9a,0x9a,0x9a,0xff,0xa3,0xa3,0xa3,0xff,0x9f,0x9f,0x9f,0xff,0x9c,0x9c,0x9c,0xff,
-    0x9a,0x99,0x99,0xff,0xbb,0x88,0x70,0xff,0xe5,0x99,0x55,0xff,0xec,0xb0,0x6d,0xff,0xec,0xb2,0x6e,0xff,
-    0xec,0xb3,0x6e,0xff,0xe1,0xab,0x68,0xff,0x73,0x56,0x32,0xff,0x1a,0x11,0x07,0xff,0x08,0x05,0x00,0xff,
-    0x18,0x11,0x00,0xff,0x28,0x1c,0x00,0xff,0x34,0x24,0x00,0xff,0x3c,0x29,0x00,0xff,0x4a,0x30,0x00,0xff,
-    0xa8,0x67,0x00,0xff,0xdd,0x88,0x00,0xff,0xdd,0x88,0x00,0xff,0x9e,0x5f,0x00,0xff,0x1c,0x0d,0x00,0xff,
-    0x11,0x0b,0x00,0xff,0x22,0x18,0x00,0xff,0x33,0x23,0x00,0xff,0x41,0x2d,0x00,0xff,0x4c,0x34,0x00,0xff,
-    0x52,0x38,0x00,0xff,0x86,0x4e,0x01,0xff,0xde,0x85,0x2b,0xff,0xe8,0xa0,0x51,0xff,0xea,0xa5,0x5d,0xff,
-    0xe7,0x9b,0x58,0xff,0xde,0x77,0x29,0xff,0xb9,0x89,0x77,0xff,0x9d,0x9c,0x9c,0xff,0x9f,0x9f,0x9f,0xff,
-    0xa3,0xa3,0xa3,0xff,0xa6,0xa6,0xa6,0xff,0xaa,0xaa,0xaa,0xff,0xa7,0xa7,0xa7,0xff,0x66,0x66,0x66,0xff,
-    0x0f,0x0f,0x0f,0xff,0x00,0x00,0x00,0xff,0x0a,0x0a,0x0a,0xff,0xa8,0xa8,0xa8,0xff,0xae,0xae,0xae,0xff,
-    0x25,0x25,0x25,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x06,0x06,0x06,0xff,
-    0x0c,0x0c,0x0c,0xff,0x11,0x11,0x11,0xff,0x15,0x15,0x15,0xff,0x14,0x14,0x14,0xff,0x12,0x12,0x12,0xf8,
-    0x5f,0x5f,0x5f,0x39,0x1a,0x1a,0x1a,0x68,0x04,0x04,0x04,0xfd,0x07,0x07,0x07,0xff,0x09,0x09,0x09,0xff,
-    0x0a,0x0a,0x0a,0xff,0x0a,0x0a,0x0a,0xff,0x08,0x08,0x08,0xff,0x06,0x06,0x06,0xff,0x03,0x03,0x03,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x04,0x04,0x04,0xff,0x7e,0x7e,0x7e,0xff,0xd8,0xd8,0xd8,0xff,0xa5,0xa5,0xa5,0xff,
-    0x09,0x09,0x09,0xff,0x00,0x00,0x00,0xff,0x04,0x04,0x04,0xff,0x45,0x45,0x45,0xff,0x8d,0x8d,0x8d,0xff,
-    0x97,0x97,0x97,0xff,0x94,0x94,0x94,0xff,0x91,0x91,0x91,0xff,0x8d,0x8d,0x8d,0xff,0x8e,0x89,0x87,0xff,
-    0xc0,0x7c,0x56,0xff,0xe3,0x94,0x50,0xff,0xeb,0xac,0x6a,0xff,0xec,0xb0,0x6e,0xff,0xec,0xb2,0x6e,0xff,
-    0xe5,0xad,0x6b,0xff,0xbf,0x91,0x58,0xff,0x99,0x73,0x45,0xff,0x82,0x60,0x37,0xff,0x76,0x48,0x15,0xff,
-    0x81,0x49,0x02,0xff,0x9e,0x5b,0x01,0xff,0xc5,0x73,0x01,0xff,0xdc,0x81,0x01,0xff,0xde,0x82,0x01,0xff,
-    0xde,0x82,0x01,0xff,0xda,0x7f,0x01,0xff,0xad,0x62,0x01,0xff,0x6b,0x39,0x00,0xff,0x37,0x1c,0x00,0xff,
-    0x34,0x1d,0x00,0xff,0x3f,0x25,0x00,0xff,0x65,0x38,0x00,0xff,0xa2,0x57,0x01,0xff,0xd5,0x71,0x01,0xff,
-    0xde,0x74,0x03,0xff,0xe1,0x7e,0x23,0xff,0xe0,0x7b,0x24,0xff,0xdd,0x6e,0x14,0xff,0xbe,0x77,0x58,0xff,
-    0x8f,0x8b,0x8a,0xff,0x8f,0x8f,0x8f,0xff,0x93,0x93,0x93,0xff,0x96,0x96,0x96,0xff,0x9a,0x9a,0x9a,0xff,
-    0x9e,0x9e,0x9e,0xff,0x99,0x99,0x99,0xff,0x5a,0x5a,0x5a,0xff,0x0b,0x0b,0x0b,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x99,0x99,0x99,0xff,0xdb,0xdb,0xdb,0xff,0x9d,0x9d,0x9d,0xff,0x18,0x18,0x18,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,0x08,0x08,0x08,0xff,
-    0x0b,0x0b,0x0b,0xff,0x0b,0x0b,0x0b,0xff,0x0a,0x0a,0x0a,0xfc,0x31,0x31,0x31,0x66,0x09,0x09,0x09,0x96,
-    0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x04,0x04,0x04,0xff,0x04,0x04,0x04,0xff,0x04,0x04,0x04,0xff,
-    0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x47,0x47,0x47,0xff,
-    0xc8,0xc8,0xc8,0xff,0xd8,0xd8,0xd8,0xff,0xaf,0xaf,0xaf,0xff,0x15,0x15,0x15,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x2c,0x2c,0x2c,0xff,0x75,0x75,0x75,0xff,0x8c,0x8c,0x8c,0xff,0x89,0x89,0x89,0xff,
-    0x85,0x85,0x85,0xff,0x82,0x82,0x82,0xff,0x7e,0x7e,0x7e,0xff,0x7e,0x7a,0x79,0xff,0xa3,0x74,0x5f,0xff,
-    0xd1,0x7e,0x42,0xff,0xe5,0x99,0x57,0xff,0xeb,0xab,0x69,0xff,0xec,0xaf,0x6d,0xff,0xec,0xb1,0x6e,0xff,
-    0xeb,0xb1,0x6d,0xff,0xea,0xb0,0x6d,0xff,0xe8,0xaa,0x64,0xff,0xe3,0x97,0x4a,0xff,0xdf,0x82,0x20,0xff,
-    0xde,0x7c,0x05,0xff,0xde,0x7c,0x01,0xff,0xde,0x7c,0x01,0xff,0xde,0x7c,0x01,0xff,0xde,0x7b,0x01,0xff,
-    0xde,0x7a,0x01,0xff,0xdb,0x78,0x01,0xff,0xd4,0x73,0x01,0xff,0xcf,0x6e,0x01,0xff,0xd2,0x6f,0x01,0xff,
-    0xda,0x72,0x01,0xff,0xdd,0x72,0x01,0xff,0xde,0x70,0x01,0xff,0xde,0x6e,0x01,0xff,0xdc,0x6c,0x09,0xff,
-    0xcf,0x6c,0x2f,0xff,0xa3,0x72,0x60,0xff,0x7f,0x7c,0x7b,0xff,0x7f,0x7f,0x7f,0xff,0x83,0x83,0x83,0xff,
-    0x87,0x87,0x87,0xff,0x8b,0x8b,0x8b,0xff,0x8f,0x8f,0x8f,0xff,0x92,0x92,0x92,0xff,0x83,0x83,0x83,0xff,
-    0x3d,0x3d,0x3d,0xff,0x04,0x04,0x04,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x98,0x98,0x98,0xff,
-    0xdb,0xdb,0xdb,0xff,0xd9,0xd9,0xd9,0xff,0x80,0x80,0x80,0xff,0x06,0x06,0x06,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x03,0x03,0x03,0xff,0x05,0x05,0x05,0xff,0x05,0x05,0x05,0xff,
-    0x05,0x05,0x05,0xff,0x17,0x17,0x17,0x8e,0x02,0x02,0x02,0xbd,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x15,0x15,0x15,0xff,0xa3,0xa3,0xa3,0xff,0xd4,0xd4,0xd4,0xff,0xd5,0xd5,0xd5,0xff,
-    0xc5,0xc5,0xc5,0xff,0x31,0x31,0x31,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x10,0x10,0x10,0xff,
-    0x4c,0x4c,0x4c,0xff,0x79,0x79,0x79,0xff,0x7f,0x7f,0x7f,0xff,0x7c,0x7c,0x7c,0xff,0x78,0x78,0x78,0xff,
-    0x74,0x74,0x74,0xff,0x70,0x70,0x70,0xff,0x6c,0x6c,0x6c,0xff,0x71,0x69,0x66,0xff,0x94,0x68,0x54,0xff,
-    0xb9,0x71,0x44,0xff,0xd6,0x88,0x4a,0xff,0xe4,0x9a,0x58,0xff,0xe9,0xa6,0x65,0xff,0xeb,0xad,0x6b,0xff,
-    0xec,0xae,0x6d,0xff,0xec,0xaf,0x6d,0xff,0xeb,0xab,0x68,0xff,0xe6,0x99,0x52,0xff,0xe1,0x82,0x2a,0xff,
-    0xde,0x76,0x03,0xff,0xde,0x75,0x01,0xff,0xde,0x75,0x01,0xff,0xde,0x74,0x01,0xff,0xde,0x73,0x01,0xff,
-    0xde,0x72,0x01,0xff,0xde,0x71,0x01,0xff,0xde,0x70,0x01,0xff,0xdd,0x6e,0x04,0xff,0xdb,0x6c,0x09,0xff,
-    0xd2,0x69,0x1c,0xff,0xb9,0x66,0x3a,0xff,0x96,0x66,0x53,0xff,0x71,0x69,0x66,0xff,0x6d,0x6d,0x6d,0xff,
-    0x70,0x70,0x70,0xff,0x74,0x74,0x74,0xff,0x78,0x78,0x78,0xff,0x7c,0x7c,0x7c,0xff,0x80,0x80,0x80,0xff,
-    0x84,0x84,0x84,0xff,0x81,0x81,0x81,0xff,0x5c,0x5c,0x5c,0xff,0x1a,0x1a,0x1a,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x0e,0x0e,0x0e,0xff,0xa5,0xa5,0xa5,0xff,0xd8,0xd8,0xd8,0xff,0xdd,0xdd,0xdd,0xff,
-    0xcd,0xcd,0xcd,0xff,0x5b,0x5b,0x5b,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x01,0x01,0x01,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x07,0x07,0x07,0xb1,
-    0x00,0x00,0x00,0xdb,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x62,0x62,0x62,0xff,
-    0xcc,0xcc,0xcc,0xff,0xd3,0xd3,0xd3,0xff,0xd3,0xd3,0xd3,0xff,0xd0,0xd0,0xd0,0xff,0x82,0x82,0x82,0xff,
-    0x04,0x04,0x04,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x1e,0x1e,0x1e,0xff,0x51,0x51,0x51,0xff,
-    0x6f,0x6f,0x6f,0xff,0x72,0x72,0x72,0xff,0x6e,0x6e,0x6e,0xff,0x6a,0x6a,0x6a,0xff,0x66,0x66,0x66,0xff,
-    0x61,0x61,0x61,0xff,0x5d,0x5d,0x5d,0xff,0x59,0x59,0x59,0xff,0x59,0x56,0x56,0xff,0x5c,0x53,0x50,0xff,
-    0x75,0x55,0x47,0xff,0x93,0x5c,0x3e,0xff,0xa9,0x67,0x3b,0xff,0xbb,0x74,0x40,0xff,0xc7,0x7e,0x43,0xff,
-    0xd0,0x84,0x46,0xff,0xd6,0x85,0x44,0xff,0xd9,0x81,0x39,0xff,0xd8,0x70,0x14,0xff,0xd8,0x6d,0x09,0xff,
-    0xd5,0x6b,0x0a,0xff,0xd1,0x69,0x0e,0xff,0xcc,0x67,0x15,0xff,0xc3,0x63,0x1c,0xff,0xb8,0x60,0x25,0xff,
-    0xa9,0x5b,0x2e,0xff,0x95,0x57,0x39,0xff,0x78,0x54,0x46,0xff,0x5e,0x53,0x50,0xff,0x59,0x56,0x55,0xff,
-    0x5a,0x5a,0x5a,0xff,0x5d,0x5d,0x5d,0xff,0x61,0x61,0x61,0xff,0x65,0x65,0x65,0xff,0x6a,0x6a,0x6a,0xff,
-    0x6e,0x6e,0x6e,0xff,0x72,0x72,0x72,0xff,0x76,0x76,0x76,0xff,0x75,0x75,0x75,0xff,0x5e,0x5e,0x5e,0xff,
-    0x29,0x29,0x29,0xff,0x03,0x03,0x03,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x2a,0x2a,0x2a,0xff,
-    0xbe,0xbe,0xbe,0xff,0xd5,0xd5,0xd5,0xff,0xdd,0xdd,0xdd,0xff,0xd8,0xd8,0xd8,0xff,0xb5,0xb5,0xb5,0xff,
-    0x2e,0x2e,0x2e,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xcc,0x00,0x00,0x00,0xef,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x1b,0x1b,0x1b,0xff,0xaa,0xaa,0xaa,0xff,0xcf,0xcf,0xcf,0xff,0xd5,0xd5,0xd5,0xff,
-    0xd5,0xd5,0xd5,0xff,0xcf,0xcf,0xcf,0xff,0xbf,0xbf,0xbf,0xff,0x51,0x51,0x51,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x03,0x03,0x03,0xff,0x1e,0x1e,0x1e,0xff,0x46,0x46,0x46,0xff,0x5f,0x5f,0x5f,0xff,
-    0x64,0x64,0x64,0xff,0x61,0x61,0x61,0xff,0x5d,0x5d,0x5d,0xff,0x58,0x58,0x58,0xff,0x54,0x54,0x54,0xff,
-    0x4f,0x4f,0x4f,0xff,0x4b,0x4b,0x4b,0xff,0x48,0x48,0x48,0xff,0x44,0x44,0x44,0xff,0x40,0x40,0x40,0xff,
-    0x3e,0x3d,0x3d,0xff,0x3f,0x3b,0x39,0xff,0x41,0x39,0x36,0xff,0x42,0x37,0x34,0xff,0x43,0x36,0x32,0xff,
-    0x44,0x35,0x30,0xff,0x45,0x35,0x30,0xff,0x45,0x35,0x30,0xff,0x44,0x35,0x30,0xff,0x43,0x36,0x31,0xff,
-    0x42,0x36,0x33,0xff,0x40,0x38,0x35,0xff,0x3f,0x3a,0x39,0xff,0x3d,0x3c,0x3c,0xff,0x3f,0x3f,0x3f,0xff,
-    0x42,0x42,0x42,0xff,0x46,0x46,0x46,0xff,0x4a,0x4a,0x4a,0xff,0x4e,0x4e,0x4e,0xff,0x52,0x52,0x52,0xff,
-    0x56,0x56,0x56,0xff,0x5b,0x5b,0x5b,0xff,0x5f,0x5f,0x5f,0xff,0x64,0x64,0x64,0xff,0x68,0x68,0x68,0xff,
-    0x65,0x65,0x65,0xff,0x50,0x50,0x50,0xff,0x27,0x27,0x27,0xff,0x06,0x06,0x06,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x0f,0x0f,0x0f,0xff,0x86,0x86,0x86,0xff,0xcb,0xcb,0xcb,0xff,0xd2,0xd2,0xd2,0xff,
-    0xdc,0xdc,0xdc,0xff,0xda,0xda,0xda,0xff,0xd0,0xd0,0xd0,0xff,0x90,0x90,0x90,0xff,0x0d,0x0d,0x0d,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xfa,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0xac,
-    0x00,0x00,0x00,0x95,0x00,0x00,0x00,0xfa,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x60,0x60,0x60,0xff,
-    0xc6,0xc6,0xc6,0xff,0xcf,0xcf,0xcf,0xff,0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xce,0xce,0xce,0xff,
-    0xc9,0xc9,0xc9,0xff,0xb4,0xb4,0xb4,0xff,0x50,0x50,0x50,0xff,0x03,0x03,0x03,0xff,0x00,0x00,0x00,0xff,
-    0x02,0x02,0x02,0xff,0x14,0x14,0x14,0xff,0x32,0x32,0x32,0xff,0x4b,0x4b,0x4b,0xff,0x55,0x55,0x55,0xff,
-    0x55,0x55,0x55,0xff,0x51,0x51,0x51,0xff,0x4d,0x4d,0x4d,0xff,0x48,0x48,0x48,0xff,0x44,0x44,0x44,0xff,
-    0x3f,0x3f,0x3f,0xff,0x3a,0x3a,0x3a,0xff,0x36,0x36,0x36,0xff,0x32,0x32,0x32,0xff,0x2e,0x2e,0x2e,0xff,
-    0x2a,0x2a,0x2a,0xff,0x28,0x28,0x28,0xff,0x25,0x25,0x25,0xff,0x23,0x23,0x23,0xff,0x23,0x23,0x23,0xff,
-    0x22,0x22,0x22,0xff,0x23,0x23,0x23,0xff,0x24,0x24,0x24,0xff,0x26,0x26,0x26,0xff,0x29,0x29,0x29,0xff,
-    0x2c,0x2c,0x2c,0xff,0x30,0x30,0x30,0xff,0x34,0x34,0x34,0xff,0x38,0x38,0x38,0xff,0x3c,0x3c,0x3c,0xff,
-    0x40,0x40,0x40,0xff,0x45,0x45,0x45,0xff,0x4a,0x4a,0x4a,0xff,0x4e,0x4e,0x4e,0xff,0x53,0x53,0x53,0xff,
-    0x57,0x57,0x57,0xff,0x58,0x58,0x58,0xff,0x50,0x50,0x50,0xff,0x3a,0x3a,0x3a,0xff,0x1a,0x1a,0x1a,0xff,
-    0x04,0x04,0x04,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x13,0x13,0x13,0xff,0x79,0x79,0x79,0xff,
-    0xc4,0xc4,0xc4,0xff,0xc9,0xc9,0xc9,0xff,0xce,0xce,0xce,0xff,0xda,0xda,0xda,0xff,0xdb,0xdb,0xdb,0xff,
-    0xd2,0xd2,0xd2,0xff,0xc3,0xc3,0xc3,0xff,0x58,0x58,0x58,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xd2,0x00,0x00,0x00,0x6e,
-    0x00,0x00,0x00,0xa3,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0xf3,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,0xa0,
-    0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0xd4,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x12,0x12,0x12,0xff,0x9d,0x9d,0x9d,0xff,0xc8,0xc8,0xc8,0xff,0xd0,0xd0,0xd0,0xff,
-    0xd8,0xd8,0xd8,0xff,0xd7,0xd7,0xd7,0xff,0xce,0xce,0xce,0xff,0xc7,0xc7,0xc7,0xff,0xc5,0xc5,0xc5,0xff,
-    0xb8,0xb8,0xb8,0xff,0x6f,0x6f,0x6f,0xff,0x19,0x19,0x19,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x07,0x07,0x07,0xff,0x1c,0x1c,0x1c,0xff,0x31,0x31,0x31,0xff,0x40,0x40,0x40,0xff,0x46,0x46,0x46,0xff,
-    0x46,0x46,0x46,0xff,0x42,0x42,0x42,0xff,0x3e,0x3e,0x3e,0xff,0x39,0x39,0x39,0xff,0x34,0x34,0x34,0xff,
-    0x2f,0x2f,0x2f,0xff,0x2a,0x2a,0x2a,0xff,0x25,0x25,0x25,0xff,0x21,0x21,0x21,0xff,0x1d,0x1d,0x1d,0xff,
-    0x19,0x19,0x19,0xff,0x16,0x16,0x16,0xff,0x14,0x14,0x14,0xff,0x13,0x13,0x13,0xff,0x14,0x14,0x14,0xff,
-    0x16,0x16,0x16,0xff,0x19,0x19,0x19,0xff,0x1d,0x1d,0x1d,0xff,0x21,0x21,0x21,0xff,0x25,0x25,0x25,0xff,
-    0x2a,0x2a,0x2a,0xff,0x30,0x30,0x30,0xff,0x35,0x35,0x35,0xff,0x3a,0x3a,0x3a,0xff,0x3e,0x3e,0x3e,0xff,
-    0x43,0x43,0x43,0xff,0x47,0x47,0x47,0xff,0x48,0x48,0x48,0xff,0x43,0x43,0x43,0xff,0x36,0x36,0x36,0xff,
-    0x20,0x20,0x20,0xff,0x0b,0x0b,0x0b,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x2c,0x2c,0x2c,0xff,0x8d,0x8d,0x8d,0xff,0xc2,0xc2,0xc2,0xff,0xc5,0xc5,0xc5,0xff,0xc6,0xc6,0xc6,0xff,
-    0xcc,0xcc,0xcc,0xff,0xd8,0xd8,0xd8,0xff,0xdb,0xdb,0xdb,0xff,0xd5,0xd5,0xd5,0xff,0xc9,0xc9,0xc9,0xff,
-    0xa5,0xa5,0xa5,0xff,0x1c,0x1c,0x1c,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x9f,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x14,
-    0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0xc1,0x00,0x00,0x00,0xf9,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xe1,0x00,0x00,0x00,0xdf,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0xda,
-    0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x3f,0x3f,0x3f,0xff,
-    0xba,0xba,0xba,0xff,0xc8,0xc8,0xc8,0xff,0xd2,0xd2,0xd2,0xff,0xd8,0xd8,0xd8,0xff,0xd7,0xd7,0xd7,0xff,
-    0xce,0xce,0xce,0xff,0xc5,0xc5,0xc5,0xff,0xc2,0xc2,0xc2,0xff,0xc2,0xc2,0xc2,0xff,0xbf,0xbf,0xbf,0xff,
-    0x9c,0x9c,0x9c,0xff,0x53,0x53,0x53,0xff,0x15,0x15,0x15,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,
-    0x07,0x07,0x07,0xff,0x15,0x15,0x15,0xff,0x24,0x24,0x24,0xff,0x2f,0x2f,0x2f,0xff,0x35,0x35,0x35,0xff,
-    0x37,0x37,0x37,0xff,0x35,0x35,0x35,0xff,0x32,0x32,0x32,0xff,0x2c,0x2c,0x2c,0xff,0x27,0x27,0x27,0xff,
-    0x22,0x22,0x22,0xff,0x1c,0x1c,0x1c,0xff,0x17,0x17,0x17,0xff,0x14,0x14,0x14,0xff,0x0e,0x0e,0x0e,0xff,
-    0x0d,0x0d,0x0d,0xff,0x0d,0x0d,0x0d,0xff,0x0d,0x0d,0x0d,0xff,0x0e,0x0e,0x0e,0xff,0x13,0x13,0x13,0xff,
-    0x16,0x16,0x16,0xff,0x1c,0x1c,0x1c,0xff,0x21,0x21,0x21,0xff,0x26,0x26,0x26,0xff,0x2b,0x2b,0x2b,0xff,
-    0x30,0x30,0x30,0xff,0x34,0x34,0x34,0xff,0x36,0x36,0x36,0xff,0x36,0x36,0x36,0xff,0x31,0x31,0x31,0xff,
-    0x27,0x27,0x27,0xff,0x19,0x19,0x19,0xff,0x0a,0x0a,0x0a,0xff,0x02,0x02,0x02,0xff,0x00,0x00,0x00,0xff,
-    0x01,0x01,0x01,0xff,0x1d,0x1d,0x1d,0xff,0x68,0x68,0x68,0xff,0xab,0xab,0xab,0xff,0xc1,0xc1,0xc1,0xff,
-    0xc2,0xc2,0xc2,0xff,0xc2,0xc2,0xc2,0xff,0xc2,0xc2,0xc2,0xff,0xc9,0xc9,0xc9,0xff,0xd6,0xd6,0xd6,0xff,
-    0xd9,0xd9,0xd9,0xff,0xd7,0xd7,0xd7,0xff,0xcb,0xcb,0xcb,0xff,0xc0,0xc0,0xc0,0xff,0x6a,0x6a,0x6a,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x77,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
-    0x00,0x00,0x00,0x48,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,0xf9,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xd0,
-    0x00,0x00,0x00,0xba,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xfd,
-    0x00,0x00,0x00,0xd8,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x2f,0x00,0x00,0x00,0xf5,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x7a,0x7a,0x7a,0xff,0xc0,0xc0,0xc0,0xff,0xc9,0xc9,0xc9,0xff,
-    0xd3,0xd3,0xd3,0xff,0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xcf,0xcf,0xcf,0xff,0xc4,0xc4,0xc4,0xff,
-    0xbf,0xbf,0xbf,0xff,0xbf,0xbf,0xbf,0xff,0xbf,0xbf,0xbf,0xff,0xbe,0xbe,0xbe,0xff,0xb9,0xb9,0xb9,0xff,
-    0x9b,0x9b,0x9b,0xff,0x66,0x66,0x66,0xff,0x27,0x27,0x27,0xff,0x0a,0x0a,0x0a,0xff,0x01,0x01,0x01,0xff,
-    0x03,0x03,0x03,0xff,0x0a,0x0a,0x0a,0xff,0x13,0x13,0x13,0xff,0x1b,0x1b,0x1b,0xff,0x21,0x21,0x21,0xff,
-    0x24,0x24,0x24,0xff,0x25,0x25,0x25,0xff,0x24,0x24,0x24,0xff,0x22,0x22,0x22,0xff,0x20,0x20,0x20,0xff,
-    0x1c,0x1c,0x1c,0xff,0x19,0x19,0x19,0xff,0x16,0x16,0x16,0xff,0x14,0x14,0x14,0xff,0x12,0x12,0x12,0xff,
-    0x13,0x13,0x13,0xff,0x14,0x14,0x14,0xff,0x17,0x17,0x17,0xff,0x19,0x19,0x19,0xff,0x1d,0x1d,0x1d,0xff,
-    0x20,0x20,0x20,0xff,0x22,0x22,0x22,0xff,0x24,0x24,0x24,0xff,0x24,0x24,0x24,0xff,0x21,0x21,0x21,0xff,
-    0x1c,0x1c,0x1c,0xff,0x15,0x15,0x15,0xff,0x0c,0x0c,0x0c,0xff,0x04,0x04,0x04,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x0c,0x0c,0x0c,0xff,0x2d,0x2d,0x2d,0xff,0x70,0x70,0x70,0xff,0xa3,0xa3,0xa3,0xff,
-    0xbc,0xbc,0xbc,0xff,0xbf,0xbf,0xbf,0xff,0xbf,0xbf,0xbf,0xff,0xbf,0xbf,0xbf,0xff,0xbf,0xbf,0xbf,0xff,
-    0xbf,0xbf,0xbf,0xff,0xc8,0xc8,0xc8,0xff,0xd5,0xd5,0xd5,0xff,0xd8,0xd8,0xd8,0xff,0xd7,0xd7,0xd7,0xff,
-    0xcf,0xcf,0xcf,0xff,0xc2,0xc2,0xc2,0xff,0xa5,0xa5,0xa5,0xff,0x1f,0x1f,0x1f,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x0a,0x0a,0x0a,0xff,
-    0x0d,0x0d,0x0d,0xff,0x02,0x02,0x02,0xfa,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
-    0x00,0x00,0x00,0x53,0x00,0x00,0x00,0xcf,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xb0,0x00,0x00,0x00,0x7b,0x00,0x00,0x00,0xfe,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0xe5,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0xba,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x15,0x15,0x15,0xff,
-    0x9e,0x9e,0x9e,0xff,0xc3,0xc3,0xc3,0xff,0xce,0xce,0xce,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd6,0xd6,0xd6,0xff,0xd1,0xd1,0xd1,0xff,0xc6,0xc6,0xc6,0xff,0xbf,0xbf,0xbf,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbc,0xbc,0xbc,0xff,
-    0xae,0xae,0xae,0xff,0x8f,0x8f,0x8f,0xff,0x66,0x66,0x66,0xff,0x32,0x32,0x32,0xff,0x19,0x19,0x19,0xff,
-    0x06,0x06,0x06,0xff,0x02,0x02,0x02,0xff,0x04,0x04,0x04,0xff,0x07,0x07,0x07,0xff,0x0c,0x0c,0x0c,0xff,
-    0x0f,0x0f,0x0f,0xff,0x11,0x11,0x11,0xff,0x13,0x13,0x13,0xff,0x14,0x14,0x14,0xff,0x15,0x15,0x15,0xff,
-    0x16,0x16,0x16,0xff,0x14,0x14,0x14,0xff,0x13,0x13,0x13,0xff,0x12,0x12,0x12,0xff,0x11,0x11,0x11,0xff,
-    0x12,0x12,0x12,0xff,0x12,0x12,0x12,0xff,0x11,0x11,0x11,0xff,0x10,0x10,0x10,0xff,0x0f,0x0f,0x0f,0xff,
-    0x0c,0x0c,0x0c,0xff,0x08,0x08,0x08,0xff,0x04,0x04,0x04,0xff,0x02,0x02,0x02,0xff,0x01,0x01,0x01,0xff,
-    0x05,0x05,0x05,0xff,0x19,0x19,0x19,0xff,0x33,0x33,0x33,0xff,0x69,0x69,0x69,0xff,0x92,0x92,0x92,0xff,
-    0xb1,0xb1,0xb1,0xff,0xbc,0xbc,0xbc,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbf,0xbf,0xff,0xca,0xca,0xca,0xff,
-    0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd3,0xd3,0xd3,0xff,0xc7,0xc7,0xc7,0xff,
-    0xbd,0xbd,0xbd,0xff,0x64,0x64,0x64,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x04,0x04,0x04,0xff,0x1f,0x1f,0x1f,0xff,0x1c,0x1c,0x1c,0xff,0x03,0x03,0x03,0xf4,
-    0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
-    0x00,0x00,0x00,0x79,0x00,0x00,0x00,0xeb,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xfe,
-    0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0xec,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xf5,0x00,0x00,0x00,0x99,0x00,0x00,0x00,0x21,
-    0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0xfb,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x2d,0x2d,0x2d,0xff,0xb7,0xb7,0xb7,0xff,0xc8,0xc8,0xc8,0xff,
-    0xd2,0xd2,0xd2,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd3,0xd3,0xd3,0xff,
-    0xc9,0xc9,0xc9,0xff,0xc0,0xc0,0xc0,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbc,0xbc,0xbc,0xff,0xb6,0xb6,0xb6,0xff,0xa3,0xa3,0xa3,0xff,0x8c,0x8c,0x8c,0xff,0x72,0x72,0x72,0xff,
-    0x53,0x53,0x53,0xff,0x30,0x30,0x30,0xff,0x20,0x20,0x20,0xff,0x18,0x18,0x18,0xff,0x0f,0x0f,0x0f,0xff,
-    0x06,0x06,0x06,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,0x03,0x03,0x03,0xff,
-    0x03,0x03,0x03,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,0x02,0x02,0x02,0xff,
-    0x02,0x02,0x02,0xff,0x05,0x05,0x05,0xff,0x0c,0x0c,0x0c,0xff,0x17,0x17,0x17,0xff,0x1f,0x1f,0x1f,0xff,
-    0x2e,0x2e,0x2e,0xff,0x4f,0x4f,0x4f,0xff,0x70,0x70,0x70,0xff,0x8a,0x8a,0x8a,0xff,0xa2,0xa2,0xa2,0xff,
-    0xb6,0xb6,0xb6,0xff,0xbc,0xbc,0xbc,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xc0,0xc0,0xc0,0xff,0xcc,0xcc,0xcc,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xce,0xce,0xce,0xff,0xc1,0xc1,0xc1,0xff,0x9a,0x9a,0x9a,0xff,
-    0x13,0x13,0x13,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x11,0x11,0x11,0xff,
-    0x32,0x32,0x32,0xff,0x20,0x20,0x20,0xff,0x02,0x02,0x02,0xd0,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x2d,
-    0x00,0x00,0x00,0xb5,0x00,0x00,0x00,0xfb,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x68,0x00,0x00,0x00,0xf2,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0xc5,
-    0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x10,0x01,0x01,0x01,0xdb,0x04,0x04,0x04,0xff,0x04,0x04,0x04,0xff,0x01,0x01,0x01,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x5a,0x5a,0x5a,0xff,0xc0,0xc0,0xc0,0xff,0xcd,0xcd,0xcd,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd5,0xd5,0xd5,0xff,0xcc,0xcc,0xcc,0xff,0xc2,0xc2,0xc2,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbd,0xbd,0xbd,0xff,0xbb,0xbb,0xbb,0xff,0xb7,0xb7,0xb7,0xff,
-    0xad,0xad,0xad,0xff,0xa1,0xa1,0xa1,0xff,0x97,0x97,0x97,0xff,0x8d,0x8d,0x8d,0xff,0x84,0x84,0x84,0xff,
-    0x7c,0x7c,0x7c,0xff,0x75,0x75,0x75,0xff,0x72,0x72,0x72,0xff,0x72,0x72,0x72,0xff,0x72,0x72,0x72,0xff,
-    0x72,0x72,0x72,0xff,0x74,0x74,0x74,0xff,0x7b,0x7b,0x7b,0xff,0x83,0x83,0x83,0xff,0x8c,0x8c,0x8c,0xff,
-    0x94,0x94,0x94,0xff,0xa0,0xa0,0xa0,0xff,0xac,0xac,0xac,0xff,0xb6,0xb6,0xb6,0xff,0xbb,0xbb,0xbb,0xff,
-    0xbd,0xbd,0xbd,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc2,0xc2,0xc2,0xff,
-    0xcf,0xcf,0xcf,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd3,0xd3,0xd3,0xff,0xc6,0xc6,0xc6,0xff,0xb8,0xb8,0xb8,0xff,0x3d,0x3d,0x3d,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x04,0x04,0x04,0xff,0x27,0x27,0x27,0xff,0x3e,0x3e,0x3e,0xff,0x1a,0x1a,0x1a,0xff,
-    0x01,0x01,0x01,0x96,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x6e,
-    0x00,0x00,0x00,0xee,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xb4,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x01,0x05,0x05,0x05,0x7b,
-    0x08,0x08,0x08,0xfd,0x0c,0x0c,0x0c,0xff,0x05,0x05,0x05,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x79,0x79,0x79,0xff,0xc6,0xc6,0xc6,0xff,
-    0xd1,0xd1,0xd1,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd6,0xd6,0xd6,0xff,0xce,0xce,0xce,0xff,0xc3,0xc3,0xc3,0xff,0xbf,0xbf,0xbf,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbd,0xbd,0xbd,0xff,0xbd,0xbd,0xbd,0xff,
-    0xbd,0xbd,0xbd,0xff,0xbd,0xbd,0xbd,0xff,0xbd,0xbd,0xbd,0xff,0xbd,0xbd,0xbd,0xff,0xbd,0xbd,0xbd,0xff,
-    0xbd,0xbd,0xbd,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc4,0xc4,0xc4,0xff,0xd2,0xd2,0xd2,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xcc,0xcc,0xcc,0xff,
-    0xbf,0xbf,0xbf,0xff,0x74,0x74,0x74,0xff,0x00,0x00,0x00,0xff,0x01,0x01,0x01,0xff,0x13,0x13,0x13,0xff,
-    0x3e,0x3e,0x3e,0xff,0x3e,0x3e,0x3e,0xff,0x10,0x10,0x10,0xfb,0x01,0x01,0x01,0x56,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0xc7,
-    0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0xf9,0x00,0x00,0x00,0xcc,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x1d,0x0a,0x0a,0x0a,0xe8,0x13,0x13,0x13,0xff,
-    0x0e,0x0e,0x0e,0xff,0x03,0x03,0x03,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x03,0x03,0x03,0xff,0x8d,0x8d,0x8d,0xff,0xcc,0xcc,0xcc,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xd0,0xd0,0xd0,0xff,
-    0xc5,0xc5,0xc5,0xff,0xbf,0xbf,0xbf,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbf,0xbf,0xff,
-    0xc8,0xc8,0xc8,0xff,0xd4,0xd4,0xd4,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd2,0xd2,0xd2,0xff,0xc5,0xc5,0xc5,0xff,0x95,0x95,0x95,0xff,
-    0x0e,0x0e,0x0e,0xff,0x09,0x09,0x09,0xff,0x2f,0x2f,0x2f,0xff,0x4f,0x4f,0x4f,0xff,0x33,0x33,0x33,0xff,
-    0x07,0x07,0x07,0xed,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x41,
-    0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x2a,0x2a,0x2a,0x02,0x11,0x11,0x11,0x8a,0x15,0x15,0x15,0xfe,0x1a,0x1a,0x1a,0xff,0x0c,0x0c,0x0c,0xff,
-    0x01,0x01,0x01,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x11,0x11,0x11,0xff,0x9c,0x9c,0x9c,0xff,
-    0xd1,0xd1,0xd1,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xd2,0xd2,0xd2,0xff,0xc7,0xc7,0xc7,0xff,0xbf,0xbf,0xbf,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc0,0xc0,0xc0,0xff,0xcc,0xcc,0xcc,0xff,0xd6,0xd6,0xd6,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd5,0xd5,0xd5,0xff,0xcb,0xcb,0xcb,0xff,0xab,0xab,0xab,0xff,0x21,0x21,0x21,0xff,0x28,0x28,0x28,0xff,
-    0x4e,0x4e,0x4e,0xff,0x4f,0x4f,0x4f,0xff,0x21,0x21,0x21,0xff,0x02,0x02,0x02,0xae,0x00,0x00,0x00,0x04,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x22,
-    0x13,0x13,0x13,0xea,0x23,0x23,0x23,0xff,0x1d,0x1d,0x1d,0xff,0x09,0x09,0x09,0xff,0x01,0x01,0x01,0xff,
-    0x02,0x02,0x02,0xff,0x1e,0x1e,0x1e,0xff,0xa7,0xa7,0xa7,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd3,0xd3,0xd3,0xff,0xc8,0xc8,0xc8,0xff,0xc0,0xc0,0xc0,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xc3,0xc3,0xc3,0xff,0xd0,0xd0,0xd0,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd0,0xd0,0xd0,0xff,
-    0xbd,0xbd,0xbd,0xff,0x3f,0x3f,0x3f,0xff,0x4f,0x4f,0x4f,0xff,0x5c,0x5c,0x5c,0xff,0x42,0x42,0x42,0xff,
-    0x11,0x11,0x11,0xfb,0x01,0x01,0x01,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x65,0x65,0x03,0x1c,0x1c,0x1c,0x89,0x23,0x23,0x23,0xfe,
-    0x31,0x31,0x31,0xff,0x23,0x23,0x23,0xff,0x10,0x10,0x10,0xff,0x0e,0x0e,0x0e,0xff,0x2e,0x2e,0x2e,0xff,
-    0xaa,0xaa,0xaa,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd4,0xd4,0xd4,0xff,0xc9,0xc9,0xc9,0xff,
-    0xc0,0xc0,0xc0,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbf,0xbf,0xff,0xc7,0xc7,0xc7,0xff,0xd4,0xd4,0xd4,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd5,0xd5,0xd5,0xff,0xcc,0xcc,0xcc,0xff,0x63,0x63,0x63,0xff,
-    0x60,0x60,0x60,0xff,0x57,0x57,0x57,0xff,0x2c,0x2c,0x2c,0xff,0x05,0x05,0x05,0xe2,0x00,0x00,0x00,0x13,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x3d,0x3d,0x3d,0x1e,0x1d,0x1d,0x1d,0xe5,0x39,0x39,0x39,0xff,0x43,0x43,0x43,0xff,
-    0x37,0x37,0x37,0xff,0x31,0x31,0x31,0xff,0x46,0x46,0x46,0xff,0xa8,0xa8,0xa8,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd4,0xd4,0xd4,0xff,0xca,0xca,0xca,0xff,0xc1,0xc1,0xc1,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xc0,0xc0,0xc0,0xff,0xcc,0xcc,0xcc,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd0,0xd0,0xd0,0xff,0x6a,0x6a,0x6a,0xff,0x60,0x60,0x60,0xff,0x47,0x47,0x47,0xff,
-    0x17,0x17,0x17,0xfe,0x01,0x01,0x01,0x8a,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x02,
-    0x28,0x28,0x28,0x79,0x2f,0x2f,0x2f,0xfd,0x4f,0x4f,0x4f,0xff,0x57,0x57,0x57,0xff,0x56,0x56,0x56,0xff,
-    0x5b,0x5b,0x5b,0xff,0xa0,0xa0,0xa0,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd4,0xd4,0xd4,0xff,
-    0xcb,0xcb,0xcb,0xff,0xc1,0xc1,0xc1,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc3,0xc3,0xc3,0xff,0xd1,0xd1,0xd1,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xc9,0xc9,0xc9,0xff,
-    0x68,0x68,0x68,0xff,0x59,0x59,0x59,0xff,0x30,0x30,0x30,0xff,0x07,0x07,0x07,0xf1,0x00,0x00,0x00,0x29,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x57,0x57,0x57,0x14,0x23,0x23,0x23,0xd5,
-    0x42,0x42,0x42,0xff,0x5b,0x5b,0x5b,0xff,0x61,0x61,0x61,0xff,0x62,0x62,0x62,0xff,0x94,0x94,0x94,0xff,
-    0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd4,0xd4,0xd4,0xff,0xca,0xca,0xca,0xff,0xc1,0xc1,0xc1,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbf,0xbf,0xbf,0xff,0xc7,0xc7,0xc7,0xff,0xd4,0xd4,0xd4,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xbf,0xbf,0xbf,0xff,0x64,0x64,0x64,0xff,0x48,0x48,0x48,0xff,
-    0x18,0x18,0x18,0xfe,0x01,0x01,0x01,0x9f,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xb2,0xb2,0xb2,0x01,0x35,0x35,0x35,0x5b,0x2e,0x2e,0x2e,0xfa,0x51,0x51,0x51,0xff,
-    0x60,0x60,0x60,0xff,0x62,0x62,0x62,0xff,0x84,0x84,0x84,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd4,0xd4,0xd4,0xff,0xca,0xca,0xca,0xff,0xc0,0xc0,0xc0,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc0,0xc0,0xc0,0xff,0xcc,0xcc,0xcc,0xff,
-    0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xb2,0xb2,0xb2,0xff,0x59,0x59,0x59,0xff,0x2f,0x2f,0x2f,0xff,0x07,0x07,0x07,0xf2,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x7c,0x7c,0x7c,0x0a,0x27,0x27,0x27,0xb7,0x3e,0x3e,0x3e,0xff,0x5a,0x5a,0x5a,0xff,0x62,0x62,0x62,0xff,
-    0x71,0x71,0x71,0xff,0xd3,0xd3,0xd3,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd3,0xd3,0xd3,0xff,0xc9,0xc9,0xc9,0xff,
-    0xc0,0xc0,0xc0,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xc3,0xc3,0xc3,0xff,0xd1,0xd1,0xd1,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0x9e,0x9e,0x9e,0xff,0x45,0x45,0x45,0xff,
-    0x16,0x16,0x16,0xfe,0x01,0x01,0x01,0x99,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x48,0x36,
-    0x2a,0x2a,0x2a,0xf0,0x4c,0x4c,0x4c,0xff,0x5f,0x5f,0x5f,0xff,0x68,0x68,0x68,0xff,0xc9,0xc9,0xc9,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd3,0xd3,0xd3,0xff,0xc8,0xc8,0xc8,0xff,0xc0,0xc0,0xc0,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbf,0xbf,0xff,0xc7,0xc7,0xc7,0xff,
-    0xd4,0xd4,0xd4,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd5,0xd5,0xd5,0xff,0x7d,0x7d,0x7d,0xff,0x2a,0x2a,0x2a,0xff,0x05,0x05,0x05,0xea,0x00,0x00,0x00,0x26,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x99,0x99,0x04,0x2f,0x2f,0x2f,0x87,0x36,0x36,0x36,0xfd,
-    0x56,0x56,0x56,0xff,0x64,0x64,0x64,0xff,0xb9,0xb9,0xb9,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xd2,0xd2,0xd2,0xff,
-    0xc7,0xc7,0xc7,0xff,0xbf,0xbf,0xbf,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xc0,0xc0,0xc0,0xff,0xcb,0xcb,0xcb,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xcb,0xcb,0xcb,0xff,0x4d,0x4d,0x4d,0xff,
-    0x10,0x10,0x10,0xfd,0x01,0x01,0x01,0x7f,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x67,0x67,0x67,0x16,0x26,0x26,0x26,0xd2,0x43,0x43,0x43,0xff,0x5b,0x5b,0x5b,0xff,
-    0xa4,0xa4,0xa4,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,0xd0,0xd0,0xd0,0xff,0xc5,0xc5,0xc5,0xff,0xbf,0xbf,0xbf,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc1,0xc1,0xc1,0xff,
-    0xcf,0xcf,0xcf,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xad,0xad,0xad,0xff,0x29,0x29,0x29,0xff,0x03,0x03,0x03,0xd7,0x00,0x00,0x00,0x14,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc5,0xc5,0xc5,0x01,
-    0x3a,0x3a,0x3a,0x4e,0x2a,0x2a,0x2a,0xf7,0x4c,0x4c,0x4c,0xff,0x85,0x85,0x85,0xff,0xd5,0xd5,0xd5,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd6,0xd6,0xd6,0xff,
-    0xce,0xce,0xce,0xff,0xc3,0xc3,0xc3,0xff,0xbf,0xbf,0xbf,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc4,0xc4,0xc4,0xff,0xd1,0xd1,0xd1,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd3,0xd3,0xd3,0xff,0x7c,0x7c,0x7c,0xff,
-    0x0b,0x0b,0x0b,0xf9,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x86,0x86,0x06,0x25,0x25,0x25,0x9d,
-    0x33,0x33,0x33,0xfe,0x5d,0x5d,0x5d,0xff,0xcb,0xcb,0xcb,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd5,0xd5,0xd5,0xff,0xcd,0xcd,0xcd,0xff,0xc2,0xc2,0xc2,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xc6,0xc6,0xc6,0xff,0xd3,0xd3,0xd3,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd6,0xd6,0xd6,0xff,0xc1,0xc1,0xc1,0xff,0x35,0x35,0x35,0xff,0x01,0x01,0x01,0xb2,0x00,0x00,0x00,0x07,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x45,0x45,0x1e,0x1d,0x1d,0x1d,0xdd,0x3e,0x3e,0x3e,0xff,
-    0xab,0xab,0xab,0xff,0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd4,0xd4,0xd4,0xff,0xcb,0xcb,0xcb,0xff,0xc1,0xc1,0xc1,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbf,0xbf,0xff,0xc8,0xc8,0xc8,0xff,0xd4,0xd4,0xd4,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd2,0xd2,0xd2,0xff,0x8d,0x8d,0x8d,0xff,
-    0x0c,0x0c,0x0c,0xee,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x99,0x99,0x99,0x01,0x22,0x22,0x22,0x5a,0x1f,0x1f,0x1f,0xf9,0x72,0x72,0x72,0xff,0xd1,0xd1,0xd1,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd3,0xd3,0xd3,0xff,0xc9,0xc9,0xc9,0xff,
-    0xc0,0xc0,0xc0,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbf,0xbf,0xbf,0xff,0xc9,0xc9,0xc9,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd5,0xd5,0xd5,0xff,0xbf,0xbf,0xbf,0xff,0x3d,0x3d,0x3d,0xfd,0x01,0x01,0x01,0x83,0x00,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x07,
-    0x12,0x12,0x12,0xa8,0x30,0x30,0x30,0xfe,0xb2,0xb2,0xb2,0xff,0xd5,0xd5,0xd5,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd6,0xd6,0xd6,0xff,0xd1,0xd1,0xd1,0xff,0xc6,0xc6,0xc6,0xff,0xbf,0xbf,0xbf,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbf,0xbf,0xff,0xca,0xca,0xca,0xff,
-    0xd6,0xd6,0xd6,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,
-    0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xd7,0xd7,0xd7,0xff,0xcf,0xcf,0xcf,0xff,0x81,0x81,0x81,0xff,
-    0x08,0x08,0x08,0xd4,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x18,0x17,0x24,0x17,0x12,0x0e,0xe4,
-    0x6b,0x68,0x67,0xff,0xcc,0xca,0xc9,0xff,0xd5,0xd3,0xd2,0xff,0xd5,0xd3,0xd2,0xff,0xcf,0xcd,0xcb,0xff,
-    0xc5,0xc3,0xc1,0xff,0xc0,0xbe,0xbc,0xff,0xbf,0xbd,0xbc,0xff,0xbe,0xbe,0xbd,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xc0,0xbf,0xbe,0xff,0xcb,0xc9,0xc8,0xff,0xd6,0xd4,0xd3,0xff,0xd7,0xd5,0xd3,0xff,
-    0xd7,0xd5,0xd3,0xff,0xd7,0xd5,0xd4,0xff,0xd7,0xd6,0xd4,0xff,0xd7,0xd6,0xd5,0xff,0xd7,0xd6,0xd5,0xff,
-    0xd4,0xd3,0xd3,0xff,0xac,0xac,0xac,0xff,0x26,0x26,0x26,0xf9,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x88,0x00,0x04,0xde,0x8a,0x00,0x0f,
-    0xde,0x8b,0x00,0x3a,0xdd,0x8c,0x00,0x6a,0xbc,0x78,0x02,0xcc,0xba,0x7a,0x12,0xff,0xd5,0x99,0x54,0xff,
-    0xdc,0x9f,0x55,0xff,0xdd,0x9e,0x4f,0xff,0xdc,0x9e,0x49,0xff,0xda,0x9e,0x4b,0xff,0xd8,0xa0,0x52,0xff,
-    0xd6,0xa4,0x65,0xff,0xd3,0xa8,0x77,0xff,0xce,0xad,0x8b,0xff,0xc9,0xb3,0x9e,0xff,0xc2,0xba,0xb2,0xff,
-    0xbf,0xbd,0xbc,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbd,0xff,
-    0xbf,0xbc,0xba,0xff,0xc4,0xb7,0xab,0xff,0xcb,0xb1,0x98,0xff,0xd0,0xab,0x83,0xff,0xd4,0xa8,0x71,0xff,
-    0xd9,0xa8,0x64,0xff,0xdc,0xa8,0x58,0xff,0xdd,0xa8,0x52,0xff,0xdd,0xa8,0x4d,0xff,0xdd,0xaa,0x53,0xff,
-    0xdd,0xad,0x5a,0xff,0xdc,0xb2,0x6e,0xff,0xdb,0xb7,0x82,0xff,0xd6,0xb9,0x91,0xff,0x99,0x7a,0x4c,0xff,
-    0x6a,0x4c,0x01,0xbf,0xb0,0x7f,0x00,0x10,0xde,0xa1,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x82,0x01,0x03,0xde,0x84,0x01,0x19,
-    0xde,0x86,0x01,0x61,0xde,0x88,0x01,0xab,0xde,0x8b,0x0e,0xe6,0xdf,0x8e,0x1d,0xf9,0xdf,0x92,0x25,0xfd,
-    0xdf,0x96,0x2b,0xff,0xe0,0x98,0x2f,0xff,0xdf,0x99,0x2c,0xff,0xdf,0x99,0x25,0xff,0xdf,0x99,0x1e,0xff,
-    0xde,0x99,0x10,0xff,0xde,0x99,0x01,0xff,0xde,0x9a,0x00,0xff,0xde,0x9b,0x00,0xff,0xde,0x9c,0x00,0xff,
-    0xde,0x9c,0x04,0xff,0xdd,0x9d,0x16,0xff,0xdd,0x9d,0x28,0xff,0xd8,0xa3,0x5a,0xff,0xcf,0xad,0x87,0xff,
-    0xc5,0xb7,0xaa,0xff,0xbf,0xbd,0xbb,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbd,0xff,
-    0xc0,0xbb,0xb8,0xff,0xc9,0xb1,0x9e,0xff,0xd2,0xa4,0x78,0xff,0xda,0x9a,0x46,0xff,0xdd,0x96,0x20,0xff,
-    0xde,0x98,0x10,0xff,0xde,0x99,0x01,0xff,0xde,0x9b,0x00,0xff,0xde,0x9d,0x00,0xff,0xde,0x9f,0x00,0xff,
-    0xde,0xa1,0x08,0xff,0xdf,0xa4,0x1a,0xff,0xdf,0xa6,0x23,0xff,0xdf,0xa9,0x29,0xff,0xe0,0xaa,0x2f,0xff,
-    0xe0,0xaa,0x2d,0xff,0xdf,0xa8,0x27,0xff,0xdd,0xa6,0x20,0xff,0xdd,0xa3,0x14,0xfa,0xde,0xa2,0x03,0xd5,
-    0xde,0xa1,0x00,0x92,0xde,0xa0,0x00,0x46,0xde,0x9f,0x00,0x0b,0xdf,0x9e,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x7d,0x01,0x04,
-    0xde,0x80,0x01,0x31,0xde,0x82,0x02,0x98,0xdf,0x86,0x19,0xe9,0xe2,0x95,0x45,0xfc,0xe8,0xb1,0x78,0xff,
-    0xed,0xc4,0x96,0xff,0xf1,0xd2,0xa9,0xff,0xf4,0xdb,0xb6,0xff,0xf5,0xe0,0xbb,0xff,0xf6,0xe2,0xbc,0xff,
-    0xf5,0xe1,0xbb,0xff,0xf4,0xde,0xb7,0xff,0xf2,0xd8,0xab,0xff,0xee,0xce,0x9a,0xff,0xe9,0xc0,0x7f,0xff,
-    0xe2,0xac,0x50,0xff,0xdf,0xa1,0x1c,0xff,0xde,0x9f,0x02,0xff,0xde,0x9f,0x00,0xff,0xde,0x9f,0x00,0xff,
-    0xde,0x9f,0x00,0xff,0xde,0x9e,0x00,0xff,0xde,0x9d,0x05,0xff,0xdd,0x9d,0x21,0xff,0xd7,0xa4,0x60,0xff,
-    0xca,0xb2,0x99,0xff,0xc0,0xbc,0xb9,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbd,0xff,0xc2,0xb8,0xb2,0xff,0xcf,0xa6,0x87,0xff,0xda,0x95,0x46,0xff,0xdd,0x90,0x16,0xff,
-    0xde,0x92,0x01,0xff,0xde,0x94,0x00,0xff,0xde,0x96,0x00,0xff,0xde,0x98,0x00,0xff,0xde,0x9a,0x00,0xff,
-    0xde,0x9d,0x11,0xff,0xe0,0xa6,0x39,0xff,0xe6,0xbb,0x70,0xff,0xec,0xcc,0x91,0xff,0xf1,0xd8,0xa6,0xff,
-    0xf3,0xe1,0xb3,0xff,0xf5,0xe5,0xba,0xff,0xf6,0xe7,0xbc,0xff,0xf6,0xe6,0xbc,0xff,0xf5,0xe4,0xb9,0xff,
-    0xf2,0xdf,0xae,0xff,0xef,0xd5,0x9e,0xff,0xea,0xc7,0x86,0xff,0xe4,0xb4,0x5c,0xff,0xdf,0xa4,0x25,0xf9,
-    0xde,0x9f,0x07,0xd3,0xde,0x9d,0x00,0x73,0xde,0x9c,0x00,0x17,0xde,0x9a,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xde,0x79,0x01,0x01,0xde,0x7b,0x01,0x26,0xde,0x7d,0x02,0x9e,0xdf,0x83,0x1e,0xf3,0xe5,0xa3,0x66,0xfe,
-    0xef,0xc6,0x99,0xff,0xf4,0xd9,0xb2,0xff,0xf5,0xdd,0xb6,0xff,0xf6,0xde,0xb8,0xff,0xf6,0xdf,0xb8,0xff,
-    0xf6,0xe0,0xb8,0xff,0xf6,0xe0,0xb8,0xff,0xf6,0xe1,0xb8,0xff,0xf6,0xe2,0xb8,0xff,0xf6,0xe2,0xb8,0xff,
-    0xf6,0xe3,0xb8,0xff,0xf6,0xe3,0xb8,0xff,0xf5,0xe3,0xb7,0xff,0xf5,0xe2,0xb4,0xff,0xf0,0xd7,0x9f,0xff,
-    0xe7,0xbe,0x71,0xff,0xdf,0xa7,0x28,0xff,0xde,0xa3,0x01,0xff,0xde,0xa3,0x00,0xff,0xde,0xa2,0x00,0xff,
-    0xde,0xa1,0x00,0xff,0xde,0x9f,0x00,0xff,0xde,0x9e,0x00,0xff,0xde,0x9d,0x14,0xff,0xd8,0xa2,0x55,0xff,
-    0xc9,0xb3,0x9d,0xff,0xbf,0xbd,0xbc,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xc1,0xba,0xb6,0xff,0xcf,0xa4,0x86,0xff,0xdb,0x8e,0x37,0xff,
-    0xde,0x8b,0x07,0xff,0xde,0x8e,0x00,0xff,0xde,0x90,0x00,0xff,0xde,0x92,0x00,0xff,0xde,0x94,0x00,0xff,
-    0xde,0x96,0x00,0xff,0xde,0x99,0x13,0xff,0xe4,0xad,0x56,0xff,0xed,0xcb,0x90,0xff,0xf4,0xdf,0xaf,0xff,
-    0xf5,0xe4,0xb6,0xff,0xf6,0xe5,0xb7,0xff,0xf6,0xe6,0xb8,0xff,0xf6,0xe6,0xb8,0xff,0xf6,0xe7,0xb8,0xff,
-    0xf6,0xe7,0xb8,0xff,0xf6,0xe7,0xb8,0xff,0xf6,0xe7,0xb8,0xff,0xf6,0xe7,0xb8,0xff,0xf6,0xe7,0xb8,0xff,
-    0xf5,0xe6,0xb7,0xff,0xf5,0xe4,0xb5,0xff,0xf2,0xdb,0xa6,0xff,0xe9,0xc3,0x7d,0xff,0xe0,0xa6,0x37,0xfd,
-    0xde,0x9c,0x05,0xe0,0xde,0x9a,0x00,0x70,0xde,0x99,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x76,0x01,0x07,0xde,0x78,0x01,0x69,0xde,0x7b,0x07,0xe7,
-    0xe2,0x92,0x4b,0xfe,0xee,0xc1,0x91,0xff,0xf4,0xd4,0xa8,0xff,0xf4,0xd6,0xaa,0xff,0xf4,0xd7,0xab,0xff,
-    0xf4,0xd8,0xab,0xff,0xf4,0xd9,0xab,0xff,0xf4,0xd9,0xab,0xff,0xf4,0xda,0xab,0xff,0xf4,0xdb,0xab,0xff,
-    0xf4,0xdc,0xab,0xff,0xf4,0xdc,0xab,0xff,0xf4,0xdd,0xab,0xff,0xf4,0xde,0xab,0xff,0xf4,0xdf,0xab,0xff,
-    0xf4,0xdf,0xab,0xff,0xf4,0xe0,0xab,0xff,0xf4,0xe1,0xab,0xff,0xf4,0xe0,0xa9,0xff,0xf0,0xd7,0x98,0xff,
-    0xe4,0xb9,0x59,0xff,0xde,0xa7,0x0d,0xff,0xde,0xa6,0x00,0xff,0xde,0xa4,0x00,0xff,0xde,0xa3,0x00,0xff,
-    0xde,0xa1,0x00,0xff,0xde,0x9f,0x00,0xff,0xde,0x9d,0x00,0xff,0xdd,0x9c,0x1a,0xff,0xd4,0xa7,0x70,0xff,
-    0xc2,0xba,0xb2,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbd,0xbd,0xff,0xc8,0xb0,0xa1,0xff,
-    0xd9,0x90,0x4f,0xff,0xde,0x87,0x0a,0xff,0xde,0x89,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x8d,0x00,0xff,
-    0xde,0x90,0x00,0xff,0xde,0x92,0x00,0xff,0xde,0x94,0x01,0xff,0xe1,0xa0,0x39,0xff,0xec,0xc6,0x86,0xff,
-    0xf4,0xdb,0xa7,0xff,0xf4,0xde,0xaa,0xff,0xf4,0xdf,0xab,0xff,0xf4,0xe0,0xab,0xff,0xf4,0xe1,0xab,0xff,
-    0xf4,0xe1,0xab,0xff,0xf4,0xe2,0xab,0xff,0xf4,0xe2,0xab,0xff,0xf4,0xe3,0xab,0xff,0xf4,0xe4,0xab,0xff,
-    0xf4,0xe4,0xab,0xff,0xf4,0xe3,0xab,0xff,0xf4,0xe3,0xab,0xff,0xf4,0xe2,0xab,0xff,0xf4,0xe1,0xab,0xff,
-    0xf4,0xe0,0xab,0xff,0xf4,0xdf,0xaa,0xff,0xf2,0xd8,0x9f,0xff,0xe7,0xb9,0x6b,0xff,0xdf,0x9c,0x18,0xfc,
-    0xde,0x98,0x00,0xc5,0xde,0x97,0x00,0x36,0xde,0x95,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x73,0x01,0x13,
-    0xde,0x75,0x01,0xa2,0xde,0x78,0x0a,0xfa,0xe6,0x9c,0x5d,0xff,0xf1,0xc7,0x96,0xff,0xf2,0xcd,0x9d,0xff,
-    0xf3,0xcf,0x9d,0xff,0xf3,0xcf,0x9d,0xff,0xf3,0xd0,0x9d,0xff,0xf3,0xd1,0x9d,0xff,0xf3,0xd2,0x9d,0xff,
-    0xf3,0xd3,0x9d,0xff,0xf3,0xd4,0x9d,0xff,0xf3,0xd5,0x9d,0xff,0xf3,0xd6,0x9d,0xff,0xf3,0xd7,0x9d,0xff,
-    0xf3,0xd8,0x9d,0xff,0xf3,0xd9,0x9d,0xff,0xf3,0xda,0x9d,0xff,0xf3,0xda,0x9d,0xff,0xf3,0xdb,0x9d,0xff,
-    0xf3,0xdc,0x9d,0xff,0xf3,0xdd,0x9d,0xff,0xf2,0xde,0x9d,0xff,0xf2,0xdc,0x99,0xff,0xe8,0xc4,0x6b,0xff,
-    0xde,0xab,0x12,0xff,0xde,0xa8,0x00,0xff,0xde,0xa6,0x00,0xff,0xde,0xa4,0x00,0xff,0xde,0xa1,0x00,0xff,
-    0xde,0x9f,0x00,0xff,0xde,0x9d,0x00,0xff,0xde,0x9a,0x04,0xff,0xda,0x9e,0x4a,0xff,0xc6,0xb5,0xa5,0xff,
-    0xbe,0xbe,0xbd,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbf,0xbc,0xbb,0xff,0xce,0xa4,0x8a,0xff,0xdd,0x85,0x26,0xff,0xde,0x84,0x01,0xff,0xde,0x87,0x00,0xff,
-    0xde,0x89,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x8d,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x92,0x02,0xff,
-    0xe3,0xa5,0x49,0xff,0xef,0xce,0x90,0xff,0xf2,0xd7,0x9d,0xff,0xf3,0xd8,0x9d,0xff,0xf3,0xd9,0x9d,0xff,
-    0xf3,0xda,0x9d,0xff,0xf3,0xdb,0x9d,0xff,0xf3,0xdc,0x9d,0xff,0xf3,0xdc,0x9d,0xff,0xf3,0xdd,0x9d,0xff,
-    0xf3,0xde,0x9d,0xff,0xf3,0xdf,0x9d,0xff,0xf3,0xe0,0x9d,0xff,0xf3,0xe0,0x9d,0xff,0xf3,0xdf,0x9d,0xff,
-    0xf3,0xde,0x9d,0xff,0xf3,0xde,0x9d,0xff,0xf3,0xdd,0x9d,0xff,0xf3,0xdc,0x9d,0xff,0xf3,0xdb,0x9d,0xff,
-    0xf2,0xda,0x9d,0xff,0xf2,0xd8,0x9b,0xff,0xeb,0xc3,0x7b,0xff,0xdf,0x9d,0x23,0xff,0xde,0x97,0x00,0xec,
-    0xde,0x95,0x00,0x62,0xde,0x94,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xde,0x6f,0x01,0x17,0xde,0x71,0x01,0xba,0xde,0x74,0x04,0xfd,0xe4,0x95,0x52,0xff,
-    0xf0,0xc1,0x8c,0xff,0xf0,0xc5,0x90,0xff,0xf1,0xc7,0x90,0xff,0xf1,0xc8,0x90,0xff,0xf1,0xc9,0x90,0xff,
-    0xf1,0xca,0x90,0xff,0xf1,0xcb,0x90,0xff,0xf1,0xcc,0x90,0xff,0xf1,0xcd,0x90,0xff,0xf1,0xce,0x90,0xff,
-    0xf1,0xcf,0x90,0xff,0xf1,0xd0,0x90,0xff,0xf1,0xd1,0x90,0xff,0xf1,0xd2,0x90,0xff,0xf1,0xd3,0x90,0xff,
-    0xf1,0xd4,0x90,0xff,0xf1,0xd5,0x90,0xff,0xf1,0xd7,0x90,0xff,0xf1,0xd7,0x90,0xff,0xf1,0xd9,0x90,0xff,
-    0xf1,0xda,0x90,0xff,0xf1,0xda,0x90,0xff,0xf0,0xda,0x8e,0xff,0xe7,0xc3,0x61,0xff,0xde,0xab,0x08,0xff,
-    0xde,0xa8,0x00,0xff,0xde,0xa6,0x00,0xff,0xde,0xa3,0x00,0xff,0xde,0xa1,0x00,0xff,0xde,0x9e,0x00,0xff,
-    0xde,0x9c,0x00,0xff,0xde,0x9a,0x01,0xff,0xdc,0x9b,0x35,0xff,0xc8,0xb3,0x9f,0xff,0xbe,0xbe,0xbd,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbc,0xbb,0xff,0xd1,0x9d,0x7d,0xff,0xdd,0x81,0x16,0xff,
-    0xde,0x82,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x86,0x01,0xff,0xde,0x88,0x00,0xff,0xde,0x8a,0x00,0xff,
-    0xde,0x8d,0x00,0xff,0xde,0x8f,0x00,0xff,0xe2,0x9f,0x3c,0xff,0xee,0xca,0x87,0xff,0xf0,0xd1,0x90,0xff,
-    0xf1,0xd2,0x90,0xff,0xf1,0xd3,0x90,0xff,0xf1,0xd4,0x90,0xff,0xf1,0xd5,0x90,0xff,0xf1,0xd6,0x90,0xff,
-    0xf1,0xd6,0x90,0xff,0xf1,0xd7,0x90,0xff,0xf1,0xd8,0x90,0xff,0xf1,0xd9,0x90,0xff,0xf1,0xda,0x90,0xff,
-    0xf1,0xdb,0x90,0xff,0xf1,0xdb,0x90,0xff,0xf1,0xda,0x90,0xff,0xf1,0xda,0x90,0xff,0xf1,0xd9,0x90,0xff,
-    0xf1,0xd8,0x90,0xff,0xf1,0xd7,0x90,0xff,0xf1,0xd6,0x90,0xff,0xf1,0xd5,0x90,0xff,0xf1,0xd4,0x90,0xff,
-    0xf0,0xd3,0x8f,0xff,0xea,0xc0,0x73,0xff,0xdf,0x99,0x15,0xff,0xde,0x95,0x00,0xf7,0xde,0x93,0x00,0x76,
-    0xde,0x91,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x6c,0x01,0x0f,0xde,0x6e,0x01,0xb6,
-    0xde,0x70,0x01,0xfe,0xe0,0x7e,0x2c,0xff,0xed,0xb5,0x7b,0xff,0xef,0xbd,0x83,0xff,0xef,0xbe,0x83,0xff,
-    0xef,0xbf,0x83,0xff,0xef,0xc0,0x83,0xff,0xef,0xc2,0x83,0xff,0xef,0xc3,0x83,0xff,0xef,0xc4,0x83,0xff,
-    0xef,0xc5,0x83,0xff,0xef,0xc6,0x83,0xff,0xef,0xc7,0x83,0xff,0xef,0xc9,0x83,0xff,0xef,0xca,0x83,0xff,
-    0xef,0xcb,0x83,0xff,0xef,0xcc,0x83,0xff,0xef,0xcd,0x83,0xff,0xef,0xcf,0x83,0xff,0xef,0xd0,0x83,0xff,
-    0xef,0xd1,0x83,0xff,0xef,0xd2,0x83,0xff,0xef,0xd3,0x83,0xff,0xef,0xd4,0x83,0xff,0xef,0xd5,0x83,0xff,
-    0xef,0xd6,0x83,0xff,0xee,0xd4,0x7f,0xff,0xe2,0xb5,0x3d,0xff,0xde,0xa8,0x00,0xff,0xde,0xa6,0x00,0xff,
-    0xde,0xa4,0x00,0xff,0xde,0xa1,0x00,0xff,0xde,0x9f,0x00,0xff,0xde,0x9d,0x00,0xff,0xde,0x9a,0x00,0xff,
-    0xde,0x98,0x00,0xff,0xdc,0x99,0x34,0xff,0xc7,0xb4,0xa4,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,
-    0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbe,0xbe,0xbe,0xff,0xbf,0xbd,0xbc,0xff,
-    0xd0,0x9e,0x83,0xff,0xde,0x7e,0x14,0xff,0xde,0x7f,0x01,0xff,0xde,0x81,0x01,0xff,0xde,0x83,0x01,0xff,
-    0xde,0x85,0x01,0xff,0xde,0x88,0x00,0xff,0xde,0x8a,0x00,0xff,0xde,0x8c,0x00,0xff,0xdf,0x91,0x15,0xff,
-    0xeb,0xbd,0x71,0xff,0xef,0xca,0x82,0xff,0xef,0xcb,0x83,0xff,0xef,0xcc,0x83,0xff,0xef,0xcd,0x83,0xff,
-    0xef,0xce,0x83,0xff,0xef,0xcf,0x83,0xff,0xef,0xd0,0x83,0xff,0xef,0xd1,0x83,0xff,0xef,0xd2,0x83,0xff,
-    0xef,0xd3,0x83,0xff,0xef,0xd4,0x83,0xff,0xef,0xd5,0x83,0xff,0xef,0xd5,0x83,0xff,0xef,0xd6,0x83,0xff,
-    0xef,0xd5,0x83,0xff,0xef,0xd5,0x83,0xff,0xef,0xd4,0x83,0xff,0xef,0xd3,0x83,0xff,0xef,0xd2,0x83,0xff,
-    0xef,0xd1,0x83,0xff,0xef,0xd0,0x83,0xff,0xef,0xcf,0x83,0xff,0xef,0xce,0x83,0xff,0xee,0xcc,0x81,0xff,
-    0xe5,0xae,0x52,0xff,0xde,0x95,0x02,0xff,0xde,0x92,0x00,0xf8,0xde,0x90,0x00,0x6b,0xde,0x90,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xde,0x68,0x01,0x04,0xde,0x6a,0x01,0x8e,0xde,0x6d,0x01,0xfd,0xde,0x6f,0x04,0xff,0xe6,0x96,0x53,0xff,
-    0xed,0xb3,0x76,0xff,0xed,0xb5,0x76,0xff,0xed,0xb6,0x76,0xff,0xed,0xb8,0x76,0xff,0xed,0xb9,0x76,0xff,
-    0xed,0xba,0x76,0xff,0xed,0xbb,0x76,0xff,0xed,0xbd,0x76,0xff,0xed,0xbe,0x75,0xff,0xed,0xbf,0x75,0xff,
-    0xed,0xc1,0x75,0xff,0xed,0xc2,0x75,0xff,0xed,0xc3,0x75,0xff,0xed,0xc5,0x75,0xff,0xed,0xc6,0x75,0xff,
-    0xed,0xc7,0x75,0xff,0xed,0xc9,0x75,0xff,0xed,0xca,0x75,0xff,0xed,0xcb,0x75,0xff,0xed,0xcc,0x75,0xff,
-    0xed,0xcd,0x75,0xff,0xed,0xce,0x75,0xff,0xed,0xcf,0x75,0xff,0xed,0xd0,0x75,0xff,0xed,0xd0,0x75,0xff,
-    0xe8,0xc4,0x5e,0xff,0xde,0xa8,0x08,0xff,0xde,0xa5,0x00,0xff,0xde,0xa3,0x00,0xff,0xde,0xa1,0x00,0xff,
-    0xde,0x9f,0x00,0xff,0xde,0x9d,0x00,0xff,0xde,0x9b,0x00,0xff,0xde,0x98,0x00,0xff,0xde,0x96,0x01,0xff,
-    0xd9,0x9a,0x47,0xff,0xab,0xa1,0x9a,0xff,0xa2,0xa2,0xa2,0xff,0xa9,0xa9,0xa9,0xff,0xad,0xad,0xad,0xff,
-    0xb3,0xb3,0xb3,0xff,0xb5,0xb5,0xb5,0xff,0xb7,0xb7,0xb7,0xff,0xb9,0xb9,0xb9,0xff,0xbb,0xbb,0xbb,0xff,
-    0xbb,0xbb,0xbb,0xff,0xbb,0xbb,0xbb,0xff,0xca,0xa8,0x98,0xff,0xdd,0x7c,0x1d,0xff,0xde,0x7c,0x01,0xff,
-    0xde,0x7e,0x01,0xff,0xde,0x80,0x01,0xff,0xde,0x83,0x01,0xff,0xde,0x85,0x01,0xff,0xde,0x87,0x00,0xff,
-    0xde,0x89,0x00,0xff,0xde,0x8b,0x00,0xff,0xe3,0xa0,0x40,0xff,0xed,0xc2,0x74,0xff,0xed,0xc4,0x75,0xff,
-    0xed,0xc5,0x75,0xff,0xed,0xc6,0x75,0xff,0xed,0xc7,0x75,0xff,0xed,0xc8,0x75,0xff,0xed,0xc9,0x75,0xff,
-    0xed,0xca,0x75,0xff,0xed,0xcb,0x75,0xff,0xed,0xcc,0x75,0xff,0xed,0xce,0x75,0xff,0xed,0xce,0x75,0xff,
-    0xed,0xcf,0x75,0xff,0xed,0xd0,0x75,0xff,0xed,0xd0,0x75,0xff,0xed,0xd0,0x75,0xff,0xed,0xcf,0x75,0xff,
-    0xed,0xce,0x75,0xff,0xed,0xce,0x75,0xff,0xed,0xcd,0x75,0xff,0xed,0xcc,0x75,0xff,0xed,0xcb,0x75,0xff,
-    0xed,0xca,0x75,0xff,0xed,0xc8,0x75,0xff,0xed,0xc7,0x75,0xff,0xeb,0xbf,0x6b,0xff,0xdf,0x97,0x13,0xff,
-    0xde,0x92,0x00,0xff,0xde,0x90,0x00,0xf1,0xde,0x8e,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x67,0x01,0x43,0xde,0x69,0x01,0xf5,
-    0xde,0x6b,0x01,0xff,0xde,0x6f,0x0b,0xff,0xe8,0x9f,0x5b,0xff,0xec,0xac,0x69,0xff,0xec,0xad,0x69,0xff,
-    0xec,0xae,0x69,0xff,0xec,0xb0,0x69,0xff,0xec,0xb1,0x69,0xff,0xec,0xb3,0x69,0xff,0xec,0xb4,0x69,0xff,
-    0xec,0xb5,0x69,0xff,0xec,0xb7,0x68,0xff,0xec,0xb8,0x68,0xff,0xec,0xba,0x68,0xff,0xec,0xbb,0x68,0xff,
-    0xec,0xbc,0x68,0xff,0xec,0xbe,0x68,0xff,0xec,0xbf,0x68,0xff,0xec,0xc1,0x68,0xff,0xec,0xc2,0x68,0xff,
-    0xec,0xc3,0x68,0xff,0xec,0xc4,0x68,0xff,0xec,0xc6,0x68,0xff,0xec,0xc7,0x68,0xff,0xec,0xc8,0x68,0xff,
-    0xec,0xc9,0x68,0xff,0xec,0xc9,0x68,0xff,0xec,0xc9,0x68,0xff,0xea,0xc6,0x62,0xff,0xdf,0xa6,0x12,0xff,
-    0xde,0xa3,0x00,0xff,0xde,0xa2,0x00,0xff,0xde,0xa0,0x00,0xff,0xde,0x9e,0x00,0xff,0xde,0x9c,0x00,0xff,
-    0xde,0x9a,0x00,0xff,0xde,0x98,0x00,0xff,0xde,0x96,0x00,0xff,0xde,0x93,0x01,0xff,0xb2,0x76,0x13,0xff,
-    0x27,0x1f,0x19,0xff,0x1e,0x1e,0x1e,0xff,0x20,0x20,0x20,0xff,0x24,0x24,0x24,0xff,0x26,0x26,0x26,0xff,
-    0x2d,0x2d,0x2d,0xff,0x36,0x36,0x36,0xff,0x3c,0x3c,0x3c,0xff,0x3e,0x3e,0x3e,0xff,0x65,0x4b,0x40,0xff,
-    0xd4,0x76,0x25,0xff,0xde,0x79,0x01,0xff,0xde,0x7b,0x01,0xff,0xde,0x7e,0x01,0xff,0xde,0x80,0x01,0xff,
-    0xde,0x82,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x86,0x01,0xff,0xde,0x88,0x00,0xff,0xde,0x8b,0x03,0xff,
-    0xe6,0xa9,0x4e,0xff,0xeb,0xbc,0x68,0xff,0xec,0xbe,0x68,0xff,0xec,0xbf,0x68,0xff,0xec,0xc0,0x68,0xff,
-    0xec,0xc1,0x68,0xff,0xec,0xc2,0x68,0xff,0xec,0xc3,0x68,0xff,0xec,0xc4,0x68,0xff,0xec,0xc6,0x68,0xff,
-    0xec,0xc7,0x68,0xff,0xec,0xc7,0x68,0xff,0xec,0xc8,0x68,0xff,0xec,0xc9,0x68,0xff,0xec,0xc9,0x68,0xff,
-    0xec,0xca,0x68,0xff,0xec,0xca,0x68,0xff,0xec,0xc9,0x68,0xff,0xec,0xc9,0x68,0xff,0xec,0xc8,0x68,0xff,
-    0xec,0xc7,0x68,0xff,0xec,0xc6,0x68,0xff,0xec,0xc5,0x68,0xff,0xec,0xc4,0x68,0xff,0xec,0xc3,0x68,0xff,
-    0xec,0xc1,0x68,0xff,0xeb,0xbf,0x66,0xff,0xe1,0x9e,0x2c,0xff,0xde,0x92,0x00,0xff,0xde,0x90,0x00,0xff,
-    0xde,0x8e,0x00,0xcd,0xde,0x8c,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xde,0x64,0x01,0x07,0xde,0x65,0x01,0xbd,0xde,0x67,0x01,0xff,0xde,0x69,0x01,0xff,0xde,0x6e,0x0c,0xff,
-    0xe8,0x9c,0x54,0xff,0xea,0xa3,0x5b,0xff,0xea,0xa5,0x5b,0xff,0xea,0xa6,0x5b,0xff,0xea,0xa8,0x5b,0xff,
-    0xea,0xa9,0x5b,0xff,0xea,0xab,0x5b,0xff,0xea,0xac,0x5b,0xff,0xea,0xae,0x5b,0xff,0xea,0xaf,0x5b,0xff,
-    0xea,0xb1,0x5b,0xff,0xea,0xb2,0x5a,0xff,0xea,0xb4,0x5a,0xff,0xea,0xb5,0x5a,0xff,0xea,0xb7,0x5a,0xff,
-    0xea,0xb8,0x5a,0xff,0xea,0xb9,0x5a,0xff,0xea,0xbb,0x5a,0xff,0xea,0xbc,0x5a,0xff,0xea,0xbd,0x5a,0xff,
-    0xea,0xbf,0x5a,0xff,0xea,0xc0,0x5a,0xff,0xea,0xc1,0x5a,0xff,0xea,0xc2,0x5a,0xff,0xea,0xc2,0x5a,0xff,
-    0xea,0xc2,0x5a,0xff,0xe9,0xc1,0x58,0xff,0xdf,0xa5,0x19,0xff,0xde,0xa0,0x00,0xff,0xde,0x9f,0x00,0xff,
-    0xde,0x9e,0x00,0xff,0xde,0x9c,0x00,0xff,0xde,0x9b,0x00,0xff,0xde,0x99,0x00,0xff,0xde,0x97,0x00,0xff,
-    0xde,0x95,0x00,0xff,0xde,0x93,0x00,0xff,0xda,0x8e,0x00,0xff,0x6b,0x43,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x10,0x04,0x00,0xff,0xa6,0x56,0x01,0xff,0xdd,0x76,0x01,0xff,0xde,0x79,0x01,0xff,
-    0xde,0x7b,0x01,0xff,0xde,0x7d,0x01,0xff,0xde,0x7f,0x01,0xff,0xde,0x81,0x01,0xff,0xde,0x83,0x01,0xff,
-    0xde,0x85,0x01,0xff,0xde,0x87,0x00,0xff,0xde,0x8a,0x04,0xff,0xe6,0xa8,0x49,0xff,0xea,0xb6,0x5a,0xff,
-    0xea,0xb7,0x5a,0xff,0xea,0xb8,0x5a,0xff,0xea,0xba,0x5a,0xff,0xea,0xbb,0x5a,0xff,0xea,0xbc,0x5a,0xff,
-    0xea,0xbd,0x5a,0xff,0xea,0xbe,0x5a,0xff,0xea,0xbf,0x5a,0xff,0xea,0xc0,0x5a,0xff,0xea,0xc1,0x5a,0xff,
-    0xea,0xc2,0x5a,0xff,0xea,0xc3,0x5a,0xff,0xea,0xc3,0x5a,0xff,0xea,0xc4,0x5a,0xff,0xea,0xc4,0x5a,0xff,
-    0xea,0xc3,0x5a,0xff,0xea,0xc3,0x5a,0xff,0xea,0xc2,0x5a,0xff,0xea,0xc1,0x5a,0xff,0xea,0xc0,0x5a,0xff,
-    0xea,0xbf,0x5a,0xff,0xea,0xbe,0x5a,0xff,0xea,0xbd,0x5a,0xff,0xea,0xbc,0x5a,0xff,0xe9,0xba,0x59,0xff,
-    0xe1,0x9f,0x2e,0xff,0xde,0x91,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8d,0x00,0xfc,0xde,0x8b,0x00,0x69,
-    0xdd,0x8b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x61,0x01,0x3a,0xde,0x63,0x01,0xf7,
-    0xde,0x65,0x01,0xff,0xde,0x68,0x01,0xff,0xde,0x6b,0x07,0xff,0xe6,0x90,0x44,0xff,0xe8,0x9a,0x4e,0xff,
-    0xe8,0x9c,0x4e,0xff,0xe8,0x9e,0x4e,0xff,0xe8,0x9f,0x4e,0xff,0xe8,0xa1,0x4e,0xff,0xe8,0xa3,0x4e,0xff,
-    0xe8,0xa4,0x4e,0xff,0xe8,0xa6,0x4e,0xff,0xe8,0xa7,0x4e,0xff,0xe8,0xa9,0x4e,0xff,0xe8,0xaa,0x4d,0xff,
-    0xe8,0xac,0x4d,0xff,0xe8,0xae,0x4d,0xff,0xe8,0xaf,0x4d,0xff,0xe8,0xb1,0x4d,0xff,0xe8,0xb2,0x4d,0xff,
-    0xe8,0xb3,0x4d,0xff,0xe8,0xb4,0x4d,0xff,0xe8,0xb6,0x4d,0xff,0xe8,0xb7,0x4d,0xff,0xe8,0xb8,0x4d,0xff,
-    0xe8,0xb9,0x4d,0xff,0xe8,0xba,0x4d,0xff,0xe8,0xbb,0x4d,0xff,0xe8,0xbb,0x4d,0xff,0xe7,0xb9,0x49,0xff,
-    0xdf,0x9f,0x0c,0xff,0xde,0x9d,0x00,0xff,0xde,0x9c,0x00,0xff,0xde,0x9c,0x00,0xff,0xde,0x9a,0x00,0xff,
-    0xde,0x99,0x00,0xff,0xde,0x97,0x00,0xff,0xde,0x95,0x00,0xff,0xde,0x93,0x00,0xff,0xde,0x92,0x00,0xff,
-    0xde,0x8f,0x00,0xff,0xae,0x6e,0x00,0xff,0x13,0x08,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x3f,0x1c,0x00,0xff,
-    0xd3,0x6d,0x01,0xff,0xde,0x76,0x01,0xff,0xde,0x78,0x01,0xff,0xde,0x7a,0x01,0xff,0xde,0x7c,0x01,0xff,
-    0xde,0x7e,0x01,0xff,0xde,0x80,0x01,0xff,0xde,0x82,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x86,0x01,0xff,
-    0xde,0x88,0x02,0xff,0xe4,0xa0,0x3a,0xff,0xe8,0xaf,0x4d,0xff,0xe8,0xb0,0x4d,0xff,0xe8,0xb1,0x4d,0xff,
-    0xe8,0xb3,0x4d,0xff,0xe8,0xb4,0x4d,0xff,0xe8,0xb5,0x4d,0xff,0xe8,0xb7,0x4d,0xff,0xe8,0xb8,0x4d,0xff,
-    0xe8,0xb9,0x4d,0xff,0xe8,0xba,0x4d,0xff,0xe8,0xbb,0x4d,0xff,0xe8,0xbc,0x4d,0xff,0xe8,0xbc,0x4d,0xff,
-    0xe8,0xbd,0x4d,0xff,0xe8,0xbd,0x4d,0xff,0xe8,0xbd,0x4d,0xff,0xe8,0xbd,0x4d,0xff,0xe8,0xbc,0x4d,0xff,
-    0xe8,0xbc,0x4d,0xff,0xe8,0xbb,0x4d,0xff,0xe8,0xba,0x4d,0xff,0xe8,0xb9,0x4d,0xff,0xe8,0xb8,0x4d,0xff,
-    0xe8,0xb7,0x4d,0xff,0xe8,0xb5,0x4d,0xff,0xe8,0xb3,0x4c,0xff,0xe0,0x9a,0x21,0xff,0xde,0x90,0x00,0xff,
-    0xde,0x8e,0x00,0xff,0xde,0x8c,0x00,0xff,0xde,0x8b,0x00,0xcc,0xde,0x8a,0x00,0x08,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xde,0x5e,0x01,0x01,0xde,0x5f,0x01,0x85,0xde,0x61,0x01,0xfe,0xde,0x63,0x01,0xff,0xde,0x66,0x01,0xff,
-    0xde,0x68,0x02,0xff,0xe3,0x80,0x2e,0xff,0xe6,0x91,0x41,0xff,0xe7,0x93,0x41,0xff,0xe7,0x95,0x41,0xff,
-    0xe7,0x96,0x41,0xff,0xe7,0x98,0x41,0xff,0xe7,0x9a,0x41,0xff,0xe7,0x9c,0x41,0xff,0xe7,0x9d,0x41,0xff,
-    0xe7,0x9f,0x41,0xff,0xe7,0xa0,0x41,0xff,0xe7,0xa2,0x41,0xff,0xe7,0xa4,0x40,0xff,0xe7,0xa5,0x40,0xff,
-    0xe7,0xa7,0x40,0xff,0xe7,0xa8,0x40,0xff,0xe7,0xaa,0x40,0xff,0xe7,0xab,0x40,0xff,0xe7,0xac,0x40,0xff,
-    0xe7,0xae,0x40,0xff,0xe7,0xaf,0x40,0xff,0xe7,0xb0,0x40,0xff,0xe7,0xb1,0x40,0xff,0xe7,0xb2,0x40,0xff,
-    0xe7,0xb2,0x40,0xff,0xe6,0xb3,0x40,0xff,0xe4,0xac,0x34,0xff,0xde,0x9a,0x03,0xff,0xde,0x9a,0x00,0xff,
-    0xde,0x99,0x00,0xff,0xde,0x99,0x00,0xff,0xde,0x98,0x00,0xff,0xde,0x96,0x00,0xff,0xde,0x95,0x00,0xff,
-    0xde,0x93,0x00,0xff,0xde,0x92,0x00,0xff,0xde,0x90,0x00,0xff,0xde,0x8e,0x00,0xff,0xd0,0x83,0x00,0xff,
-    0x31,0x1b,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x80,0x3f,0x00,0xff,0xdc,0x72,0x01,0xff,0xde,0x75,0x01,0xff,
-    0xde,0x77,0x01,0xff,0xde,0x79,0x01,0xff,0xde,0x7b,0x01,0xff,0xde,0x7d,0x01,0xff,0xde,0x7f,0x01,0xff,
-    0xde,0x81,0x01,0xff,0xde,0x83,0x01,0xff,0xde,0x85,0x01,0xff,0xde,0x87,0x00,0xff,0xe1,0x93,0x23,0xff,
-    0xe6,0xa7,0x3f,0xff,0xe7,0xa9,0x40,0xff,0xe7,0xaa,0x40,0xff,0xe7,0xac,0x40,0xff,0xe7,0xad,0x40,0xff,
-    0xe7,0xaf,0x40,0xff,0xe7,0xb0,0x40,0xff,0xe7,0xb1,0x40,0xff,0xe7,0xb2,0x40,0xff,0xe7,0xb3,0x40,0xff,
-    0xe7,0xb4,0x40,0xff,0xe7,0xb5,0x40,0xff,0xe7,0xb5,0x40,0xff,0xe7,0xb6,0x40,0xff,0xe7,0xb6,0x40,0xff,
-    0xe7,0xb6,0x40,0xff,0xe7,0xb6,0x40,0xff,0xe7,0xb5,0x40,0xff,0xe7,0xb5,0x40,0xff,0xe7,0xb4,0x40,0xff,
-    0xe7,0xb3,0x40,0xff,0xe7,0xb2,0x40,0xff,0xe7,0xb1,0x40,0xff,0xe7,0xb0,0x40,0xff,0xe7,0xaf,0x40,0xff,
-    0xe5,0xaa,0x3b,0xff,0xdf,0x93,0x08,0xff,0xde,0x8f,0x00,0xff,0xde,0x8d,0x00,0xff,0xde,0x8c,0x00,0xff,
-    0xde,0x8a,0x00,0xf7,0xde,0x88,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x5d,0x01,0x05,0xde,0x5d,0x01,0xb8,
-    0xde,0x5f,0x01,0xff,0xde,0x61,0x01,0xff,0xde,0x64,0x01,0xff,0xde,0x66,0x01,0xff,0xdf,0x6d,0x10,0xff,
-    0xe4,0x85,0x31,0xff,0xe5,0x8a,0x33,0xff,0xe5,0x8c,0x33,0xff,0xe5,0x8d,0x33,0xff,0xe5,0x8f,0x33,0xff,
-    0xe5,0x91,0x33,0xff,0xe5,0x93,0x33,0xff,0xe5,0x94,0x33,0xff,0xe5,0x96,0x33,0xff,0xe5,0x98,0x33,0xff,
-    0xe5,0x99,0x33,0xff,0xe5,0x9b,0x33,0xff,0xe5,0x9d,0x33,0xff,0xe5,0x9e,0x32,0xff,0xe5,0xa0,0x32,0xff,
-    0xe5,0xa1,0x32,0xff,0xe5,0xa3,0x32,0xff,0xe5,0xa4,0x32,0xff,0xe5,0xa5,0x32,0xff,0xe5,0xa7,0x32,0xff,
-    0xe5,0xa8,0x32,0xff,0xe5,0xa9,0x32,0xff,0xe5,0xaa,0x32,0xff,0xe5,0xaa,0x32,0xff,0xe4,0xaa,0x31,0xff,
-    0xe0,0x9c,0x17,0xff,0xde,0x97,0x00,0xff,0xde,0x96,0x00,0xff,0xde,0x96,0x00,0xff,0xde,0x95,0x00,0xff,
-    0xde,0x95,0x00,0xff,0xde,0x94,0x00,0xff,0xde,0x92,0x00,0xff,0xde,0x91,0x00,0xff,0xde,0x90,0x00,0xff,
-    0xde,0x8e,0x00,0xff,0xde,0x8c,0x00,0xff,0xdb,0x89,0x00,0xff,0x61,0x3a,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x06,0x01,0x00,0xff,
-    0xa3,0x51,0x01,0xff,0xde,0x71,0x01,0xff,0xde,0x74,0x01,0xff,0xde,0x76,0x01,0xff,0xde,0x78,0x01,0xff,
-    0xde,0x7a,0x01,0xff,0xde,0x7c,0x01,0xff,0xde,0x7e,0x01,0xff,0xde,0x80,0x01,0xff,0xde,0x82,0x01,0xff,
-    0xde,0x84,0x01,0xff,0xde,0x85,0x01,0xff,0xde,0x88,0x05,0xff,0xe3,0x9c,0x2c,0xff,0xe4,0xa2,0x32,0xff,
-    0xe5,0xa3,0x32,0xff,0xe5,0xa5,0x32,0xff,0xe5,0xa6,0x32,0xff,0xe5,0xa7,0x32,0xff,0xe5,0xa9,0x32,0xff,
-    0xe5,0xaa,0x32,0xff,0xe5,0xab,0x32,0xff,0xe5,0xac,0x32,0xff,0xe5,0xad,0x32,0xff,0xe5,0xae,0x32,0xff,
-    0xe5,0xae,0x32,0xff,0xe5,0xaf,0x32,0xff,0xe5,0xaf,0x32,0xff,0xe5,0xaf,0x32,0xff,0xe5,0xaf,0x32,0xff,
-    0xe5,0xae,0x32,0xff,0xe5,0xae,0x32,0xff,0xe5,0xad,0x32,0xff,0xe5,0xad,0x32,0xff,0xe5,0xac,0x32,0xff,
-    0xe5,0xaa,0x32,0xff,0xe5,0xaa,0x32,0xff,0xe4,0xa8,0x32,0xff,0xe1,0x9c,0x20,0xff,0xde,0x90,0x01,0xff,
-    0xde,0x8e,0x00,0xff,0xde,0x8c,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x89,0x00,0xfc,0xde,0x87,0x00,0x62,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xde,0x5d,0x01,0x08,0xde,0x5d,0x01,0xd5,0xde,0x5d,0x01,0xff,0xde,0x5f,0x01,0xff,
-    0xde,0x61,0x01,0xff,0xde,0x64,0x01,0xff,0xde,0x66,0x01,0xff,0xe0,0x71,0x16,0xff,0xe2,0x7f,0x25,0xff,
-    0xe3,0x82,0x26,0xff,0xe3,0x83,0x26,0xff,0xe3,0x85,0x26,0xff,0xe3,0x87,0x26,0xff,0xe3,0x89,0x26,0xff,
-    0xe3,0x8b,0x26,0xff,0xe3,0x8d,0x26,0xff,0xe3,0x8f,0x26,0xff,0xe3,0x90,0x26,0xff,0xe3,0x92,0x26,0xff,
-    0xe3,0x94,0x26,0xff,0xe3,0x95,0x26,0xff,0xe3,0x97,0x26,0xff,0xe3,0x98,0x25,0xff,0xe3,0x9a,0x25,0xff,
-    0xe3,0x9b,0x25,0xff,0xe3,0x9d,0x25,0xff,0xe3,0x9e,0x25,0xff,0xe3,0x9f,0x25,0xff,0xe3,0xa0,0x25,0xff,
-    0xe3,0xa1,0x25,0xff,0xe2,0xa1,0x25,0xff,0xe0,0x9b,0x19,0xff,0xde,0x93,0x01,0xff,0xde,0x93,0x00,0xff,
-    0xde,0x93,0x00,0xff,0xde,0x93,0x00,0xff,0xde,0x92,0x00,0xff,0xde,0x92,0x00,0xff,0xde,0x91,0x00,0xff,
-    0xde,0x90,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8d,0x00,0xff,0xde,0x8c,0x00,0xff,0xde,0x8a,0x00,0xff,
-    0xdc,0x88,0x00,0xff,0x7b,0x49,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x14,0x05,0x00,0xff,0xb2,0x57,0x01,0xff,0xde,0x70,0x01,0xff,
-    0xde,0x72,0x01,0xff,0xde,0x74,0x01,0xff,0xde,0x76,0x01,0xff,0xde,0x78,0x01,0xff,0xde,0x7a,0x01,0xff,
-    0xde,0x7c,0x01,0xff,0xde,0x7e,0x01,0xff,0xde,0x80,0x01,0xff,0xde,0x82,0x01,0xff,0xde,0x84,0x01,0xff,
-    0xde,0x86,0x01,0xff,0xdf,0x8c,0x0e,0xff,0xe2,0x99,0x23,0xff,0xe3,0x9c,0x25,0xff,0xe3,0x9d,0x25,0xff,
-    0xe3,0x9f,0x25,0xff,0xe3,0xa0,0x25,0xff,0xe3,0xa1,0x25,0xff,0xe3,0xa3,0x25,0xff,0xe3,0xa4,0x25,0xff,
-    0xe3,0xa5,0x25,0xff,0xe3,0xa5,0x25,0xff,0xe3,0xa6,0x25,0xff,0xe3,0xa7,0x25,0xff,0xe3,0xa7,0x25,0xff,
-    0xe3,0xa8,0x25,0xff,0xe3,0xa8,0x25,0xff,0xe3,0xa8,0x25,0xff,0xe3,0xa7,0x25,0xff,0xe3,0xa7,0x25,0xff,
-    0xe3,0xa6,0x25,0xff,0xe3,0xa5,0x25,0xff,0xe3,0xa5,0x25,0xff,0xe3,0xa4,0x25,0xff,0xe2,0xa3,0x25,0xff,
-    0xe1,0x9d,0x1e,0xff,0xde,0x91,0x03,0xff,0xde,0x8f,0x00,0xff,0xde,0x8d,0x00,0xff,0xde,0x8b,0x00,0xff,
-    0xde,0x89,0x00,0xff,0xde,0x88,0x00,0xfe,0xde,0x86,0x00,0x7f,0xde,0x85,0x01,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x5d,0x01,0x08,
-    0xde,0x5d,0x01,0xdc,0xde,0x5d,0x01,0xff,0xde,0x5d,0x01,0xff,0xde,0x5f,0x01,0xff,0xde,0x61,0x01,0xff,
-    0xde,0x64,0x01,0xff,0xde,0x66,0x02,0xff,0xdf,0x6e,0x0f,0xff,0xe1,0x77,0x18,0xff,0xe1,0x7a,0x19,0xff,
-    0xe1,0x7c,0x19,0xff,0xe1,0x7e,0x19,0xff,0xe1,0x7f,0x19,0xff,0xe1,0x81,0x19,0xff,0xe1,0x83,0x19,0xff,
-    0xe1,0x85,0x19,0xff,0xe1,0x87,0x19,0xff,0xe1,0x89,0x19,0xff,0xe1,0x8a,0x19,0xff,0xe1,0x8c,0x19,0xff,
-    0xe1,0x8e,0x19,0xff,0xe1,0x8f,0x19,0xff,0xe1,0x90,0x18,0xff,0xe1,0x92,0x18,0xff,0xe1,0x93,0x18,0xff,
-    0xe1,0x94,0x18,0xff,0xe1,0x96,0x18,0xff,0xe1,0x97,0x18,0xff,0xe1,0x97,0x18,0xff,0xe0,0x94,0x10,0xff,
-    0xde,0x8f,0x01,0xff,0xde,0x8f,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8f,0x00,0xff,
-    0xde,0x8f,0x00,0xff,0xde,0x8e,0x00,0xff,0xde,0x8e,0x00,0xff,0xde,0x8d,0x00,0xff,0xde,0x8c,0x00,0xff,
-    0xde,0x8b,0x00,0xff,0xde,0x89,0x00,0xff,0xde,0x88,0x00,0xff,0xdc,0x86,0x00,0xff,0x80,0x4b,0x00,0xff,
-    0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,
-    0x18,0x06,0x00,0xff,0xb6,0x58,0x01,0xff,0xde,0x6f,0x01,0xff,0xde,0x71,0x01,0xff,0xde,0x73,0x01,0xff,
-    0xde,0x75,0x01,0xff,0xde,0x77,0x01,0xff,0xde,0x79,0x01,0xff,0xde,0x7b,0x01,0xff,0xde,0x7d,0x01,0xff,
-    0xde,0x7f,0x01,0xff,0xde,0x81,0x01,0xff,0xde,0x82,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x86,0x01,0xff,
-    0xdf,0x8b,0x09,0xff,0xe1,0x93,0x16,0xff,0xe1,0x96,0x18,0xff,0xe1,0x97,0x18,0xff,0xe1,0x98,0x18,0xff,
-    0xe1,0x9a,0x18,0xff,0xe1,0x9b,0x18,0xff,0xe1,0x9c,0x18,0xff,0xe1,0x9d,0x18,0xff,0xe1,0x9e,0x18,0xff,
-    0xe1,0x9f,0x18,0xff,0xe1,0x9f,0x18,0xff,0xe1,0xa0,0x18,0xff,0xe1,0xa0,0x18,0xff,0xe1,0xa0,0x18,0xff,
-    0xe1,0xa0,0x18,0xff,0xe1,0xa0,0x18,0xff,0xe1,0x9f,0x18,0xff,0xe1,0x9f,0x18,0xff,0xe1,0x9e,0x18,0xff,
-    0xe1,0x9d,0x18,0xff,0xe1,0x9c,0x18,0xff,0xe0,0x98,0x13,0xff,0xde,0x91,0x03,0xff,0xde,0x8f,0x00,0xff,
-    0xde,0x8d,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x8a,0x00,0xff,0xde,0x88,0x00,0xff,0xde,0x86,0x00,0xff,
-    0xde,0x85,0x01,0x86,0xde,0x85,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x5d,0x01,0x07,0xde,0x5d,0x01,0xc7,0xde,0x5d,0x01,0xff,
-    0xde,0x5d,0x01,0xff,0xde,0x5d,0x01,0xff,0xde,0x5f,0x01,0xff,0xde,0x61,0x01,0xff,0xde,0x63,0x01,0xff,
-    0xde,0x65,0x01,0xff,0xde,0x69,0x05,0xff,0xdf,0x6f,0x0a,0xff,0xe0,0x72,0x0b,0xff,0xe0,0x73,0x0b,0xff,
-    0xe0,0x75,0x0b,0xff,0xe0,0x77,0x0b,0xff,0xe0,0x79,0x0b,0xff,0xe0,0x7b,0x0b,0xff,0xe0,0x7d,0x0b,0xff,
-    0xe0,0x7f,0x0b,0xff,0xe0,0x81,0x0b,0xff,0xe0,0x82,0x0b,0xff,0xe0,0x84,0x0b,0xff,0xe0,0x85,0x0b,0xff,
-    0xe0,0x87,0x0b,0xff,0xe0,0x88,0x0b,0xff,0xe0,0x8a,0x0b,0xff,0xe0,0x8b,0x0b,0xff,0xe0,0x8c,0x0a,0xff,
-    0xdf,0x8d,0x0a,0xff,0xdf,0x8b,0x05,0xff,0xde,0x8a,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x8b,0x00,0xff,
-    0xde,0x8b,0x00,0xff,0xde,0x8c,0x00,0xff,0xde,0x8c,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x8b,0x00,0xff,
-    0xde,0x8a,0x00,0xff,0xde,0x8a,0x00,0xff,0xde,0x89,0x00,0xff,0xde,0x88,0x00,0xff,0xde,0x87,0x00,0xff,
-    0xde,0x86,0x01,0xff,0xdc,0x83,0x01,0xff,0x71,0x40,0x00,0xfd,0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xfd,
-    0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xfd,0x00,0x00,0x00,0xfd,0x0e,0x03,0x00,0xfd,0xab,0x52,0x01,0xfe,
-    0xde,0x6e,0x01,0xff,0xde,0x70,0x01,0xff,0xde,0x72,0x01,0xff,0xde,0x74,0x01,0xff,0xde,0x76,0x01,0xff,
-    0xde,0x77,0x01,0xff,0xde,0x79,0x01,0xff,0xde,0x7b,0x01,0xff,0xde,0x7d,0x01,0xff,0xde,0x7f,0x01,0xff,
-    0xde,0x81,0x01,0xff,0xde,0x82,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x86,0x01,0xff,0xde,0x89,0x02,0xff,
-    0xdf,0x8d,0x08,0xff,0xe0,0x8f,0x0a,0xff,0xe0,0x91,0x0a,0xff,0xe0,0x92,0x0a,0xff,0xe0,0x93,0x0a,0xff,
-    0xe0,0x94,0x0a,0xff,0xe0,0x95,0x0a,0xff,0xe0,0x96,0x0a,0xff,0xe0,0x97,0x0a,0xff,0xe0,0x97,0x0a,0xff,
-    0xe0,0x98,0x0a,0xff,0xe0,0x98,0x0a,0xff,0xe0,0x99,0x0a,0xff,0xe0,0x99,0x0a,0xff,0xe0,0x98,0x0a,0xff,
-    0xe0,0x98,0x0a,0xff,0xe0,0x97,0x0a,0xff,0xe0,0x97,0x0a,0xff,0xdf,0x96,0x0a,0xff,0xdf,0x93,0x06,0xff,
-    0xde,0x90,0x01,0xff,0xde,0x8e,0x00,0xff,0xde,0x8d,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x8a,0x00,0xff,
-    0xde,0x88,0x00,0xff,0xde,0x87,0x00,0xff,0xde,0x85,0x01,0xfe,0xde,0x84,0x01,0x72,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xde,0x5d,0x01,0x02,0xde,0x5d,0x01,0x89,0xde,0x5d,0x01,0xfe,0xde,0x5d,0x01,0xff,0xde,0x5d,0x01,0xff,
-    0xde,0x5d,0x01,0xff,0xde,0x5f,0x01,0xff,0xde,0x61,0x01,0xff,0xde,0x63,0x01,0xff,0xde,0x65,0x01,0xff,
-    0xde,0x67,0x01,0xff,0xde,0x6a,0x02,0xff,0xde,0x6c,0x02,0xff,0xde,0x6e,0x02,0xff,0xde,0x70,0x02,0xff,
-    0xde,0x71,0x02,0xff,0xde,0x73,0x02,0xff,0xde,0x75,0x02,0xff,0xde,0x77,0x02,0xff,0xde,0x79,0x02,0xff,
-    0xde,0x7a,0x02,0xff,0xde,0x7c,0x02,0xff,0xde,0x7d,0x02,0xff,0xde,0x7f,0x02,0xff,0xde,0x80,0x02,0xff,
-    0xde,0x82,0x02,0xff,0xde,0x83,0x02,0xff,0xde,0x84,0x02,0xff,0xde,0x85,0x01,0xff,0xde,0x85,0x01,0xff,
-    0xde,0x86,0x01,0xff,0xde,0x87,0x00,0xff,0xde,0x87,0x00,0xff,0xde,0x88,0x00,0xff,0xde,0x88,0x00,0xff,
-    0xde,0x88,0x00,0xff,0xde,0x88,0x00,0xff,0xde,0x88,0x00,0xff,0xde,0x87,0x00,0xff,0xde,0x87,0x00,0xff,
-    0xde,0x86,0x01,0xff,0xde,0x85,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x83,0x01,0xff,0xdc,0x81,0x01,0xe6,
-    0x5b,0x33,0x00,0x6b,0x00,0x00,0x00,0x67,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x6a,0x00,0x00,0x00,0x6c,
-    0x00,0x00,0x00,0x6d,0x01,0x00,0x00,0x6d,0xad,0x52,0x01,0x93,0xde,0x6c,0x01,0xfb,0xde,0x6e,0x01,0xff,
-    0xde,0x70,0x01,0xff,0xde,0x72,0x01,0xff,0xde,0x74,0x01,0xff,0xde,0x76,0x01,0xff,0xde,0x78,0x01,0xff,
-    0xde,0x7a,0x01,0xff,0xde,0x7b,0x01,0xff,0xde,0x7d,0x01,0xff,0xde,0x7f,0x01,0xff,0xde,0x81,0x01,0xff,
-    0xde,0x82,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x86,0x01,0xff,0xde,0x87,0x00,0xff,0xde,0x89,0x01,0xff,
-    0xde,0x8a,0x01,0xff,0xde,0x8b,0x01,0xff,0xde,0x8d,0x01,0xff,0xde,0x8e,0x01,0xff,0xde,0x8f,0x01,0xff,
-    0xde,0x90,0x01,0xff,0xde,0x90,0x01,0xff,0xde,0x91,0x01,0xff,0xde,0x92,0x01,0xff,0xde,0x92,0x01,0xff,
-    0xde,0x92,0x01,0xff,0xde,0x92,0x01,0xff,0xde,0x92,0x01,0xff,0xde,0x92,0x01,0xff,0xde,0x91,0x01,0xff,
-    0xde,0x90,0x01,0xff,0xde,0x90,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8e,0x00,0xff,0xde,0x8c,0x00,0xff,
-    0xde,0x8b,0x00,0xff,0xde,0x8a,0x00,0xff,0xde,0x88,0x00,0xff,0xde,0x87,0x00,0xff,0xde,0x85,0x01,0xff,
-    0xde,0x84,0x01,0xf6,0xde,0x83,0x01,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x5d,0x01,0x27,
-    0xde,0x5d,0x01,0xeb,0xde,0x5d,0x01,0xff,0xde,0x5d,0x01,0xff,0xde,0x5d,0x01,0xff,0xde,0x5d,0x01,0xff,
-    0xde,0x5e,0x01,0xff,0xde,0x60,0x01,0xff,0xde,0x62,0x01,0xff,0xde,0x64,0x01,0xff,0xde,0x66,0x01,0xff,
-    0xde,0x68,0x01,0xff,0xde,0x6a,0x01,0xff,0xde,0x6c,0x01,0xff,0xde,0x6e,0x01,0xff,0xde,0x70,0x01,0xff,
-    0xde,0x71,0x01,0xff,0xde,0x73,0x01,0xff,0xde,0x75,0x01,0xff,0xde,0x76,0x01,0xff,0xde,0x78,0x01,0xff,
-    0xde,0x79,0x01,0xff,0xde,0x7b,0x01,0xff,0xde,0x7c,0x01,0xff,0xde,0x7d,0x01,0xff,0xde,0x7f,0x01,0xff,
-    0xde,0x80,0x01,0xff,0xde,0x81,0x01,0xff,0xde,0x82,0x01,0xff,0xde,0x82,0x01,0xff,0xde,0x83,0x01,0xff,
-    0xde,0x84,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x84,0x01,0xff,
-    0xde,0x84,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x83,0x01,0xff,0xde,0x83,0x01,0xff,0xde,0x82,0x01,0xff,
-    0xde,0x81,0x01,0xff,0xde,0x80,0x01,0xfd,0xde,0x80,0x01,0x7c,0xde,0x80,0x01,0x02,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xdd,0x6a,0x01,0x0d,0xde,0x6b,0x01,0xcc,0xde,0x6d,0x01,0xff,0xde,0x6f,0x01,0xff,0xde,0x71,0x01,0xff,
-    0xde,0x72,0x01,0xff,0xde,0x74,0x01,0xff,0xde,0x76,0x01,0xff,0xde,0x78,0x01,0xff,0xde,0x7a,0x01,0xff,
-    0xde,0x7b,0x01,0xff,0xde,0x7d,0x01,0xff,0xde,0x7f,0x01,0xff,0xde,0x80,0x01,0xff,0xde,0x82,0x01,0xff,
-    0xde,0x84,0x01,0xff,0xde,0x85,0x01,0xff,0xde,0x86,0x00,0xff,0xde,0x88,0x00,0xff,0xde,0x89,0x00,0xff,
-    0xde,0x8a,0x00,0xff,0xde,0x8b,0x00,0xff,0xde,0x8c,0x00,0xff,0xde,0x8d,0x00,0xff,0xde,0x8e,0x00,0xff,
-    0xde,0x8e,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x90,0x00,0xff,
-    0xde,0x8f,0x00,0xff,0xde,0x8f,0x00,0xff,0xde,0x8e,0x00,0xff,0xde,0x8e,0x00,0xff,0xde,0x8d,0x00,0xff,
-    0xde,0x8c,0x00,0xff,0xde,0x8c,0x00,0xff,0xde,0x8a,0x00,0xff,0xde,0x89,0x00,0xff,0xde,0x88,0x00,0xff,
-    0xde,0x87,0x00,0xff,0xde,0x85,0x01,0xff,0xde,0x84,0x01,0xff,0xde,0x83,0x01,0xae,0xde,0x83,0x01,0x06,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x5d,0x01,0x02,0xde,0x5d,0x01,0x7c,0xde,0x5d,0x01,0xfb,
-    0xde,0x5d,0x01,0xfd,0xde,0x5d,0x01,0xfd,0xde,0x5d,0x01,0xfd,0xde,0x5d,0x01,0xfd,0xde,0x5d,0x01,0xfd,
-    0xde,0x5f,0x01,0xfd,0xde,0x61,0x01,0xfd,0xde,0x63,0x01,0xfd,0xde,0x65,0x01,0xfd,0xde,0x67,0x01,0xfd,
-    0xde,0x69,0x01,0xfd,0xde,0x6b,0x01,0xfd,0xde,0x6d,0x01,0xfd,0xde,0x6e,0x01,0xfd,0xde,0x70,0x01,0xfd,
-    0xde,0x72,0x01,0xfd,0xde,0x73,0x01,0xfd,0xde,0x75,0x01,0xfd,0xde,0x76,0x01,0xfd,0xde,0x77,0x01,0xfd,
-    0xde,0x79,0x01,0xfd,0xde,0x7a,0x01,0xfd,0xde,0x7b,0x01,0xfd,0xde,0x7c,0x01,0xfd,0xde,0x7d,0x01,0xfd,
-    0xde,0x7e,0x01,0xfd,0xde,0x7f,0x01,0xfd,0xde,0x7f,0x01,0xfd,0xde,0x80,0x01,0xfd,0xde,0x80,0x01,0xfd,
-    0xde,0x81,0x01,0xfd,0xde,0x81,0x01,0xfd,0xde,0x81,0x01,0xfd,0xde,0x81,0x01,0xfd,0xde,0x80,0x01,0xfd,
-    0xde,0x80,0x01,0xfd,0xde,0x7f,0x01,0xfd,0xde,0x7f,0x01,0xfd,0xde,0x7e,0x01,0xfd,0xde,0x7e,0x01,0xd2,
-    0xde,0x7e,0x01,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xde,0x6b,0x01,0x4a,
-    0xde,0x6b,0x01,0xf7,0xde,0x6d,0x01,0xfd,0xde,0x6f,0x01,0xfd,0xde,0x71,0x01,0xfd,0xde,0x73,0x01,0xfd,
-    0xde,0x74,0x01,0xfd,0xde,0x76,0x01,0xfd,0xde,0x78,0x01,0xfd,0xde,0x7a,0x01,0xfd,0xde,0x7b,0x01,0xfd,
-    0xde,0x7d,0x01,0xfd,0xde,0x7f,0x01,0xfd,0xde,0x80,0x01,0xfd,0xde,0x82,0x01,0xfd,0xde,0x83,0x01,0xfd,
-    0xde,0x84,0x01,0xfd,0xde,0x86,0x01,0xfd,0xde,0x87,0x00,0xfd,0xde,0x88,0x00,0xfd,0xde,0x89,0x00,0xfd,
-    0xde,0x8a,0x00,0xfd,0xde,0x8b,0x00,0xfd,0xde,0x8b,0x00,0xfd,0xde,0x8c,0x00,0xfd,0xde,0x8d,0x00,0xfd,
-    0xde,0x8d,0x00,0xfd,0xde,0x8d,0x00,0xfd,0xde,0x8d,0x00,0xfd,0xde,0x8d,0x00,0xfd,0xde,0x8d,0x00,0xfd,
-    0xde,0x8c,0x00,0xfd,0xde,0x8c,0x00,0xfd,0xde,0x8b,0x00,0xfd,0xde,0x8a,0x00,0xfd,0xde,0x8a,0x00,0xfd,
-    0xde,0x89,0x00,0xfd,0xde,0x88,0x00,0xfd,0xde,0x86,0x00,0xfd,0xde,0x85,0x01,0xfd,0xde,0x84,0x01,0xfd,
-    0xde,0x82,0x01,0xee,0xde,0x82,0x01,0x2f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-};
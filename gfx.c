@@ -4,8 +4,192 @@
 /// Helper routines for super simple graphics rendering.
 /// Requires the SDL2 library.
 
-#include "gfx.h"
+#include "gfx_internal.h"
 #include <signal.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// 32-bit texture formats that sprites and the background can use without any
+// conversion by the driver (they all carry an alpha channel).
+static const gfx_pixel_layout_t pixel_layouts[] = {
+    { SDL_PIXELFORMAT_ARGB8888, 16,  8,  0, 24 },
+    { SDL_PIXELFORMAT_ABGR8888,  0,  8, 16, 24 },
+    { SDL_PIXELFORMAT_RGBA8888, 24, 16,  8,  0 },
+    { SDL_PIXELFORMAT_BGRA8888,  8, 16, 24,  0 },
+};
+
+gfx_pixel_layout_t gfx_pixel_layout = { SDL_PIXELFORMAT_ARGB8888, 16, 8, 0, 24 };
+// Byte order R,G,B,A: the shifts of the packed value depend on the endianness.
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+const gfx_pixel_layout_t gfx_pixel_layout_rgba32 = { SDL_PIXELFORMAT_RGBA32, 24, 16, 8, 0 };
+#else
+const gfx_pixel_layout_t gfx_pixel_layout_rgba32 = { SDL_PIXELFORMAT_RGBA32, 0, 8, 16, 24 };
+#endif
+
+/// Find the layout of a 32-bit pixel format.
+/// @param format SDL pixel format.
+/// @return the layout or NULL if the format isn't one of the supported 32-bit formats.
+const gfx_pixel_layout_t *gfx_pixel_layout_find(Uint32 format) {
+    for (size_t i = 0; i < sizeof(pixel_layouts)/sizeof(pixel_layouts[0]); i++) {
+        if (pixel_layouts[i].format == format) {
+            return &pixel_layouts[i];
+        }
+    }
+    return NULL;
+}
+
+/// Pick the first texture format advertised by the renderer that we know how to
+/// lay out, so that texture uploads are straight copies.
+/// Keeps ARGB8888 if the renderer doesn't advertise any of them.
+/// pixel_t is global: only the first context negotiates, later ones reuse its
+/// layout (SDL converts on upload if their renderer prefers another one), so
+/// that pixels already built by the application keep their meaning.
+/// @param renderer renderer to query.
+static void pixel_layout_negotiate(SDL_Renderer *renderer) {
+    static bool negotiated = false;
+    SDL_RendererInfo info;
+    if (negotiated || !renderer || SDL_GetRendererInfo(renderer, &info) != 0) {
+        return;
+    }
+    negotiated = true;
+    for (Uint32 i = 0; i < info.num_texture_formats; i++) {
+        const gfx_pixel_layout_t *layout = gfx_pixel_layout_find(info.texture_formats[i]);
+        if (layout) {
+            gfx_pixel_layout = *layout;
+            return;
+        }
+    }
+}
+
+gfx_context_t *gfx_current_ctxt = NULL;
+gfx_context_t *gfx_contexts = NULL;
+
+/// Recompute the cached window to logical coordinates transform.
+/// @param ctxt graphic context.
+static void mouse_transform_update(gfx_context_t *ctxt) {
+    float sx = (float)ctxt->window_width/ctxt->width;
+    float sy = (float)ctxt->window_height/ctxt->height;
+    ctxt->mouse_offset_x = 0;
+    ctxt->mouse_offset_y = 0;
+
+    switch (ctxt->resize_policy) {
+        case GFX_RESIZE_STRETCH:
+            break;
+        case GFX_RESIZE_LETTERBOX:
+            // Same computation as SDL_RenderSetLogicalSize: the smallest scale wins,
+            // the image is centered along the other axis.
+            if (sx < sy) {
+                sy = sx;
+                ctxt->mouse_offset_y = (ctxt->window_height-ctxt->height*sy)/2;
+            } else {
+                sx = sy;
+                ctxt->mouse_offset_x = (ctxt->window_width-ctxt->width*sx)/2;
+            }
+            break;
+        case GFX_RESIZE_GROW:
+            sx = sy = 1;
+            break;
+    }
+    ctxt->mouse_scale_x = 1/sx;
+    ctxt->mouse_scale_y = 1/sy;
+}
+
+/// Copy the background in screen order (undoing the scroll origin) to a buffer.
+/// @param ctxt graphic context.
+/// @param dst destination, width x height pixels.
+/// @param dst_pitch length of a destination row in bytes.
+void gfx_background_copy(gfx_context_t *ctxt, pixel_t *dst, int dst_pitch) {
+    int sx = ctxt->scroll_x, sy = ctxt->scroll_y;
+    for (int j = 0; j < ctxt->height; j++) {
+        int row = j+sy < ctxt->height ? j+sy : j+sy-ctxt->height;
+        const pixel_t *src = (const pixel_t *)((const uint8_t *)ctxt->background + ctxt->pitch*row);
+        pixel_t *out = (pixel_t *)((uint8_t *)dst + dst_pitch*j);
+        memcpy(out, src+sx, (ctxt->width-sx)*sizeof(pixel_t));
+        memcpy(out+ctxt->width-sx, src, sx*sizeof(pixel_t));
+    }
+}
+
+/// Bring the background back to a zero scroll origin.
+/// @return 0 on success, -1 if out of memory.
+static int background_unwrap(gfx_context_t *ctxt) {
+    if (ctxt->scroll_x == 0 && ctxt->scroll_y == 0) {
+        return 0;
+    }
+    int pitch = ctxt->width*sizeof(pixel_t);
+    pixel_t *tmp = malloc((size_t)pitch*ctxt->height);
+    if (!tmp) {
+        return -1;
+    }
+    gfx_background_copy(ctxt, tmp, pitch);
+    for (int j = 0; j < ctxt->height; j++) {
+        memcpy((uint8_t *)ctxt->background + ctxt->pitch*j, (uint8_t *)tmp + pitch*j, pitch);
+    }
+    free(tmp);
+    ctxt->scroll_x = ctxt->scroll_y = 0;
+    return 0;
+}
+
+/// Make the background at least width x height pixels large.
+/// Storage grows by 1.5x steps so that repeated resizes don't reallocate every time,
+/// and is never shrunk. The existing content is preserved, exposed areas are black.
+/// @param ctxt graphic context.
+/// @param width new background width.
+/// @param height new background height.
+/// @return 0 on success, -1 if reallocation failed (the context is left unchanged).
+static int background_resize(gfx_context_t *ctxt, int width, int height) {
+    if (background_unwrap(ctxt) < 0) {
+        return -1;
+    }
+    if (width > ctxt->capacity_width || height > ctxt->capacity_height) {
+        int cap_w = ctxt->capacity_width, cap_h = ctxt->capacity_height;
+        if (width > cap_w) cap_w = SDL_max(width, cap_w + cap_w/2);
+        if (height > cap_h) cap_h = SDL_max(height, cap_h + cap_h/2);
+
+        SDL_Texture *tex = SDL_CreateTexture(ctxt->renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_STREAMING, cap_w, cap_h);
+        int pitch = cap_w*sizeof(pixel_t);
+        pixel_t *background = malloc(pitch*cap_h);
+        if (!tex || !background) {
+            if (tex) SDL_DestroyTexture(tex);
+            free(background);
+            return -1;
+        }
+        for (int j = 0; j < ctxt->height; j++) {
+            memcpy((uint8_t *)background+pitch*j, (uint8_t *)ctxt->background+ctxt->pitch*j, ctxt->width*sizeof(pixel_t));
+        }
+        gfx_texture_unregister(ctxt, ctxt->background_texture);
+        free(ctxt->background);
+        ctxt->background_texture = gfx_texture_register(ctxt, tex, NULL);
+        ctxt->background = background;
+        ctxt->pitch = pitch;
+        ctxt->capacity_width = cap_w;
+        ctxt->capacity_height = cap_h;
+    }
+
+    int stride = ctxt->pitch/sizeof(pixel_t);
+    for (int j = 0; j < height; j++) {
+        int first = j < ctxt->height ? ctxt->width : 0;
+        for (int i = first; i < width; i++) {
+            ctxt->background[stride*j+i] = GFX_COL_BLACK;
+        }
+    }
+    ctxt->width = width;
+    ctxt->height = height;
+    return 0;
+}
+
+/// React to a window size change according to the context's resize policy.
+/// @param ctxt graphic context.
+/// @param window_width new window width.
+/// @param window_height new window height.
+static void window_resized(gfx_context_t *ctxt, int window_width, int window_height) {
+    ctxt->window_width = window_width;
+    ctxt->window_height = window_height;
+    if (ctxt->resize_policy == GFX_RESIZE_GROW) {
+        background_resize(ctxt, window_width, window_height);
+    }
+    mouse_transform_update(ctxt);
+}
 
 /// Create a fullscreen graphic window.
 /// @param title window title.
@@ -35,10 +219,19 @@ gfx_context_t* gfx_create(char *title, int width, int height) {
     // SDL_SetHint(SDL_HINT_VIDEO_X11_XVIDMODE, "0");
 
     SDL_Window *window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, SDL_WINDOW_OPENGL|SDL_WINDOW_RESIZABLE);
+    // Headless video drivers (SDL_VIDEODRIVER=dummy or offscreen) may lack OpenGL:
+    // fall back to a plain window and the software renderer.
+    if (!window) {
+        window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, SDL_WINDOW_RESIZABLE);
+    }
     SDL_Renderer *renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
-    SDL_Texture *background_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (!renderer) {
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+    }
+    pixel_layout_negotiate(renderer);
+    SDL_Texture *background_texture = SDL_CreateTexture(renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_STREAMING, width, height);
 
-    gfx_context_t *ctxt = malloc(sizeof(gfx_context_t));
+    gfx_context_t *ctxt = calloc(1, sizeof(gfx_context_t));
 
     // Retrieve the background texture's pitch
     uint8_t *unused;
@@ -49,11 +242,32 @@ gfx_context_t* gfx_create(char *title, int width, int height) {
     if (!window || !renderer || !background_texture || !background || !ctxt) goto error;
 
     ctxt->renderer = renderer;
-    ctxt->background_texture = background_texture;
+    ctxt->background_texture = gfx_texture_register(ctxt, background_texture, NULL);
     ctxt->window = window;
     ctxt->width = width;
     ctxt->height = height;
     ctxt->background = background;
+    ctxt->resize_policy = GFX_RESIZE_STRETCH;
+    ctxt->capacity_width = width;
+    ctxt->capacity_height = height;
+    ctxt->window_width = width;
+    ctxt->window_height = height;
+    mouse_transform_update(ctxt);
+    gfx_current_ctxt = ctxt;
+    ctxt->next_context = gfx_contexts;
+    gfx_contexts = ctxt;
+
+    // Input recording/replay of unmodified programs, e.g. for benchmarks in CI
+    char *input_log = getenv("GFX_INPUT_REPLAY");
+    if (input_log && gfx_input_replay(ctxt, input_log) < 0) {
+        fprintf(stderr, "Failed replaying input log \"%s\"\n", input_log);
+    } else if ((input_log = getenv("GFX_INPUT_RECORD")) && gfx_input_record(ctxt, input_log) < 0) {
+        fprintf(stderr, "Failed recording input log \"%s\"\n", input_log);
+    }
+    char *latency_log = getenv("GFX_LATENCY_LOG");
+    if (latency_log && gfx_latency_log(ctxt, atoi(latency_log)) < 0) {
+        fprintf(stderr, "Failed logging input latency\n");
+    }
 
     SDL_ShowCursor(SDL_DISABLE);
     gfx_background_clear(ctxt, GFX_COL_BLACK);
@@ -64,16 +278,34 @@ error:
 }
 
 /// Draw a pixel in the background buffer.
+/// Coordinates are on screen: the scroll origin (see gfx_background_scroll) is applied.
 /// @param ctxt graphic context.
 /// @param x x coordinate of the pixel.
 /// @param y y coordinate of the pixel.
 /// @param color pixel color.
 void gfx_background_putpixel(gfx_context_t *ctxt, int x, int y, pixel_t color) {
-    if (x < ctxt->width && y < ctxt->height) {
+    if ((unsigned)x < (unsigned)ctxt->width && (unsigned)y < (unsigned)ctxt->height) {
+        x += ctxt->scroll_x;
+        y += ctxt->scroll_y;
+        if (x >= ctxt->width) x -= ctxt->width;
+        if (y >= ctxt->height) y -= ctxt->height;
         ctxt->background[ctxt->pitch/sizeof(pixel_t)*y+x] = color;
     }
 }
 
+/// Scroll the background without moving any pixel: the buffer is addressed as
+/// a torus whose origin (ctxt->scroll_x, ctxt->scroll_y) moves instead.
+/// Screen pixel (x, y) is buffer pixel ((x+scroll_x) % width, (y+scroll_y) % height).
+/// The pixels scrolled out come back on the other side: after scrolling by
+/// dx > 0, redraw the dx rightmost columns (dx < 0: the leftmost ones), same for rows.
+/// @param ctxt graphic context.
+/// @param dx horizontal scroll in pixels, positive to move the view right.
+/// @param dy vertical scroll in pixels, positive to move the view down.
+void gfx_background_scroll(gfx_context_t *ctxt, int dx, int dy) {
+    ctxt->scroll_x = ((ctxt->scroll_x + dx) % ctxt->width + ctxt->width) % ctxt->width;
+    ctxt->scroll_y = ((ctxt->scroll_y + dy) % ctxt->height + ctxt->height) % ctxt->height;
+}
+
 /// Clear the background buffer.
 /// @param ctxt graphic context.
 /// @param color fill color.
@@ -86,22 +318,96 @@ void gfx_background_clear(gfx_context_t *ctxt, pixel_t color) {
 }
 
 /// Copy the background buffer to the display buffer.
+/// A scrolled background is composed from up to 4 parts of the texture.
 /// @param ctxt graphic context.
 void gfx_background_update(gfx_context_t *ctxt) {
-    SDL_UpdateTexture(ctxt->background_texture, NULL, ctxt->background, ctxt->width*sizeof(pixel_t));
-    SDL_RenderCopy(ctxt->renderer, ctxt->background_texture, NULL, NULL);
+    GFX_TRACE_SCOPE("gfx_background_update");
+    SDL_Rect rect = { 0, 0, ctxt->width, ctxt->height };
+    SDL_UpdateTexture(ctxt->background_texture, &rect, ctxt->background, ctxt->pitch);
+    int sx = ctxt->scroll_x, sy = ctxt->scroll_y;
+    if (sx == 0 && sy == 0) {
+        SDL_RenderCopy(ctxt->renderer, ctxt->background_texture, &rect, NULL);
+        return;
+    }
+
+    // Split the area a NULL destination would cover at the same proportions.
+    SDL_Rect vp;
+    SDL_RenderGetViewport(ctxt->renderer, &vp);
+    int w1 = ctxt->width-sx, h1 = ctxt->height-sy;
+    int split_x = (int64_t)vp.w*w1/ctxt->width, split_y = (int64_t)vp.h*h1/ctxt->height;
+    SDL_Rect src[4] = { { sx, sy, w1, h1 }, { 0, sy, sx, h1 }, { sx, 0, w1, sy }, { 0, 0, sx, sy } };
+    SDL_Rect dst[4] = { { 0, 0, split_x, split_y }, { split_x, 0, vp.w-split_x, split_y },
+                        { 0, split_y, split_x, vp.h-split_y }, { split_x, split_y, vp.w-split_x, vp.h-split_y } };
+    for (int i = 0; i < 4; i++) {
+        if (src[i].w > 0 && src[i].h > 0) {
+            SDL_RenderCopy(ctxt->renderer, ctxt->background_texture, &src[i], &dst[i]);
+        }
+    }
+}
+
+/// Save the background buffer to an image file.
+/// Files ending with ".qoi" are saved as QOI (fast, encoded on all cores), others as PNG.
+/// @param ctxt graphic context.
+/// @param filename path to the file to write.
+/// @return 0 on success, -1 on failure.
+int gfx_background_save(gfx_context_t *ctxt, const char *filename) {
+    pixel_t *pixels = ctxt->background, *unwrapped = NULL;
+    int pitch = ctxt->pitch;
+    if (ctxt->scroll_x || ctxt->scroll_y) {
+        pitch = ctxt->width*sizeof(pixel_t);
+        pixels = unwrapped = malloc((size_t)pitch*ctxt->height);
+        if (!unwrapped) {
+            return -1;
+        }
+        gfx_background_copy(ctxt, unwrapped, pitch);
+    }
+
+    int ret = -1;
+    size_t len = strlen(filename);
+    if (len >= 4 && strcmp(filename+len-4, ".qoi") == 0) {
+        ret = gfx_qoi_save(filename, pixels, pitch, ctxt->width, ctxt->height, 0);
+    } else {
+        SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, ctxt->width, ctxt->height, 32, pitch, gfx_pixel_layout.format);
+        if (surface) {
+            ret = IMG_SavePNG(surface, filename);
+            SDL_FreeSurface(surface);
+        }
+    }
+    free(unwrapped);
+    return ret;
 }
 
-/// Show the display buffer.
+/// Composite the layers, unless gfx_layers_render was called this frame, and
+/// show the display buffer. Memory from gfx_frame_alloc is reclaimed.
 /// @param ctxt graphic context.
 void gfx_present(gfx_context_t *ctxt) {
+    gfx_trace_poll();
+    GFX_TRACE_SCOPE("gfx_present");
+    if (!ctxt->layers_rendered) {
+        gfx_layers_render(ctxt);
+    }
+    gfx_capture_frame(ctxt);
+    gfx_stream_frame(ctxt);
+    gfx_shm_frame(ctxt);
     SDL_RenderPresent(ctxt->renderer);
+    gfx_latency_frame(ctxt);
+    gfx_input_frame(ctxt);
+    ctxt->layers_rendered = false;
+    gfx_frame_reset(ctxt);
+    ctxt->frame++;
 }
 
 /// Destroy a graphic window.
 /// @param ctxt graphic context.
 void gfx_destroy(gfx_context_t *ctxt) {
+    gfx_capture_stop(ctxt);
+    gfx_stream_stop(ctxt);
+    gfx_shm_stop(ctxt);
+    gfx_input_stop(ctxt);
     SDL_ShowCursor(SDL_ENABLE);
+    while (ctxt->layers) {
+        gfx_layer_destroy(ctxt->layers);
+    }
     SDL_DestroyTexture(ctxt->background_texture);
     SDL_DestroyRenderer(ctxt->renderer);
     SDL_DestroyWindow(ctxt->window);
@@ -110,53 +416,193 @@ void gfx_destroy(gfx_context_t *ctxt) {
     ctxt->renderer = NULL;
     ctxt->window = NULL;
     ctxt->background = NULL;
+    gfx_texture_registry_free(ctxt);
+    gfx_frame_free(ctxt);
+    gfx_latency_free(ctxt);
+    if (gfx_current_ctxt == ctxt) {
+        gfx_current_ctxt = NULL;
+    }
+    for (gfx_context_t **link = &gfx_contexts; *link; link = &(*link)->next_context) {
+        if (*link == ctxt) {
+            *link = ctxt->next_context;
+            break;
+        }
+    }
     SDL_Quit();
     free(ctxt);
 }
 
+/// Select how the context reacts when the window is resized.
+/// GFX_RESIZE_LETTERBOX keeps the current logical size and lets the GPU scale it,
+/// GFX_RESIZE_GROW resizes the background to the window size right away.
+/// @param ctxt graphic context.
+/// @param policy resize policy.
+void gfx_resize_policy_set(gfx_context_t *ctxt, gfx_resize_policy_t policy) {
+    ctxt->resize_policy = policy;
+    if (policy == GFX_RESIZE_LETTERBOX) {
+        SDL_RenderSetLogicalSize(ctxt->renderer, ctxt->width, ctxt->height);
+    } else {
+        SDL_RenderSetLogicalSize(ctxt->renderer, 0, 0);
+    }
+    window_resized(ctxt, ctxt->window_width, ctxt->window_height);
+}
+
+/// Convert window coordinates (e.g. from a mouse event) to background coordinates.
+/// Uses the transform cached at the last window resize.
+/// Positions inside letterbox bars map outside of [0,width[ x [0,height[.
+/// @param ctxt graphic context.
+/// @param window_x x coordinate in the window.
+/// @param window_y y coordinate in the window.
+/// @param x returned x coordinate in the background.
+/// @param y returned y coordinate in the background.
+void gfx_mouse_to_logical(gfx_context_t *ctxt, int window_x, int window_y, int *x, int *y) {
+    *x = SDL_floorf((window_x-ctxt->mouse_offset_x)*ctxt->mouse_scale_x);
+    *y = SDL_floorf((window_y-ctxt->mouse_offset_y)*ctxt->mouse_scale_y);
+}
+
+/// Undo SDL's mapping of mouse events to logical coordinates, so that the events
+/// consumed and recorded carry window coordinates whatever the resize policy.
+/// With a logical size set (GFX_RESIZE_LETTERBOX), the renderer's event watch
+/// has already applied the context's transform to the event: the position is
+/// mapped back to the center of that logical pixel, which gfx_mouse_to_logical
+/// maps to the same pixel again.
+/// @param ctxt graphic context.
+/// @param event event coming from SDL (not a replayed one).
+void gfx_mouse_event_to_window(gfx_context_t *ctxt, SDL_Event *event) {
+    int *x, *y;
+    switch (event->type) {
+        case SDL_MOUSEMOTION:
+            x = &event->motion.x;
+            y = &event->motion.y;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            x = &event->button.x;
+            y = &event->button.y;
+            break;
+        default:
+            return;
+    }
+    if (ctxt->resize_policy != GFX_RESIZE_LETTERBOX) {
+        return;
+    }
+    *x = SDL_floorf((*x+0.5f)/ctxt->mouse_scale_x + ctxt->mouse_offset_x);
+    *y = SDL_floorf((*y+0.5f)/ctxt->mouse_scale_y + ctxt->mouse_offset_y);
+}
+
+/// Retrieve the mouse position in background coordinates and the buttons state.
+/// @param ctxt graphic context.
+/// @param x returned x coordinate in the background.
+/// @param y returned y coordinate in the background.
+/// @return the buttons bitmask (see SDL_BUTTON).
+/// The state is the one left by the events consumed so far (see gfx_keypressed),
+/// so that it is identical when input events are replayed.
+uint32_t gfx_mouse_state(gfx_context_t *ctxt, int *x, int *y) {
+    gfx_mouse_to_logical(ctxt, ctxt->mouse_window_x, ctxt->mouse_window_y, x, y);
+    return ctxt->mouse_buttons;
+}
+
 /// If a key was pressed, returns its key code.
 /// IMPORTANT: This is a non-blocking call!
+/// Pending mouse and window events are consumed until a key press is found:
+/// they update the mouse state (see gfx_mouse_state) and handle window resizes
+/// (see gfx_resize_policy_set).
 /// List of key codes: https://wiki.libsdl.org/SDL_Keycode
 /// @return the key that was pressed or 0 if none was pressed.
 SDL_Keycode gfx_keypressed() {
+    GFX_TRACE_SCOPE("gfx_keypressed");
+    gfx_context_t *ctxt = gfx_current_ctxt;
     SDL_Event event;
-    if (SDL_PollEvent(&event)) {
+    while (ctxt ? gfx_input_poll(ctxt, &event) : SDL_PollEvent(&event)) {
         if (event.type == SDL_KEYDOWN)
             return event.key.keysym.sym;
+        if (!ctxt)
+            continue;
+        switch (event.type) {
+            case SDL_MOUSEMOTION:
+                ctxt->mouse_window_x = event.motion.x;
+                ctxt->mouse_window_y = event.motion.y;
+                ctxt->mouse_buttons = event.motion.state;
+                break;
+            case SDL_MOUSEBUTTONDOWN:
+            case SDL_MOUSEBUTTONUP:
+                ctxt->mouse_window_x = event.button.x;
+                ctxt->mouse_window_y = event.button.y;
+                if (event.type == SDL_MOUSEBUTTONDOWN)
+                    ctxt->mouse_buttons |= SDL_BUTTON(event.button.button);
+                else
+                    ctxt->mouse_buttons &= ~SDL_BUTTON(event.button.button);
+                break;
+            case SDL_WINDOWEVENT:
+                if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+                    window_resized(ctxt, event.window.data1, event.window.data2);
+                break;
+            case SDL_RENDER_TARGETS_RESET:
+            case SDL_RENDER_DEVICE_RESET:
+                ctxt->targets_reset++;  // render targets must be re-baked
+                break;
+        }
     }
     return 0;
 }
 
-/// Load a sprite from an image file (png, jpg, etc.).
-/// @param ctxt graphic context.
-/// @param filename path to the file to load.
-/// @return a pointer to the sprite or NULL in case of failure.
-/// When not needed anymore, deallocate it with gfx_sprite_destroy.
-SDL_Texture *gfx_sprite_load(gfx_context_t *ctxt, char *filename) {
-    SDL_Surface *sprite_surface = IMG_Load(filename);
-    // Failed loading sprite.
-    if (!sprite_surface) {
-        return NULL;
+/// Convert packed 32-bit pixels from one channel layout to another.
+/// Uses SSE2 when available; in-place conversion (dst == src) is allowed.
+/// @param dst destination pixels.
+/// @param dst_layout layout of the destination pixels.
+/// @param src source pixels.
+/// @param src_layout layout of the source pixels.
+/// @param count number of pixels to convert.
+void gfx_pixels_convert(uint32_t *dst, const gfx_pixel_layout_t *dst_layout, const uint32_t *src, const gfx_pixel_layout_t *src_layout, int count) {
+    const uint8_t src_shift[4] = { src_layout->r_shift, src_layout->g_shift, src_layout->b_shift, src_layout->a_shift };
+    const uint8_t dst_shift[4] = { dst_layout->r_shift, dst_layout->g_shift, dst_layout->b_shift, dst_layout->a_shift };
+    int i = 0;
+
+    if (memcmp(src_shift, dst_shift, sizeof(src_shift)) == 0) {
+        if (dst != src) {
+            memmove(dst, src, count*sizeof(uint32_t));
+        }
+        return;
     }
 
-    SDL_Texture *sprite_texture = SDL_CreateTextureFromSurface(ctxt->renderer, sprite_surface);
-    if (!sprite_texture) {
-        return NULL;
+#ifdef __SSE2__
+    const __m128i mask = _mm_set1_epi32(0xff);
+    __m128i sc[4], dc[4];
+    for (int c = 0; c < 4; c++) {
+        sc[c] = _mm_cvtsi32_si128(src_shift[c]);
+        dc[c] = _mm_cvtsi32_si128(dst_shift[c]);
     }
-    SDL_FreeSurface(sprite_surface);  // Only the texture is needed
+    for (; i+4 <= count; i += 4) {
+        __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+        __m128i out = _mm_setzero_si128();
+        for (int c = 0; c < 4; c++) {
+            __m128i channel = _mm_and_si128(_mm_srl_epi32(in, sc[c]), mask);
+            out = _mm_or_si128(out, _mm_sll_epi32(channel, dc[c]));
+        }
+        _mm_storeu_si128((__m128i *)(dst+i), out);
+    }
+#endif
 
-    return sprite_texture;
+    for (; i < count; i++) {
+        uint32_t in = src[i], out = 0;
+        for (int c = 0; c < 4; c++) {
+            out |= ((in >> src_shift[c]) & 0xff) << dst_shift[c];
+        }
+        dst[i] = out;
+    }
 }
 
-/// Create a sprite from in-memory RGBA8888 pixels.
+/// Create a sprite texture from pixels of any known 32-bit layout, converted to
+/// the native format if needed. The texture isn't recorded by the context.
 /// @param ctxt graphic context.
 /// @param pixels array of pixels composing the sprite.
+/// @param pitch length of a row of pixels in bytes.
 /// @param width sprite's width in pixels.
 /// @param height sprite's height in pixels.
-/// @return a pointer to the sprite or NULL in case of failure.
-/// When not needed anymore, deallocate it with gfx_sprite_destroy.
-SDL_Texture *gfx_sprite_create(gfx_context_t *ctxt, uint8_t *pixels, int width, int height) {
-    SDL_Texture *tex = SDL_CreateTexture(ctxt->renderer, SDL_PIXELFORMAT_ABGR8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+/// @param layout layout of the source pixels.
+/// @return the texture or NULL in case of failure.
+SDL_Texture *gfx_sprite_texture_create(gfx_context_t *ctxt, const void *pixels, int pitch, int width, int height, const gfx_pixel_layout_t *layout) {
+    SDL_Texture *tex = SDL_CreateTexture(ctxt->renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_STREAMING, width, height);
     if (!tex) {
         return NULL;
     }
@@ -164,32 +610,113 @@ SDL_Texture *gfx_sprite_create(gfx_context_t *ctxt, uint8_t *pixels, int width,
     // Force renderer to use alpha blending when rendering the sprite.
     SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
 
-    pixel_t *dst_pixels;
-    pixel_t *src_pixels = (pixel_t *)pixels;
-    int pitch;
-    if (SDL_LockTexture(tex, NULL, (void **)&dst_pixels, &pitch) != 0) {
+    uint8_t *dst_pixels;
+    int dst_pitch;
+    if (SDL_LockTexture(tex, NULL, (void **)&dst_pixels, &dst_pitch) != 0) {
         SDL_DestroyTexture(tex);
         return NULL;
     }
     for (int j = 0; j < height; j++) {
-        for (int i = 0; i < width; i++) {
-            dst_pixels[pitch/sizeof(pixel_t)*j+i] = *src_pixels;
-            src_pixels++;
-        }
+        gfx_pixels_convert((uint32_t *)(dst_pixels+dst_pitch*j), &gfx_pixel_layout,
+                           (const uint32_t *)((const uint8_t *)pixels+pitch*j), layout, width);
     }
     SDL_UnlockTexture(tex);
 
     return tex;
 }
 
-/// Destroy a sprite that was loaded/created with gfx_sprite_load/gfx_sprite_create.
+/// Create a sprite from in-memory pixels of any known 32-bit layout.
+/// The pixels are copied into the texture, converted to the native format if needed.
 /// @param ctxt graphic context.
+/// @param pixels array of pixels composing the sprite.
+/// @param pitch length of a row of pixels in bytes.
+/// @param width sprite's width in pixels.
+/// @param height sprite's height in pixels.
+/// @param layout layout of the source pixels (e.g. gfx_pixel_layout_rgba32).
+/// @return a pointer to the sprite or NULL in case of failure.
+/// When not needed anymore, deallocate it with gfx_sprite_destroy.
+SDL_Texture *gfx_sprite_create_layout(gfx_context_t *ctxt, const void *pixels, int pitch, int width, int height, const gfx_pixel_layout_t *layout) {
+    return gfx_texture_register(ctxt, gfx_sprite_texture_create(ctxt, pixels, pitch, width, height, layout), NULL);
+}
+
+/// Load a sprite texture from an image file. The texture isn't recorded by the context.
+/// @param ctxt graphic context.
+/// @param filename path to the file to load.
+/// @return the texture or NULL in case of failure.
+SDL_Texture *gfx_sprite_texture_load(gfx_context_t *ctxt, const char *filename) {
+    if (gfx_qoi_file(filename)) {
+        return gfx_qoi_sprite_load(ctxt, filename);
+    }
+
+    SDL_Surface *sprite_surface = IMG_Load(filename);
+    // Failed loading sprite.
+    if (!sprite_surface) {
+        return NULL;
+    }
+
+    // Let SDL expand palettized/24-bit images, our own converter takes it from there.
+    if (sprite_surface->format->format != SDL_PIXELFORMAT_RGBA32) {
+        SDL_Surface *rgba_surface = SDL_ConvertSurfaceFormat(sprite_surface, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(sprite_surface);
+        if (!rgba_surface) {
+            return NULL;
+        }
+        sprite_surface = rgba_surface;
+    }
+
+    SDL_LockSurface(sprite_surface);
+    SDL_Texture *sprite_texture = gfx_sprite_texture_create(ctxt, sprite_surface->pixels, sprite_surface->pitch, sprite_surface->w, sprite_surface->h, &gfx_pixel_layout_rgba32);
+    SDL_UnlockSurface(sprite_surface);
+    SDL_FreeSurface(sprite_surface);  // Only the texture is needed
+
+    return sprite_texture;
+}
+
+/// Load a sprite from an image file (qoi, png, jpg, etc.).
+/// QOI images are decoded by gfxlib itself, straight into the texture.
+/// @param ctxt graphic context.
+/// @param filename path to the file to load.
+/// @return a pointer to the sprite or NULL in case of failure.
+/// When not needed anymore, deallocate it with gfx_sprite_destroy.
+SDL_Texture *gfx_sprite_load(gfx_context_t *ctxt, char *filename) {
+    GFX_TRACE_SCOPE("gfx_sprite_load");
+    return gfx_texture_register(ctxt, gfx_sprite_texture_load(ctxt, filename), filename);
+}
+
+/// Create a sprite from in-memory RGBA pixels (byte order R,G,B,A).
+/// The pixels are converted to the renderer's native format if needed.
+/// @param ctxt graphic context.
+/// @param pixels array of pixels composing the sprite.
+/// @param width sprite's width in pixels.
+/// @param height sprite's height in pixels.
+/// @return a pointer to the sprite or NULL in case of failure.
+/// When not needed anymore, deallocate it with gfx_sprite_destroy.
+SDL_Texture *gfx_sprite_create(gfx_context_t *ctxt, uint8_t *pixels, int width, int height) {
+    return gfx_sprite_create_layout(ctxt, pixels, width*sizeof(pixel_t), width, height, &gfx_pixel_layout_rgba32);
+}
+
+/// Destroy a sprite that was loaded/created with gfx_sprite_load/gfx_sprite_create.
+/// The sprite is looked up in the registry of every live context, so that it is
+/// released by the context that created it. Sprites are destroyed along with
+/// their context: don't destroy them after gfx_destroy.
 /// @param sprite the sprite (texture) to destroy.
 void gfx_sprite_destroy(SDL_Texture *sprite) {
-    SDL_DestroyTexture(sprite);
+    for (gfx_context_t *ctxt = gfx_contexts; ctxt; ctxt = ctxt->next_context) {
+        if (gfx_texture_registered(ctxt, sprite)) {
+            gfx_texture_unregister(ctxt, sprite);
+            return;
+        }
+    }
+    // Not created by gfxlib. Without any live context SDL is shut down and
+    // every texture is already gone.
+    if (gfx_contexts) {
+        SDL_DestroyTexture(sprite);
+    }
 }
 
 /// Render a sprite at the specified position.
+/// A sprite loaded from a file or embedded, rendered at the same non-native size
+/// frame after frame, is pre-scaled once (box filter when shrinking), then simply copied.
 /// @param context graphic context.
 /// @param sprite the sprite (texture) to render.
 /// @param x sprite's x coordinate.
@@ -198,5 +725,8 @@ void gfx_sprite_destroy(SDL_Texture *sprite) {
 /// @param sprite_height sprite's display height in pixels.
 void gfx_sprite_render(gfx_context_t *ctxt, SDL_Texture *sprite, int x, int y, int sprite_width, int sprite_height) {
     SDL_Rect dst_rect = { x, y, sprite_width, sprite_height };
-    SDL_RenderCopy(ctxt->renderer, sprite, NULL, &dst_rect);
+    SDL_Texture *texture = gfx_texture_use(ctxt, sprite, sprite_width, sprite_height);
+    if (texture) {
+        SDL_RenderCopy(ctxt->renderer, texture, NULL, &dst_rect);
+    }
 }
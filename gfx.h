@@ -6,7 +6,7 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 
-#define GFX_RGB(r,g,b) ((pixel_t){b,g,r,0})
+#define GFX_RGB(r,g,b) gfx_rgba(r,g,b,0)
 
 #define GFX_COL_BLACK  GFX_RGB(0,0,0)
 #define GFX_COL_RED    GFX_RGB(0,0,255)
@@ -17,15 +17,346 @@
 #define GFX_COL_YELLOW GFX_RGB(0,255,255)
 #define GFX_COL_WHITE  GFX_RGB(255,255,255)
 
-// Structure of a pixel: 32-bits (ARGB)
-typedef struct __attribute__ ((__packed__)) {
-    uint8_t b;
-    uint8_t g;
-    uint8_t r;
-    uint8_t a;
-} pixel_t;
+// A pixel: 32-bits, packed in the native texture format negotiated by the first gfx_create
+// (see gfx_pixel_layout). Always build pixels with GFX_RGB or gfx_rgba.
+typedef uint32_t pixel_t;
 
+// Position (bit shift) of each 8-bit channel inside a 32-bit packed pixel.
 typedef struct {
+    Uint32 format;  // matching SDL pixel format
+    uint8_t r_shift;
+    uint8_t g_shift;
+    uint8_t b_shift;
+    uint8_t a_shift;
+} gfx_pixel_layout_t;
+
+// Layout of pixel_t; set by the first gfx_create to the renderer's native texture format.
+extern gfx_pixel_layout_t gfx_pixel_layout;
+
+// Layout of the byte-ordered R,G,B,A pixels accepted by gfx_sprite_create.
+extern const gfx_pixel_layout_t gfx_pixel_layout_rgba32;
+
+static inline pixel_t gfx_rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return (pixel_t)r << gfx_pixel_layout.r_shift | (pixel_t)g << gfx_pixel_layout.g_shift |
+           (pixel_t)b << gfx_pixel_layout.b_shift | (pixel_t)a << gfx_pixel_layout.a_shift;
+}
+
+#define GFX_RED(p)   ((uint8_t)((p) >> gfx_pixel_layout.r_shift))
+#define GFX_GREEN(p) ((uint8_t)((p) >> gfx_pixel_layout.g_shift))
+#define GFX_BLUE(p)  ((uint8_t)((p) >> gfx_pixel_layout.b_shift))
+#define GFX_ALPHA(p) ((uint8_t)((p) >> gfx_pixel_layout.a_shift))
+
+// How the context reacts when the window is resized.
+typedef enum {
+    GFX_RESIZE_STRETCH,    // stretch the background over the whole window (default)
+    GFX_RESIZE_LETTERBOX,  // keep the logical size and aspect ratio, letterbox on the GPU
+    GFX_RESIZE_GROW,       // resize the background to the window, 1 pixel = 1 window pixel
+} gfx_resize_policy_t;
+
+// Output formats of gfx_capture_start.
+typedef enum {
+    GFX_CAPTURE_Y4M,       // YUV4MPEG2 stream, 4:2:0 BT.601
+    GFX_CAPTURE_RAW_BGRA,  // raw frames, 4 bytes per pixel in byte order B,G,R,A
+} gfx_capture_format_t;
+
+// Asset pack file (see gfx_pack.c and tools/gfxpack.c), all fields little-endian.
+#define GFX_PACK_MAGIC    "GFXP"
+#define GFX_PACK_VERSION  1
+#define GFX_PACK_ALIGN    4096  // sprite pixels start on a page boundary
+#define GFX_PACK_NAME_LEN 64
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;     // number of entries following the header
+    uint32_t reserved;
+} gfx_pack_header_t;
+
+typedef struct {
+    char name[GFX_PACK_NAME_LEN];  // NUL-terminated
+    uint32_t format;    // SDL pixel format of the pixels (one of the 32-bit formats)
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;     // length of a row of pixels in bytes
+    uint64_t offset;    // from the start of the file
+} gfx_pack_entry_t;
+
+typedef struct gfx_pack_t gfx_pack_t;
+
+// Texture memory statistics (see gfx_memory_stats).
+typedef struct {
+    size_t bytes;           // memory held by resident textures
+    size_t peak_bytes;
+    size_t budget;          // 0 = unlimited
+    int textures;           // resident textures (background included)
+    int evicted;            // sprites currently evicted
+    uint64_t evictions;
+    uint64_t reloads;
+} gfx_memory_stats_t;
+
+// Per-pixel collision mask (see gfx_mask.c).
+typedef struct {
+    int width;
+    int height;
+    int words;              // 64-bit words per row
+    uint64_t *bits;         // rows of words, bit i of word k is pixel 64*k+i
+    SDL_Rect bounds;        // bounding box of the solid pixels
+} gfx_mask_t;
+
+// Spatial hash broadphase (see gfx_spatial.c).
+typedef struct gfx_spatial_t gfx_spatial_t;
+
+typedef struct {
+    int a;
+    int b;
+} gfx_spatial_pair_t;
+
+// Sprite instance, as given to gfx_sprite_layer_add.
+typedef struct {
+    float x;
+    float y;
+    float w;                // display size
+    float h;
+    float vx;               // velocity (see gfx_sprite_layer_move)
+    float vy;
+    int texture;            // texture id (see gfx_sprite_layer_texture)
+    SDL_Rect src;           // part of the texture to draw, w == 0 for all of it
+    int z;                  // drawing order, lowest first (int16 range)
+} gfx_sprite_instance_t;
+
+// Sprite instances stored as a structure of arrays (see gfx_sprite_layer.c).
+// Instance i is x[i], y[i], etc.: the arrays can be updated directly.
+typedef struct {
+    int count;
+    int capacity;
+    float *x;
+    float *y;
+    float *w;
+    float *h;
+    float *vx;
+    float *vy;
+    uint16_t *texture;
+    SDL_Rect *src;
+    int16_t *z;
+    SDL_Texture **textures; // sprites, indexed by texture id
+    int texture_count;
+    // Rendering scratch buffers.
+    int *visible;
+    int *sorted;
+    SDL_Vertex *vertices;
+    int *indices;
+    int quad_capacity;
+} gfx_sprite_layer_t;
+
+// Particle system, live particles packed first (see gfx_particles.c).
+typedef struct {
+    int count;
+    int capacity;
+    float *x;
+    float *y;
+    float *vx;
+    float *vy;
+    float *life;            // remaining lifetime
+    pixel_t *color;
+    float gravity_x;        // acceleration applied to every particle
+    float gravity_y;
+    uint32_t seed;          // random generator state
+    // Quad rendering buffers.
+    SDL_Vertex *vertices;
+    int *indices;
+    int quad_capacity;
+} gfx_particles_t;
+
+// Chunked tilemap (see gfx_tilemap.c).
+#define GFX_TILEMAP_CHUNK 16    // chunk side in tiles
+#define GFX_TILE_EMPTY 0xffff
+
+typedef struct gfx_tilemap_t gfx_tilemap_t;
+
+// Per-frame scratch memory (see gfx_arena.c).
+typedef struct gfx_arena_t gfx_arena_t;
+
+typedef struct {
+    size_t used;            // bytes allocated during the current frame
+    size_t capacity;        // bytes reserved by the arenas
+    size_t high_water;      // largest use of a frame so far
+    uint64_t grows;         // number of blocks allocated so far
+} gfx_frame_stats_t;
+
+// Input-to-photon latency, in milliseconds (see gfx_latency.c).
+#define GFX_LATENCY_BINS 256    // 1 ms bins, the last one counts all longer latencies
+
+typedef struct {
+    uint64_t count;         // inputs marked and presented
+    uint32_t min;
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t max;
+} gfx_latency_stats_t;
+
+// Render-to-texture target (see gfx_target.c).
+typedef struct gfx_target_t gfx_target_t;
+
+// Composited pixel layer, kept in a z-ordered list (see gfx_layer.c).
+#define GFX_LAYER_DIRTY_MAX 16  // dirty rectangles tracked before merging
+
+typedef struct gfx_layer_t {
+    struct gfx_layer_t *next;   // next layer in increasing z order
+    struct gfx_context_t *ctxt;
+    pixel_t *pixels;        // width*height pixels, modified by the application
+    int width;
+    int height;
+    int x;                  // position on the screen
+    int y;
+    int z;
+    bool visible;
+    SDL_BlendMode blend;
+    SDL_Texture *texture;
+    SDL_Rect dirty[GFX_LAYER_DIRTY_MAX];  // regions to upload before compositing
+    int dirty_count;
+} gfx_layer_t;
+
+// QOI image decoding state (see gfx_qoi.c).
+#define GFX_QOI_HEADER_SIZE 14
+
+typedef struct {
+    uint8_t r, g, b, a;
+} gfx_qoi_rgba_t;
+
+typedef struct {
+    int width;
+    int height;
+    int channels;
+    void *pixels;           // destination, in the native pixel format
+    int pitch;              // length of a destination row in bytes
+    int x;                  // position of the next pixel to decode
+    int y;
+    int run;
+    gfx_qoi_rgba_t px;
+    gfx_qoi_rgba_t index[64];
+} gfx_qoi_decoder_t;
+
+// Compressed image embedded at build time (see tools/gfxembed.c and the Makefile's
+// asset rules), RLE-encoded in two streams so that pixels stay 4-byte aligned.
+// The header is followed by control bytes, then (from the next multiple of 4)
+// by RGBA pixels. Control byte n is either a run (n & 0x80) of (n & 0x7f)+1
+// copies of the next pixel, or n+1 literal pixels.
+#define GFX_ASSET_MAGIC "GFXZ"
+
+typedef struct {
+    char magic[4];
+    uint32_t width;
+    uint32_t height;
+    uint32_t control_size;  // number of control bytes
+} gfx_asset_header_t;
+
+// Declare an image compiled into the program by the Makefile (examples/foo.png
+// becomes gfx_asset_foo, linked from examples/foo.asset.o).
+#define GFX_ASSET_DECLARE(name) extern const uint8_t gfx_asset_##name[]
+
+// Framebuffer stream (see gfx_stream.c), fields in host byte order. Each message
+// is a gfx_stream_frame_t followed by the tiles that changed since the previous
+// one: a gfx_stream_tile_t, its control bytes padded to a multiple of 4, then
+// its RGBA pixels, RLE-encoded like the assets.
+#define GFX_STREAM_MAGIC "GFXS"
+#define GFX_STREAM_TILE 64      // tile side in pixels
+
+typedef struct {
+    char magic[4];
+    uint32_t frame;         // sender's frame number
+    uint32_t width;         // frame size: all tiles are sent again when it changes
+    uint32_t height;
+    uint32_t tiles;         // number of tiles following
+} gfx_stream_frame_t;
+
+typedef struct {
+    uint16_t x;             // position and size of the tile in pixels
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint32_t control_size;  // number of control bytes
+    uint32_t pixel_count;   // number of RLE pixels
+} gfx_stream_tile_t;
+
+typedef struct {
+    uint64_t frames;        // messages sent
+    uint64_t tiles;         // tiles sent
+    uint64_t bytes;         // bytes sent
+    uint64_t dropped;       // frames skipped while the previous one was being sent
+    bool connected;         // a viewer is connected
+} gfx_stream_stats_t;
+
+// Shared-memory frame export (see gfx_shm.c). The region starts with this
+// header; frames go round-robin through GFX_SHM_SLOTS slots, each guarded by a
+// seqlock: its seq is odd while the slot is written, and a reader is sure to
+// have seen a complete frame if seq is even and unchanged after reading.
+#define GFX_SHM_MAGIC "GFXM"
+#define GFX_SHM_SLOTS 3
+
+typedef struct {
+    uint32_t seq;           // seqlock: odd while being written, 0 if never written
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;         // length of a row in bytes
+    uint64_t frame;         // frame number (ctxt->frame)
+    uint64_t offset;        // offset of the pixels from the start of the region
+} gfx_shm_slot_t;
+
+typedef struct {
+    char magic[4];
+    uint32_t format;        // SDL pixel format of the frames
+    uint64_t size;          // size of the region
+    uint64_t slot_capacity; // bytes available for the pixels of a slot
+    uint32_t latest;        // slot of the last completed frame
+    uint32_t reserved;
+    gfx_shm_slot_t slots[GFX_SHM_SLOTS];
+} gfx_shm_header_t;
+
+// Frame reassembled by gfx_stream_receive.
+typedef struct {
+    uint32_t *pixels;       // width*height pixels in gfx_pixel_layout_rgba32
+    int width;
+    int height;
+    uint32_t frame;         // sender's frame number
+    int tiles;              // number of tiles updated by the last message
+} gfx_stream_view_t;
+
+// Trace markers (see gfx_trace.c): GFX_TRACE_SCOPE("name") records the time
+// spent until the end of the enclosing block while tracing is enabled, for a
+// Chrome/Perfetto trace. The name must be a string that outlives the trace
+// (e.g. a literal). Build with -DGFX_TRACE_DISABLE to compile markers out.
+#define GFX_TRACE_EVENTS 16384  // events kept per thread, a power of 2
+
+typedef struct {
+    const char *name;
+    uint64_t start;         // performance counter, 0 if tracing was disabled
+} gfx_trace_scope_t;
+
+extern int gfx_trace_enabled;
+void gfx_trace_record(const char *name, uint64_t start, uint64_t end);
+
+static inline gfx_trace_scope_t gfx_trace_scope_begin(const char *name) {
+    return (gfx_trace_scope_t){ name, gfx_trace_enabled ? SDL_GetPerformanceCounter() : 0 };
+}
+
+static inline void gfx_trace_scope_end(gfx_trace_scope_t *scope) {
+    if (scope->start) {
+        gfx_trace_record(scope->name, scope->start, SDL_GetPerformanceCounter());
+    }
+}
+
+#define GFX_TRACE_CONCAT_(a, b) a##b
+#define GFX_TRACE_CONCAT(a, b) GFX_TRACE_CONCAT_(a, b)
+#ifdef GFX_TRACE_DISABLE
+#define GFX_TRACE_SCOPE(name) ((void)0)
+#else
+#define GFX_TRACE_SCOPE(name) \
+    gfx_trace_scope_t GFX_TRACE_CONCAT(gfx_trace_scope_, __LINE__) \
+        __attribute__((cleanup(gfx_trace_scope_end))) = gfx_trace_scope_begin(name)
+#endif
+
+typedef struct gfx_context_t {
     SDL_Window *window;
     SDL_Renderer *renderer;
     SDL_Texture *background_texture;
@@ -33,6 +364,35 @@ typedef struct {
     int pitch;
     int width;
     int height;
+    gfx_resize_policy_t resize_policy;
+    int capacity_width;    // allocated size of background/background_texture,
+    int capacity_height;   // may exceed width/height with GFX_RESIZE_GROW
+    int window_width;
+    int window_height;
+    float mouse_scale_x;   // window to logical coordinates transform,
+    float mouse_scale_y;   // updated whenever the window is resized
+    float mouse_offset_x;
+    float mouse_offset_y;
+    struct gfx_capture_t *capture;  // active frame capture, NULL if none
+    struct gfx_stream_t *stream;    // framebuffer stream server, NULL if none
+    struct gfx_shm_t *shm;          // shared-memory frame export, NULL if none
+    struct gfx_input_t *input;      // active input recording/replay, NULL if none
+    uint32_t input_timestamp;       // SDL timestamp of the last input event consumed
+    struct gfx_latency_t *latency;  // input-to-photon latency, NULL until used
+    uint32_t frame;                 // number of frames presented so far
+    int mouse_window_x;             // mouse state tracked from the consumed events,
+    int mouse_window_y;             // in window coordinates
+    uint32_t mouse_buttons;
+    struct gfx_texture_registry_t *textures;  // textures created by the context
+    struct gfx_context_t *next_context;       // next live context (see gfx_sprite_destroy)
+    int scroll_x;           // scroll origin: buffer position of screen pixel (0, 0)
+    int scroll_y;
+    gfx_layer_t *layers;    // layers composited by gfx_present, by increasing z
+    bool layers_rendered;   // layers already composited this frame
+    uint32_t targets_reset; // number of times the renderer lost its render targets
+    gfx_arena_t *frame_arena;       // scratch memory of the render thread
+    gfx_arena_t **thread_arenas;    // scratch memory of worker threads
+    int thread_arena_count;
 } gfx_context_t;
 
 gfx_context_t* gfx_create(char *text, int width, int height);
@@ -41,14 +401,136 @@ void gfx_destroy(gfx_context_t *ctxt);
 void gfx_background_putpixel(gfx_context_t *ctxt, int x, int y, pixel_t color);
 void gfx_background_clear(gfx_context_t *ctxt, pixel_t color);
 void gfx_background_update(gfx_context_t *ctxt);
+void gfx_background_scroll(gfx_context_t *ctxt, int dx, int dy);
 
 SDL_Texture *gfx_sprite_load(gfx_context_t *ctxt, char *filename);
+int gfx_sprite_load_many(gfx_context_t *ctxt, const char **paths, int n, SDL_Texture **out);
 SDL_Texture *gfx_sprite_create(gfx_context_t *ctxt, uint8_t *pixels, int width, int height);
+SDL_Texture *gfx_sprite_create_layout(gfx_context_t *ctxt, const void *pixels, int pitch, int width, int height, const gfx_pixel_layout_t *layout);
+SDL_Texture *gfx_sprite_create_embedded(gfx_context_t *ctxt, const uint8_t *asset);
+int gfx_rle_encode(const uint32_t *pixels, int count, uint8_t *control, uint32_t *out, uint32_t *control_size);
+int gfx_rle_decode(const uint8_t *control, uint32_t control_size, const uint32_t *src, uint32_t src_count, void *dst, const gfx_pixel_layout_t *dst_layout, int pitch, int width, int height);
 void gfx_sprite_destroy(SDL_Texture *sprite);
 void gfx_sprite_render(gfx_context_t *ctxt, SDL_Texture *sprite, int x, int y, int sprite_width, int sprite_height);
 
+gfx_mask_t *gfx_mask_create(const void *pixels, int pitch, int width, int height, const gfx_pixel_layout_t *layout, uint8_t threshold);
+gfx_mask_t *gfx_sprite_mask(gfx_context_t *ctxt, SDL_Texture *sprite, uint8_t threshold);
+void gfx_mask_destroy(gfx_mask_t *mask);
+bool gfx_mask_bounds_overlap(const gfx_mask_t *a, int ax, int ay, const gfx_mask_t *b, int bx, int by);
+bool gfx_mask_overlap(const gfx_mask_t *a, int ax, int ay, const gfx_mask_t *b, int bx, int by);
+
+gfx_sprite_layer_t *gfx_sprite_layer_create(int capacity);
+void gfx_sprite_layer_destroy(gfx_sprite_layer_t *layer);
+int gfx_sprite_layer_reserve(gfx_sprite_layer_t *layer, int capacity);
+int gfx_sprite_layer_texture(gfx_sprite_layer_t *layer, SDL_Texture *sprite);
+int gfx_sprite_layer_add(gfx_sprite_layer_t *layer, const gfx_sprite_instance_t *instances, int n);
+void gfx_sprite_layer_remove(gfx_sprite_layer_t *layer, int *indices, int n);
+void gfx_sprite_layer_move(gfx_sprite_layer_t *layer, float dt);
+int gfx_sprite_layer_render(gfx_context_t *ctxt, gfx_sprite_layer_t *layer);
+
+gfx_particles_t *gfx_particles_create(int capacity);
+void gfx_particles_destroy(gfx_particles_t *ps);
+int gfx_particles_emit(gfx_particles_t *ps, int n, float x, float y, float speed, float life, pixel_t color);
+void gfx_particles_update(gfx_particles_t *ps, float dt);
+void gfx_particles_render(gfx_context_t *ctxt, gfx_particles_t *ps);
+int gfx_particles_render_quads(gfx_context_t *ctxt, gfx_particles_t *ps, float size);
+
+gfx_tilemap_t *gfx_tilemap_create(gfx_context_t *ctxt, SDL_Texture *tileset, int tile_size, int width, int height);
+void gfx_tilemap_destroy(gfx_tilemap_t *tm);
+void gfx_tilemap_set(gfx_tilemap_t *tm, int x, int y, uint16_t tile);
+uint16_t gfx_tilemap_get(gfx_tilemap_t *tm, int x, int y);
+void gfx_tilemap_invalidate(gfx_tilemap_t *tm);
+void gfx_tilemap_render(gfx_context_t *ctxt, gfx_tilemap_t *tm, int view_x, int view_y);
+
+gfx_layer_t *gfx_layer_create(gfx_context_t *ctxt, int width, int height, int z, SDL_BlendMode blend);
+void gfx_layer_destroy(gfx_layer_t *layer);
+void gfx_layer_putpixel(gfx_layer_t *layer, int x, int y, pixel_t color);
+void gfx_layer_clear(gfx_layer_t *layer, pixel_t color);
+void gfx_layer_dirty(gfx_layer_t *layer, const SDL_Rect *rect);
+void gfx_layers_render(gfx_context_t *ctxt);
+
+void gfx_trace_enable(bool enabled);
+int gfx_trace_dump(const char *path);
+int gfx_trace_dump_on_signal(int signum, const char *path);
+
+void *gfx_frame_alloc(gfx_context_t *ctxt, size_t size, size_t align);
+int gfx_frame_threads_set(gfx_context_t *ctxt, int threads);
+gfx_arena_t *gfx_frame_arena(gfx_context_t *ctxt, int thread);
+void *gfx_arena_alloc(gfx_arena_t *arena, size_t size, size_t align);
+void gfx_frame_stats(gfx_context_t *ctxt, gfx_frame_stats_t *stats);
+
+uint32_t gfx_input_timestamp(gfx_context_t *ctxt);
+int gfx_latency_mark(gfx_context_t *ctxt, uint32_t timestamp);
+int gfx_latency_log(gfx_context_t *ctxt, uint32_t interval);
+void gfx_latency_stats(gfx_context_t *ctxt, gfx_latency_stats_t *stats);
+
+gfx_target_t *gfx_target_create(gfx_context_t *ctxt, int width, int height);
+void gfx_target_destroy(gfx_target_t *target);
+int gfx_target_begin(gfx_target_t *target);
+void gfx_target_end(gfx_target_t *target);
+void gfx_target_invalidate(gfx_target_t *target);
+bool gfx_target_valid(gfx_target_t *target);
+SDL_Texture *gfx_target_sprite(gfx_target_t *target);
+
+gfx_spatial_t *gfx_spatial_create(int cell_size);
+void gfx_spatial_destroy(gfx_spatial_t *s);
+int gfx_spatial_set(gfx_spatial_t *s, int id, const SDL_Rect *rect);
+void gfx_spatial_remove(gfx_spatial_t *s, int id);
+int gfx_spatial_update(gfx_spatial_t *s);
+int gfx_spatial_query(gfx_spatial_t *s, const SDL_Rect *region, int *out, int max);
+int gfx_spatial_pick(gfx_spatial_t *s, int x, int y, int *out, int max);
+int gfx_spatial_pairs(gfx_spatial_t *s, gfx_spatial_pair_t *out, int max);
+
+int gfx_background_save(gfx_context_t *ctxt, const char *filename);
+
 void gfx_present(gfx_context_t *ctxt);
 
+void gfx_memory_budget_set(gfx_context_t *ctxt, size_t bytes);
+void gfx_memory_stats(gfx_context_t *ctxt, gfx_memory_stats_t *stats);
+
+void gfx_resize_policy_set(gfx_context_t *ctxt, gfx_resize_policy_t policy);
+void gfx_mouse_to_logical(gfx_context_t *ctxt, int window_x, int window_y, int *x, int *y);
+uint32_t gfx_mouse_state(gfx_context_t *ctxt, int *x, int *y);
+
+int gfx_capture_start(gfx_context_t *ctxt, const char *path, gfx_capture_format_t format);
+int gfx_capture_start_fd(gfx_context_t *ctxt, int fd, gfx_capture_format_t format);
+void gfx_capture_frame(gfx_context_t *ctxt);
+void gfx_capture_stats(gfx_context_t *ctxt, uint64_t *captured, uint64_t *dropped);
+void gfx_capture_stop(gfx_context_t *ctxt);
+
+int gfx_shm_start(gfx_context_t *ctxt, const char *name);
+void gfx_shm_stop(gfx_context_t *ctxt);
+const gfx_shm_header_t *gfx_shm_attach(const char *name, int fd);
+void gfx_shm_detach(const gfx_shm_header_t *shm);
+const gfx_shm_slot_t *gfx_shm_acquire(const gfx_shm_header_t *shm, uint32_t *seq);
+bool gfx_shm_release(const gfx_shm_slot_t *slot, uint32_t seq);
+
+int gfx_stream_start(gfx_context_t *ctxt, const char *address);
+void gfx_stream_stats(gfx_context_t *ctxt, gfx_stream_stats_t *stats);
+void gfx_stream_stop(gfx_context_t *ctxt);
+int gfx_stream_connect(const char *address);
+int gfx_stream_receive(int fd, gfx_stream_view_t *view);
+void gfx_stream_view_free(gfx_stream_view_t *view);
+
+int gfx_qoi_decoder_init(gfx_qoi_decoder_t *dec, const uint8_t *header);
+size_t gfx_qoi_decoder_feed(gfx_qoi_decoder_t *dec, const uint8_t *data, size_t size);
+bool gfx_qoi_file(const char *filename);
+uint8_t *gfx_qoi_encode(const pixel_t *pixels, int pitch, int width, int height, int threads, size_t *size);
+int gfx_qoi_save(const char *filename, const pixel_t *pixels, int pitch, int width, int height, int threads);
+
+gfx_pack_t *gfx_pack_open(const char *path);
+SDL_Texture *gfx_pack_sprite(gfx_context_t *ctxt, gfx_pack_t *pack, const char *name);
+void gfx_pack_close(gfx_pack_t *pack);
+
+int gfx_input_record(gfx_context_t *ctxt, const char *path);
+int gfx_input_replay(gfx_context_t *ctxt, const char *path);
+bool gfx_input_replay_done(gfx_context_t *ctxt);
+void gfx_input_stop(gfx_context_t *ctxt);
+int gfx_input_poll(gfx_context_t *ctxt, SDL_Event *event);
+
 SDL_Keycode gfx_keypressed();
 
+const gfx_pixel_layout_t *gfx_pixel_layout_find(Uint32 format);
+void gfx_pixels_convert(uint32_t *dst, const gfx_pixel_layout_t *dst_layout, const uint32_t *src, const gfx_pixel_layout_t *src_layout, int count);
+
 #endif
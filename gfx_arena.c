@@ -0,0 +1,205 @@
+/// @file gfx_arena.c
+/// Per-frame scratch memory: bump allocators reset at each gfx_present.
+/// An arena hands out memory from its current block and chains a block twice
+/// as large when it runs out. At reset, an arena that needed several blocks
+/// replaces them with one block as large as all of them together, so that once
+/// the frames' needs are stable, they are served without any allocation.
+/// Besides the context's arena (render thread), worker threads get their own
+/// sub-arenas, so that they never contend on a lock.
+
+#include "gfx_internal.h"
+#include <stddef.h>
+
+#define ARENA_MIN_BLOCK 65536
+
+typedef struct arena_block_t {
+    struct arena_block_t *next;     // previous (smaller) block of the frame
+    size_t size;                    // bytes available after the header
+    size_t used;
+    max_align_t data[];
+} arena_block_t;
+
+struct gfx_arena_t {
+    arena_block_t *blocks;          // current block first
+    int block_count;
+    size_t used;                    // bytes handed out this frame, padding included
+    size_t capacity;                // total size of the blocks
+    size_t high_water;              // largest frame use so far
+    uint64_t grows;                 // number of blocks allocated
+};
+
+/// Add a block to an arena, of at least a given size.
+/// @return 0 on success, -1 on failure.
+static int arena_grow(gfx_arena_t *arena, size_t min_size) {
+    size_t size = arena->blocks ? 2*arena->blocks->size : ARENA_MIN_BLOCK;
+    while (size < min_size) size *= 2;
+    arena_block_t *block = malloc(sizeof(arena_block_t) + size);
+    if (!block) {
+        return -1;
+    }
+    block->next = arena->blocks;
+    block->size = size;
+    block->used = 0;
+    arena->blocks = block;
+    arena->block_count++;
+    arena->capacity += size;
+    arena->grows++;
+    return 0;
+}
+
+/// Allocate memory from an arena, valid until the next gfx_present.
+/// Not thread-safe: each thread must use its own arena (see gfx_frame_arena).
+/// @param arena the arena.
+/// @param size size in bytes.
+/// @param align alignment, a power of 2, or 0 for the alignment of any type.
+/// @return the memory or NULL on failure.
+void *gfx_arena_alloc(gfx_arena_t *arena, size_t size, size_t align) {
+    if (align == 0) {
+        align = _Alignof(max_align_t);
+    }
+    if (align & (align-1)) {
+        return NULL;
+    }
+    for (int attempt = 0; attempt < 2; attempt++) {
+        arena_block_t *block = arena->blocks;
+        if (block) {
+            uintptr_t base = (uintptr_t)block->data;
+            uintptr_t p = (base + block->used + align-1) & ~(uintptr_t)(align-1);
+            if (p - base <= block->size && size <= block->size - (p - base)) {
+                arena->used += p + size - (base + block->used);
+                block->used = p + size - base;
+                return (void *)p;
+            }
+        }
+        if (attempt == 0 && arena_grow(arena, size + align) < 0) {
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+/// Make an arena's memory available again, merging its blocks if there were several.
+static void arena_reset(gfx_arena_t *arena) {
+    arena->high_water = SDL_max(arena->high_water, arena->used);
+    arena->used = 0;
+    if (arena->block_count > 1) {
+        size_t capacity = arena->capacity;
+        while (arena->blocks) {
+            arena_block_t *next = arena->blocks->next;
+            free(arena->blocks);
+            arena->blocks = next;
+        }
+        arena->block_count = 0;
+        arena->capacity = 0;
+        arena_grow(arena, capacity);  // on failure, blocks are chained again next frame
+    } else if (arena->blocks) {
+        arena->blocks->used = 0;
+    }
+}
+
+/// Free an arena and its blocks.
+static void arena_free(gfx_arena_t *arena) {
+    if (!arena) {
+        return;
+    }
+    while (arena->blocks) {
+        arena_block_t *next = arena->blocks->next;
+        free(arena->blocks);
+        arena->blocks = next;
+    }
+    free(arena);
+}
+
+/// Allocate scratch memory for the current frame from the context's arena,
+/// e.g. sort keys or vertices: it is valid until the next gfx_present, which
+/// reclaims it all at once. Render thread only; see gfx_frame_arena for workers.
+/// @param ctxt graphic context.
+/// @param size size in bytes.
+/// @param align alignment, a power of 2, or 0 for the alignment of any type.
+/// @return the memory or NULL on failure.
+void *gfx_frame_alloc(gfx_context_t *ctxt, size_t size, size_t align) {
+    if (!ctxt->frame_arena) {
+        ctxt->frame_arena = calloc(1, sizeof(gfx_arena_t));
+        if (!ctxt->frame_arena) {
+            return NULL;
+        }
+    }
+    return gfx_arena_alloc(ctxt->frame_arena, size, align);
+}
+
+/// Create the sub-arenas of worker threads, reset at gfx_present like the
+/// context's arena. Call it from the render thread, outside parallel sections.
+/// @param ctxt graphic context.
+/// @param threads number of sub-arenas (existing ones are kept, extra ones freed).
+/// @return 0 on success, -1 on failure.
+int gfx_frame_threads_set(gfx_context_t *ctxt, int threads) {
+    threads = SDL_max(threads, 0);
+    for (int i = threads; i < ctxt->thread_arena_count; i++) {
+        arena_free(ctxt->thread_arenas[i]);
+    }
+    gfx_arena_t **arenas = threads ? realloc(ctxt->thread_arenas, threads*sizeof(gfx_arena_t *)) : NULL;
+    if (threads && !arenas) {
+        ctxt->thread_arena_count = SDL_min(ctxt->thread_arena_count, threads);
+        return -1;
+    }
+    if (!threads) {
+        free(ctxt->thread_arenas);
+    }
+    for (int i = ctxt->thread_arena_count; i < threads; i++) {
+        arenas[i] = calloc(1, sizeof(gfx_arena_t));
+        if (!arenas[i]) {
+            ctxt->thread_arenas = arenas;
+            ctxt->thread_arena_count = i;
+            return -1;
+        }
+    }
+    ctxt->thread_arenas = arenas;
+    ctxt->thread_arena_count = threads;
+    return 0;
+}
+
+/// Get the sub-arena of a worker thread, to allocate from with gfx_arena_alloc.
+/// @param ctxt graphic context.
+/// @param thread index of the worker, below the count given to gfx_frame_threads_set.
+/// @return the arena or NULL if there is no such worker.
+gfx_arena_t *gfx_frame_arena(gfx_context_t *ctxt, int thread) {
+    if (thread < 0 || thread >= ctxt->thread_arena_count) {
+        return NULL;
+    }
+    return ctxt->thread_arenas[thread];
+}
+
+/// Retrieve the memory use of the frame arenas, sub-arenas included.
+/// @param ctxt graphic context.
+/// @param stats returned statistics.
+void gfx_frame_stats(gfx_context_t *ctxt, gfx_frame_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    for (int i = -1; i < ctxt->thread_arena_count; i++) {
+        const gfx_arena_t *arena = i < 0 ? ctxt->frame_arena : ctxt->thread_arenas[i];
+        if (arena) {
+            stats->used += arena->used;
+            stats->capacity += arena->capacity;
+            stats->high_water += SDL_max(arena->high_water, arena->used);
+            stats->grows += arena->grows;
+        }
+    }
+}
+
+/// Reclaim the memory allocated during the frame (called by gfx_present).
+/// @param ctxt graphic context.
+void gfx_frame_reset(gfx_context_t *ctxt) {
+    if (ctxt->frame_arena) {
+        arena_reset(ctxt->frame_arena);
+    }
+    for (int i = 0; i < ctxt->thread_arena_count; i++) {
+        arena_reset(ctxt->thread_arenas[i]);
+    }
+}
+
+/// Free the frame arenas (called by gfx_destroy).
+/// @param ctxt graphic context.
+void gfx_frame_free(gfx_context_t *ctxt) {
+    gfx_frame_threads_set(ctxt, 0);
+    arena_free(ctxt->frame_arena);
+    ctxt->frame_arena = NULL;
+}
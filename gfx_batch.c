@@ -0,0 +1,159 @@
+/// @file gfx_batch.c
+/// Batch sprite loading: files are read ahead, decoded in parallel on all cores,
+/// then uploaded to textures in a single pass on the calling (render) thread.
+
+#include "gfx_internal.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+typedef struct {
+    const char *path;
+    SDL_Surface *surface;   // decoded by SDL_image, converted to the native format
+    pixel_t *pixels;        // or decoded by gfxlib (QOI)
+    int pitch;
+    int width;
+    int height;
+} batch_item_t;
+
+typedef struct {
+    batch_item_t *items;
+    int count;
+    SDL_atomic_t next;      // next item to decode
+} batch_t;
+
+/// Decode a whole QOI file in memory, to native pixels.
+/// @return 0 on success, -1 on failure.
+static int batch_decode_qoi(batch_item_t *item) {
+    int fd = open(item->path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0 || st.st_size < GFX_QOI_HEADER_SIZE) {
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    uint8_t *data = malloc(st.st_size);
+    ssize_t len = 0, n = 1;
+    while (data && len < st.st_size && n > 0) {
+        n = read(fd, data+len, st.st_size-len);
+        if (n > 0) len += n;
+    }
+    close(fd);
+
+    gfx_qoi_decoder_t dec;
+    if (!data || len < GFX_QOI_HEADER_SIZE || gfx_qoi_decoder_init(&dec, data) < 0) {
+        free(data);
+        return -1;
+    }
+    item->pixels = malloc((size_t)dec.width*dec.height*sizeof(pixel_t));
+    if (item->pixels) {
+        dec.pixels = item->pixels;
+        dec.pitch = dec.width*sizeof(pixel_t);
+        gfx_qoi_decoder_feed(&dec, data+GFX_QOI_HEADER_SIZE, len-GFX_QOI_HEADER_SIZE);
+    }
+    free(data);
+    if (!item->pixels || dec.y < dec.height) {
+        free(item->pixels);
+        item->pixels = NULL;
+        return -1;
+    }
+    item->pitch = dec.pitch;
+    item->width = dec.width;
+    item->height = dec.height;
+    return 0;
+}
+
+/// Decode an image with SDL_image, then convert it to native pixels.
+/// @return 0 on success, -1 on failure.
+static int batch_decode_image(batch_item_t *item) {
+    SDL_Surface *loaded = IMG_Load(item->path);
+    if (!loaded) {
+        return -1;
+    }
+    SDL_Surface *s = loaded;
+    if (loaded->format->format != SDL_PIXELFORMAT_RGBA32 && loaded->format->format != gfx_pixel_layout.format) {
+        s = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(loaded);
+        if (!s) {
+            return -1;
+        }
+    }
+    if (s->format->format != gfx_pixel_layout.format) {
+        SDL_LockSurface(s);
+        for (int j = 0; j < s->h; j++) {
+            uint32_t *row = (uint32_t *)((uint8_t *)s->pixels + s->pitch*j);
+            gfx_pixels_convert(row, &gfx_pixel_layout, row, &gfx_pixel_layout_rgba32, s->w);
+        }
+        SDL_UnlockSurface(s);
+    }
+    item->surface = s;
+    item->pitch = s->pitch;
+    item->width = s->w;
+    item->height = s->h;
+    return 0;
+}
+
+/// Worker thread: decodes items until there are none left.
+static int batch_worker(void *data) {
+    batch_t *batch = data;
+    int i;
+    while ((i = SDL_AtomicAdd(&batch->next, 1)) < batch->count) {
+        batch_item_t *item = &batch->items[i];
+        if (gfx_qoi_file(item->path)) {
+            batch_decode_qoi(item);
+        } else {
+            batch_decode_image(item);
+        }
+    }
+    return 0;
+}
+
+/// Load many sprites at once.
+/// All files are read ahead and decoded in parallel (one thread per CPU); the
+/// textures are then created on the calling thread, which must be the render thread.
+/// @param ctxt graphic context.
+/// @param paths paths of the files to load.
+/// @param n number of files.
+/// @param out receives the n sprites; a sprite is NULL if its file failed to load.
+/// @return the number of files that failed to load.
+int gfx_sprite_load_many(gfx_context_t *ctxt, const char **paths, int n, SDL_Texture **out) {
+    batch_t batch = { .count = n };
+    batch.items = calloc(n, sizeof(batch_item_t));
+    if (!batch.items) {
+        for (int i = 0; i < n; i++) out[i] = NULL;
+        return n;
+    }
+
+    // Let the kernel fetch every file while the first ones are being decoded.
+    for (int i = 0; i < n; i++) {
+        batch.items[i].path = paths[i];
+        int fd = open(paths[i], O_RDONLY);
+        if (fd >= 0) {
+            posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+            close(fd);
+        }
+    }
+
+    int threads = SDL_max(1, SDL_min(SDL_GetCPUCount(), n));
+    SDL_Thread **workers = calloc(threads, sizeof(SDL_Thread *));
+    for (int t = 1; workers && t < threads; t++) {
+        workers[t] = SDL_CreateThread(batch_worker, "gfx_load", &batch);
+    }
+    batch_worker(&batch);
+    for (int t = 1; workers && t < threads; t++) {
+        if (workers[t]) SDL_WaitThread(workers[t], NULL);
+    }
+    free(workers);
+
+    int failed = 0;
+    for (int i = 0; i < n; i++) {
+        batch_item_t *item = &batch.items[i];
+        const void *pixels = item->surface ? item->surface->pixels : item->pixels;
+        SDL_Texture *tex = pixels ? gfx_sprite_texture_create(ctxt, pixels, item->pitch, item->width, item->height, &gfx_pixel_layout) : NULL;
+        out[i] = gfx_texture_register(ctxt, tex, item->path);
+        failed += out[i] == NULL;
+        if (item->surface) SDL_FreeSurface(item->surface);
+        free(item->pixels);
+    }
+    free(batch.items);
+    return failed;
+}
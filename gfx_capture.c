@@ -0,0 +1,370 @@
+/// @file gfx_capture.c
+/// Asynchronous capture of the background buffer to a Y4M or raw BGRA stream.
+/// Frames are snapshotted at gfx_present into a ring of preallocated buffers and
+/// written out by a dedicated thread, so the render thread never waits on I/O.
+
+#include "gfx_internal.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define CAPTURE_RING_SIZE 4
+#define CAPTURE_FPS 60
+
+struct gfx_capture_t {
+    gfx_capture_format_t format;
+    int fd;
+    bool close_fd;
+    int width;
+    int height;
+    pixel_t *ring[CAPTURE_RING_SIZE];  // snapshots, width*height packed pixels each
+    int head;                          // next slot written by the render thread
+    int tail;                          // next slot written out by the writer thread
+    int count;                         // number of slots waiting to be written
+    bool stopping;
+    bool failed;                       // write error, frames are dropped from then on
+    uint8_t *out;                      // writer thread's conversion buffer
+    size_t out_size;
+    uint64_t captured;
+    uint64_t dropped;
+    SDL_mutex *lock;
+    SDL_cond *cond;
+    SDL_Thread *thread;
+};
+
+// Byte order B,G,R,A whatever the host endianness.
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+static const gfx_pixel_layout_t layout_bgra32 = { SDL_PIXELFORMAT_BGRA8888, 8, 16, 24, 0 };
+#else
+static const gfx_pixel_layout_t layout_bgra32 = { SDL_PIXELFORMAT_ARGB8888, 16, 8, 0, 24 };
+#endif
+
+/// Write a whole buffer, retrying on short writes.
+/// Called by the writer thread only, which blocks SIGPIPE: a reader that went
+/// away (e.g. an encoder reading "-") fails the write with EPIPE, and the
+/// SIGPIPE left pending is consumed instead of killing the application.
+/// @return 0 on success, -1 on error.
+static int write_all(int fd, const void *buf, size_t size) {
+    const uint8_t *p = buf;
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EPIPE) {
+                sigset_t sigpipe;
+                sigemptyset(&sigpipe);
+                sigaddset(&sigpipe, SIGPIPE);
+                struct timespec no_wait = { 0, 0 };
+                while (sigtimedwait(&sigpipe, NULL, &no_wait) < 0 && errno == EINTR) {
+                }
+            }
+            return -1;
+        }
+        p += n;
+        size -= n;
+    }
+    return 0;
+}
+
+/// BT.601 limited range conversion of a single pixel.
+static inline uint8_t rgb_to_y(int r, int g, int b) { return ((66*r + 129*g + 25*b + 128) >> 8) + 16; }
+static inline uint8_t rgb_to_u(int r, int g, int b) { return ((-38*r - 74*g + 112*b + 128) >> 8) + 128; }
+static inline uint8_t rgb_to_v(int r, int g, int b) { return ((112*r - 94*g - 18*b + 128) >> 8) + 128; }
+
+#ifdef __SSE2__
+/// Extract one 8-bit channel of 8 pixels as 16-bit lanes.
+static inline __m128i channel_epi16(__m128i lo, __m128i hi, __m128i shift) {
+    const __m128i mask = _mm_set1_epi32(0xff);
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(lo, shift), mask),
+                           _mm_and_si128(_mm_srl_epi32(hi, shift), mask));
+}
+
+/// Sum horizontally adjacent pairs of 16 channel values (two vectors of 8 lanes).
+static inline __m128i pair_sums_epi16(__m128i a, __m128i b) {
+    const __m128i ones = _mm_set1_epi16(1);
+    return _mm_packs_epi32(_mm_madd_epi16(a, ones), _mm_madd_epi16(b, ones));
+}
+
+/// Weighted sum of 3 channels: (cr*r + cg*g + cb*b + 128) >> 8, 16-bit lanes.
+/// Luma sums exceed 32767 so the shift is logical for it, arithmetic for chroma.
+static inline __m128i weighted_epi16(__m128i r, __m128i g, __m128i b, int cr, int cg, int cb, bool is_signed) {
+    __m128i sum = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(cr)), _mm_mullo_epi16(g, _mm_set1_epi16(cg)));
+    sum = _mm_add_epi16(sum, _mm_mullo_epi16(b, _mm_set1_epi16(cb)));
+    sum = _mm_add_epi16(sum, _mm_set1_epi16(128));
+    return is_signed ? _mm_srai_epi16(sum, 8) : _mm_srli_epi16(sum, 8);
+}
+#endif
+
+/// Convert a frame to planar YUV 4:2:0 (Y4M "C420jpeg").
+/// Chroma is computed from the average of each 2x2 block.
+/// @param src width*height packed pixels.
+/// @param width frame width.
+/// @param height frame height.
+/// @param out destination, Y plane followed by U and V planes.
+static void frame_to_yuv420(const pixel_t *src, int width, int height, uint8_t *out) {
+    const gfx_pixel_layout_t *l = &gfx_pixel_layout;
+    int cw = (width+1)/2, ch = (height+1)/2;
+    uint8_t *y_plane = out, *u_plane = out + width*height, *v_plane = u_plane + cw*ch;
+
+    for (int j = 0; j < height; j++) {
+        const pixel_t *row = src + width*j;
+        uint8_t *dst = y_plane + width*j;
+        int i = 0;
+#ifdef __SSE2__
+        const __m128i rs = _mm_cvtsi32_si128(l->r_shift), gs = _mm_cvtsi32_si128(l->g_shift), bs = _mm_cvtsi32_si128(l->b_shift);
+        for (; i+8 <= width; i += 8) {
+            __m128i lo = _mm_loadu_si128((const __m128i *)(row+i));
+            __m128i hi = _mm_loadu_si128((const __m128i *)(row+i+4));
+            __m128i y = weighted_epi16(channel_epi16(lo, hi, rs), channel_epi16(lo, hi, gs), channel_epi16(lo, hi, bs), 66, 129, 25, false);
+            y = _mm_add_epi16(y, _mm_set1_epi16(16));
+            _mm_storel_epi64((__m128i *)(dst+i), _mm_packus_epi16(y, y));
+        }
+#endif
+        for (; i < width; i++) {
+            pixel_t p = row[i];
+            dst[i] = rgb_to_y(GFX_RED(p), GFX_GREEN(p), GFX_BLUE(p));
+        }
+    }
+
+    for (int j = 0; j < ch; j++) {
+        const pixel_t *row0 = src + width*(2*j);
+        const pixel_t *row1 = src + width*SDL_min(2*j+1, height-1);
+        uint8_t *u = u_plane + cw*j, *v = v_plane + cw*j;
+        int i = 0;
+#ifdef __SSE2__
+        const __m128i rs = _mm_cvtsi32_si128(l->r_shift), gs = _mm_cvtsi32_si128(l->g_shift), bs = _mm_cvtsi32_si128(l->b_shift);
+        const __m128i two = _mm_set1_epi16(2);
+        // 16 source pixels of each row give 8 chroma samples.
+        for (; 2*i+16 <= width; i += 8) {
+            __m128i a0 = _mm_loadu_si128((const __m128i *)(row0+2*i));
+            __m128i a1 = _mm_loadu_si128((const __m128i *)(row0+2*i+4));
+            __m128i a2 = _mm_loadu_si128((const __m128i *)(row0+2*i+8));
+            __m128i a3 = _mm_loadu_si128((const __m128i *)(row0+2*i+12));
+            __m128i b0 = _mm_loadu_si128((const __m128i *)(row1+2*i));
+            __m128i b1 = _mm_loadu_si128((const __m128i *)(row1+2*i+4));
+            __m128i b2 = _mm_loadu_si128((const __m128i *)(row1+2*i+8));
+            __m128i b3 = _mm_loadu_si128((const __m128i *)(row1+2*i+12));
+            __m128i avg[3];
+            const __m128i *shifts[3] = { &rs, &gs, &bs };
+            for (int c = 0; c < 3; c++) {
+                __m128i top = pair_sums_epi16(channel_epi16(a0, a1, *shifts[c]), channel_epi16(a2, a3, *shifts[c]));
+                __m128i bottom = pair_sums_epi16(channel_epi16(b0, b1, *shifts[c]), channel_epi16(b2, b3, *shifts[c]));
+                avg[c] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(top, bottom), two), 2);
+            }
+            __m128i uu = _mm_add_epi16(weighted_epi16(avg[0], avg[1], avg[2], -38, -74, 112, true), _mm_set1_epi16(128));
+            __m128i vv = _mm_add_epi16(weighted_epi16(avg[0], avg[1], avg[2], 112, -94, -18, true), _mm_set1_epi16(128));
+            _mm_storel_epi64((__m128i *)(u+i), _mm_packus_epi16(uu, uu));
+            _mm_storel_epi64((__m128i *)(v+i), _mm_packus_epi16(vv, vv));
+        }
+#endif
+        for (; i < cw; i++) {
+            int x0 = 2*i, x1 = SDL_min(2*i+1, width-1);
+            pixel_t p[4] = { row0[x0], row0[x1], row1[x0], row1[x1] };
+            int r = 0, g = 0, b = 0;
+            for (int k = 0; k < 4; k++) {
+                r += GFX_RED(p[k]);
+                g += GFX_GREEN(p[k]);
+                b += GFX_BLUE(p[k]);
+            }
+            r = (r+2) >> 2;
+            g = (g+2) >> 2;
+            b = (b+2) >> 2;
+            u[i] = rgb_to_u(r, g, b);
+            v[i] = rgb_to_v(r, g, b);
+        }
+    }
+}
+
+/// Convert and write out one snapshot.
+/// @return 0 on success, -1 on write error.
+static int capture_write_frame(struct gfx_capture_t *cap, const pixel_t *frame) {
+    int pixels = cap->width*cap->height;
+    if (cap->format == GFX_CAPTURE_Y4M) {
+        if (write_all(cap->fd, "FRAME\n", 6) < 0) return -1;
+        frame_to_yuv420(frame, cap->width, cap->height, cap->out);
+    } else {
+        gfx_pixels_convert((uint32_t *)cap->out, &layout_bgra32, frame, &gfx_pixel_layout, pixels);
+    }
+    return write_all(cap->fd, cap->out, cap->out_size);
+}
+
+/// Writer thread: drains the ring until the capture is stopped.
+static int capture_thread(void *data) {
+    struct gfx_capture_t *cap = data;
+    sigset_t sigpipe;
+    sigemptyset(&sigpipe);
+    sigaddset(&sigpipe, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigpipe, NULL);  // see write_all
+
+    bool failed = false;
+    if (cap->format == GFX_CAPTURE_Y4M) {
+        char header[64];
+        int len = snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", cap->width, cap->height, CAPTURE_FPS);
+        failed = write_all(cap->fd, header, len) < 0;
+    }
+
+    SDL_LockMutex(cap->lock);
+    cap->failed = failed;  // only written under the lock, read by gfx_capture_frame
+    for (;;) {
+        while (cap->count == 0 && !cap->stopping) {
+            SDL_CondWait(cap->cond, cap->lock);
+        }
+        if (cap->count == 0) break;  // stopping and drained
+        pixel_t *frame = cap->ring[cap->tail];
+        SDL_UnlockMutex(cap->lock);
+
+        if (!failed && capture_write_frame(cap, frame) < 0) {
+            failed = true;
+        }
+
+        SDL_LockMutex(cap->lock);
+        if (failed) {
+            cap->failed = true;
+            cap->captured--;
+            cap->dropped++;
+        }
+        cap->tail = (cap->tail+1) % CAPTURE_RING_SIZE;
+        cap->count--;
+    }
+    SDL_UnlockMutex(cap->lock);
+    return 0;
+}
+
+/// Start capturing the background to an already opened file descriptor.
+/// A snapshot is taken at each gfx_present; the file descriptor is not closed by gfx_capture_stop.
+/// @param ctxt graphic context.
+/// @param fd file descriptor to write to (file, pipe, socket).
+/// @param format GFX_CAPTURE_Y4M (YUV 4:2:0, 60 fps) or GFX_CAPTURE_RAW_BGRA (width*height*4 bytes per frame).
+/// @return 0 on success, -1 on failure.
+int gfx_capture_start_fd(gfx_context_t *ctxt, int fd, gfx_capture_format_t format) {
+    if (ctxt->capture) {
+        return -1;
+    }
+    struct gfx_capture_t *cap = calloc(1, sizeof(struct gfx_capture_t));
+    if (!cap) {
+        return -1;
+    }
+    cap->format = format;
+    cap->fd = fd;
+    cap->width = ctxt->width;
+    cap->height = ctxt->height;
+    if (format == GFX_CAPTURE_Y4M) {
+        cap->out_size = cap->width*cap->height + 2*((cap->width+1)/2)*((cap->height+1)/2);
+    } else {
+        cap->out_size = cap->width*cap->height*sizeof(pixel_t);
+    }
+    cap->out = malloc(cap->out_size);
+    bool ok = cap->out != NULL;
+    for (int i = 0; i < CAPTURE_RING_SIZE; i++) {
+        cap->ring[i] = malloc(cap->width*cap->height*sizeof(pixel_t));
+        ok = ok && cap->ring[i];
+    }
+    cap->lock = SDL_CreateMutex();
+    cap->cond = SDL_CreateCond();
+    if (ok && cap->lock && cap->cond) {
+        cap->thread = SDL_CreateThread(capture_thread, "gfx_capture", cap);
+    }
+    if (!cap->thread) {
+        if (cap->cond) SDL_DestroyCond(cap->cond);
+        if (cap->lock) SDL_DestroyMutex(cap->lock);
+        for (int i = 0; i < CAPTURE_RING_SIZE; i++) free(cap->ring[i]);
+        free(cap->out);
+        free(cap);
+        return -1;
+    }
+    ctxt->capture = cap;
+    return 0;
+}
+
+/// Start capturing the background to a file (created or truncated).
+/// @param ctxt graphic context.
+/// @param path file to write to, "-" for the standard output.
+/// @param format see gfx_capture_start_fd.
+/// @return 0 on success, -1 on failure.
+int gfx_capture_start(gfx_context_t *ctxt, const char *path, gfx_capture_format_t format) {
+    bool is_stdout = strcmp(path, "-") == 0;
+    int fd = is_stdout ? STDOUT_FILENO : open(path, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    if (gfx_capture_start_fd(ctxt, fd, format) < 0) {
+        if (!is_stdout) close(fd);
+        return -1;
+    }
+    ctxt->capture->close_fd = !is_stdout;
+    return 0;
+}
+
+/// Snapshot the background into the capture ring (called by gfx_present).
+/// Never blocks on the writer thread: if the ring is full the frame is dropped.
+/// Frames are also dropped while the background size differs from the capture size.
+/// @param ctxt graphic context.
+void gfx_capture_frame(gfx_context_t *ctxt) {
+    struct gfx_capture_t *cap = ctxt->capture;
+    if (!cap) {
+        return;
+    }
+
+    SDL_LockMutex(cap->lock);
+    bool full = cap->count == CAPTURE_RING_SIZE;
+    if (full || cap->failed || ctxt->width != cap->width || ctxt->height != cap->height) {
+        cap->dropped++;
+        SDL_UnlockMutex(cap->lock);
+        return;
+    }
+    SDL_UnlockMutex(cap->lock);
+
+    // The head slot is owned by the render thread until count is incremented.
+    gfx_background_copy(ctxt, cap->ring[cap->head], cap->width*sizeof(pixel_t));
+
+    SDL_LockMutex(cap->lock);
+    cap->head = (cap->head+1) % CAPTURE_RING_SIZE;
+    cap->count++;
+    cap->captured++;
+    SDL_CondSignal(cap->cond);
+    SDL_UnlockMutex(cap->lock);
+}
+
+/// Retrieve the capture counters.
+/// @param ctxt graphic context.
+/// @param captured returned number of frames queued for writing (may be NULL).
+/// @param dropped returned number of frames dropped (may be NULL).
+void gfx_capture_stats(gfx_context_t *ctxt, uint64_t *captured, uint64_t *dropped) {
+    struct gfx_capture_t *cap = ctxt->capture;
+    uint64_t c = 0, d = 0;
+    if (cap) {
+        SDL_LockMutex(cap->lock);
+        c = cap->captured;
+        d = cap->dropped;
+        SDL_UnlockMutex(cap->lock);
+    }
+    if (captured) *captured = c;
+    if (dropped) *dropped = d;
+}
+
+/// Stop capturing: waits for the queued frames to be written out.
+/// @param ctxt graphic context.
+void gfx_capture_stop(gfx_context_t *ctxt) {
+    struct gfx_capture_t *cap = ctxt->capture;
+    if (!cap) {
+        return;
+    }
+    SDL_LockMutex(cap->lock);
+    cap->stopping = true;
+    SDL_CondSignal(cap->cond);
+    SDL_UnlockMutex(cap->lock);
+    SDL_WaitThread(cap->thread, NULL);
+
+    if (cap->close_fd) close(cap->fd);
+    SDL_DestroyCond(cap->cond);
+    SDL_DestroyMutex(cap->lock);
+    for (int i = 0; i < CAPTURE_RING_SIZE; i++) free(cap->ring[i]);
+    free(cap->out);
+    free(cap);
+    ctxt->capture = NULL;
+}
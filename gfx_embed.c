@@ -0,0 +1,122 @@
+/// @file gfx_embed.c
+/// Sprites from images compiled into the program by tools/gfxembed: the RLE
+/// data is decompressed straight into the locked texture. The RLE codec is
+/// also used by the framebuffer stream (see gfx_stream.c).
+
+#include "gfx_internal.h"
+
+/// Encode pixels into separate control and pixel streams (see gfx_asset_header_t).
+/// @param pixels pixels, stored as is.
+/// @param count number of pixels.
+/// @param control receives the control bytes (at most count bytes).
+/// @param out receives the run and literal pixels (at most count pixels).
+/// @param control_size returned number of control bytes.
+/// @return the number of pixels written to out.
+int gfx_rle_encode(const uint32_t *pixels, int count, uint8_t *control, uint32_t *out, uint32_t *control_size) {
+    int n = 0, i = 0;
+    *control_size = 0;
+    while (i < count) {
+        int run = 1;
+        while (i+run < count && run < 128 && pixels[i+run] == pixels[i]) run++;
+        if (run >= 2) {
+            control[(*control_size)++] = 0x80 | (run-1);
+            out[n++] = pixels[i];
+            i += run;
+            continue;
+        }
+        // Literals up to the next run of at least 2 identical pixels.
+        int len = 1;
+        while (i+len < count && len < 128 && (i+len+1 >= count || pixels[i+len] != pixels[i+len+1])) len++;
+        control[(*control_size)++] = len-1;
+        memcpy(out+n, pixels+i, len*sizeof(uint32_t));
+        n += len;
+        i += len;
+    }
+    return n;
+}
+
+/// Decode RGBA pixels encoded by gfx_rle_encode into a rectangle of pixels.
+/// Packets may span several rows of the rectangle.
+/// @param control control bytes.
+/// @param control_size number of control bytes.
+/// @param src run and literal pixels, in gfx_pixel_layout_rgba32.
+/// @param src_count number of pixels available in src.
+/// @param dst first pixel of the rectangle.
+/// @param dst_layout layout of the destination pixels.
+/// @param pitch length of a destination row in bytes.
+/// @param width width of the rectangle.
+/// @param height height of the rectangle.
+/// @return 0 if the rectangle was filled, -1 if the data is truncated or corrupt.
+int gfx_rle_decode(const uint8_t *control, uint32_t control_size, const uint32_t *src, uint32_t src_count, void *dst, const gfx_pixel_layout_t *dst_layout, int pitch, int width, int height) {
+    const uint8_t *control_end = control + control_size;
+    const uint32_t *src_end = src + src_count;
+    int x = 0, y = 0;
+    while (control < control_end && y < height) {
+        uint8_t n = *control++;
+        bool is_run = n & 0x80;
+        int count = (n & 0x7f) + 1;
+        uint32_t color;
+        if (src_end - src < (is_run ? 1 : count)) {
+            return -1;
+        }
+        if (is_run) {
+            gfx_pixels_convert(&color, dst_layout, src++, &gfx_pixel_layout_rgba32, 1);
+        }
+        while (count > 0 && y < height) {
+            int len = SDL_min(count, width-x);
+            uint32_t *row = (uint32_t *)((uint8_t *)dst + pitch*y) + x;
+            if (is_run) {
+                for (int i = 0; i < len; i++) row[i] = color;
+            } else {
+                gfx_pixels_convert(row, dst_layout, src, &gfx_pixel_layout_rgba32, len);
+                src += len;
+            }
+            count -= len;
+            x += len;
+            if (x == width) {
+                x = 0;
+                y++;
+            }
+        }
+    }
+    return y < height ? -1 : 0;
+}
+
+/// Create a sprite from an image embedded at build time.
+/// @param ctxt graphic context.
+/// @param asset embedded image (see GFX_ASSET_DECLARE).
+/// @return a pointer to the sprite or NULL in case of failure.
+/// When not needed anymore, deallocate it with gfx_sprite_destroy.
+SDL_Texture *gfx_sprite_create_embedded(gfx_context_t *ctxt, const uint8_t *asset) {
+    const gfx_asset_header_t *header = (const gfx_asset_header_t *)asset;
+    if (memcmp(header->magic, GFX_ASSET_MAGIC, sizeof(header->magic)) != 0) {
+        return NULL;
+    }
+    int width = header->width, height = header->height;
+    SDL_Texture *tex = SDL_CreateTexture(ctxt->renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (!tex) {
+        return NULL;
+    }
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+
+    uint8_t *dst_pixels;
+    int pitch;
+    if (SDL_LockTexture(tex, NULL, (void **)&dst_pixels, &pitch) != 0) {
+        SDL_DestroyTexture(tex);
+        return NULL;
+    }
+
+    const uint8_t *control = asset + sizeof(gfx_asset_header_t);
+    const uint32_t *src = (const uint32_t *)(control + (header->control_size+3)/4*4);
+    // The pixel stream holds at most one pixel per image pixel.
+    int ret = gfx_rle_decode(control, header->control_size, src, width*height, dst_pixels, &gfx_pixel_layout, pitch, width, height);
+    SDL_UnlockTexture(tex);
+
+    if (ret < 0) {  // truncated data
+        SDL_DestroyTexture(tex);
+        return NULL;
+    }
+    SDL_Texture *sprite = gfx_texture_register(ctxt, tex, NULL);
+    gfx_texture_immutable(ctxt, sprite);
+    return sprite;
+}
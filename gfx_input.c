@@ -0,0 +1,234 @@
+/// @file gfx_input.c
+/// Input event source with deterministic recording and replay.
+/// Every keyboard and mouse event consumed by the application is logged with the
+/// number of the frame (see gfx_present) it was consumed in. In replay mode the
+/// real input devices are ignored and the logged events are fed back on the very
+/// same frames, which makes interactive programs reproducible benchmarks.
+
+#include "gfx_internal.h"
+
+#define INPUT_LOG_MAGIC   "GFXI"
+#define INPUT_LOG_VERSION 1
+
+// Logged event types.
+enum {
+    INPUT_KEYDOWN,
+    INPUT_KEYUP,
+    INPUT_MOUSEMOTION,
+    INPUT_MOUSEBUTTONDOWN,
+    INPUT_MOUSEBUTTONUP,
+};
+
+// One logged event: 14 bytes.
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t frame;
+    uint8_t type;
+    uint8_t button;  // button for button events, buttons state for motion events
+    int16_t x;       // mouse position in window coordinates
+    int16_t y;
+    int32_t key;
+} input_record_t;
+
+struct gfx_input_t {
+    FILE *file;
+    bool replay;
+    bool unflushed;         // record: events written since the last flush
+    bool pending;           // replay: a record was read ahead and not delivered yet
+    input_record_t record;  // replay: record read ahead
+};
+
+/// Whether an event comes from an input device (and thus gets recorded/replayed).
+static bool is_input_event(const SDL_Event *event) {
+    switch (event->type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+        case SDL_MOUSEMOTION:
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            return true;
+    }
+    return false;
+}
+
+/// Append an event to the log.
+static void input_record(gfx_context_t *ctxt, const SDL_Event *event) {
+    input_record_t rec = { .frame = ctxt->frame };
+    switch (event->type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            rec.type = event->type == SDL_KEYDOWN ? INPUT_KEYDOWN : INPUT_KEYUP;
+            rec.key = event->key.keysym.sym;
+            break;
+        case SDL_MOUSEMOTION:
+            rec.type = INPUT_MOUSEMOTION;
+            rec.button = event->motion.state;
+            rec.x = event->motion.x;
+            rec.y = event->motion.y;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            rec.type = event->type == SDL_MOUSEBUTTONDOWN ? INPUT_MOUSEBUTTONDOWN : INPUT_MOUSEBUTTONUP;
+            rec.button = event->button.button;
+            rec.x = event->button.x;
+            rec.y = event->button.y;
+            break;
+    }
+    fwrite(&rec, sizeof(rec), 1, ctxt->input->file);
+    ctxt->input->unflushed = true;
+}
+
+/// Rebuild an SDL event from a logged one.
+static void input_event_from_record(const input_record_t *rec, SDL_Event *event) {
+    memset(event, 0, sizeof(SDL_Event));
+    switch (rec->type) {
+        case INPUT_KEYDOWN:
+        case INPUT_KEYUP:
+            event->type = rec->type == INPUT_KEYDOWN ? SDL_KEYDOWN : SDL_KEYUP;
+            event->key.state = rec->type == INPUT_KEYDOWN;
+            event->key.keysym.sym = rec->key;
+            break;
+        case INPUT_MOUSEMOTION:
+            event->type = SDL_MOUSEMOTION;
+            event->motion.state = rec->button;
+            event->motion.x = rec->x;
+            event->motion.y = rec->y;
+            break;
+        case INPUT_MOUSEBUTTONDOWN:
+        case INPUT_MOUSEBUTTONUP:
+            event->type = rec->type == INPUT_MOUSEBUTTONDOWN ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+            event->button.state = rec->type == INPUT_MOUSEBUTTONDOWN;
+            event->button.button = rec->button;
+            event->button.x = rec->x;
+            event->button.y = rec->y;
+            break;
+    }
+    event->key.timestamp = SDL_GetTicks();
+}
+
+/// Open an input log and check or write its header.
+/// @return 0 on success, -1 on failure.
+static int input_open(gfx_context_t *ctxt, const char *path, bool replay) {
+    if (ctxt->input) {
+        return -1;
+    }
+    FILE *file = fopen(path, replay ? "rb" : "wb");
+    if (!file) {
+        return -1;
+    }
+    char magic[4];
+    uint32_t version = INPUT_LOG_VERSION;
+    if (replay) {
+        if (fread(magic, sizeof(magic), 1, file) != 1 || fread(&version, sizeof(version), 1, file) != 1 ||
+            memcmp(magic, INPUT_LOG_MAGIC, sizeof(magic)) != 0 || version != INPUT_LOG_VERSION) {
+            fclose(file);
+            return -1;
+        }
+    } else {
+        fwrite(INPUT_LOG_MAGIC, sizeof(magic), 1, file);
+        fwrite(&version, sizeof(version), 1, file);
+    }
+
+    struct gfx_input_t *input = calloc(1, sizeof(struct gfx_input_t));
+    if (!input) {
+        fclose(file);
+        return -1;
+    }
+    input->file = file;
+    input->replay = replay;
+    if (replay) {
+        input->pending = fread(&input->record, sizeof(input->record), 1, file) == 1;
+    }
+    ctxt->input = input;
+    return 0;
+}
+
+/// Start recording every input event consumed through gfx_input_poll
+/// (and thus gfx_keypressed) to a binary log file.
+/// @param ctxt graphic context.
+/// @param path log file to create.
+/// @return 0 on success, -1 on failure.
+int gfx_input_record(gfx_context_t *ctxt, const char *path) {
+    return input_open(ctxt, path, false);
+}
+
+/// Replay a log written by gfx_input_record: from now on real input devices are
+/// ignored and each logged event is delivered on the frame it was recorded on.
+/// Frame numbers are counted from the creation of the context.
+/// @param ctxt graphic context.
+/// @param path log file to replay.
+/// @return 0 on success, -1 on failure (missing or invalid log).
+int gfx_input_replay(gfx_context_t *ctxt, const char *path) {
+    return input_open(ctxt, path, true);
+}
+
+/// Whether a replay is running and has delivered all of its events.
+/// @param ctxt graphic context.
+/// @return true once the replayed log is exhausted.
+bool gfx_input_replay_done(gfx_context_t *ctxt) {
+    return ctxt->input && ctxt->input->replay && !ctxt->input->pending;
+}
+
+/// Flush the events recorded during the frame just presented, so that the log
+/// is complete up to the last frame even if the program crashes (called by gfx_present).
+/// @param ctxt graphic context.
+void gfx_input_frame(gfx_context_t *ctxt) {
+    struct gfx_input_t *input = ctxt->input;
+    if (input && input->unflushed) {
+        fflush(input->file);
+        input->unflushed = false;
+    }
+}
+
+/// Stop recording or replaying input events.
+/// @param ctxt graphic context.
+void gfx_input_stop(gfx_context_t *ctxt) {
+    if (!ctxt->input) {
+        return;
+    }
+    fclose(ctxt->input->file);
+    free(ctxt->input);
+    ctxt->input = NULL;
+}
+
+/// Retrieve the next pending event, recording or replaying input events as needed.
+/// Non-input events (window, quit) always come from SDL.
+/// IMPORTANT: This is a non-blocking call!
+/// @param ctxt graphic context.
+/// @param event returned event.
+/// @return 1 if an event was returned, 0 if there is none pending.
+int gfx_input_poll(gfx_context_t *ctxt, SDL_Event *event) {
+    struct gfx_input_t *input = ctxt->input;
+
+    if (!input || !input->replay) {
+        if (!SDL_PollEvent(event)) {
+            return 0;
+        }
+        if (is_input_event(event)) {
+            gfx_mouse_event_to_window(ctxt, event);
+            ctxt->input_timestamp = event->key.timestamp;
+            if (input) input_record(ctxt, event);
+        }
+        return 1;
+    }
+
+    while (SDL_PollEvent(event)) {
+        if (!is_input_event(event)) {
+            return 1;
+        }
+    }
+    if (input->pending && input->record.frame <= ctxt->frame) {
+        input_event_from_record(&input->record, event);
+        input->pending = fread(&input->record, sizeof(input->record), 1, input->file) == 1;
+        ctxt->input_timestamp = event->key.timestamp;
+        return 1;
+    }
+    return 0;
+}
+
+/// Get the SDL timestamp of the last input event consumed (see gfx_latency_mark).
+/// Replayed events are timestamped when they are delivered.
+/// @param ctxt graphic context.
+/// @return the timestamp in milliseconds (SDL_GetTicks).
+uint32_t gfx_input_timestamp(gfx_context_t *ctxt) {
+    return ctxt->input_timestamp;
+}
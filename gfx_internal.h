@@ -0,0 +1,60 @@
+#ifndef _GFX_INTERNAL_H_
+#define _GFX_INTERNAL_H_
+
+// Routines shared by the library's modules, not part of the public API.
+
+#include "gfx.h"
+
+// Context used by the API functions without a context parameter
+// (gfx_keypressed): the last one created.
+extern gfx_context_t *gfx_current_ctxt;
+
+// Live contexts, linked by next_context, last created first.
+extern gfx_context_t *gfx_contexts;
+
+// Background in screen order, whatever the scroll origin (gfx.c)
+void gfx_background_copy(gfx_context_t *ctxt, pixel_t *dst, int dst_pitch);
+
+// Mouse events mapped back from logical to window coordinates (gfx.c)
+void gfx_mouse_event_to_window(gfx_context_t *ctxt, SDL_Event *event);
+
+// Dump requested by a signal (gfx_trace.c)
+void gfx_trace_poll(void);
+
+// Frame arenas (gfx_arena.c)
+void gfx_frame_reset(gfx_context_t *ctxt);
+void gfx_frame_free(gfx_context_t *ctxt);
+
+// Input log flush, from gfx_present (gfx_input.c)
+void gfx_input_frame(gfx_context_t *ctxt);
+
+// Input-to-photon latency (gfx_latency.c)
+void gfx_latency_frame(gfx_context_t *ctxt);
+void gfx_latency_free(gfx_context_t *ctxt);
+
+// Frame streaming to a viewer, from gfx_present (gfx_stream.c)
+void gfx_stream_frame(gfx_context_t *ctxt);
+
+// Frame publication to shared memory, from gfx_present (gfx_shm.c)
+void gfx_shm_frame(gfx_context_t *ctxt);
+
+// Texture registry (gfx_memory.c)
+SDL_Texture *gfx_texture_register(gfx_context_t *ctxt, SDL_Texture *texture, const char *path);
+void gfx_texture_unregister(gfx_context_t *ctxt, SDL_Texture *handle);
+bool gfx_texture_registered(gfx_context_t *ctxt, SDL_Texture *handle);
+SDL_Texture *gfx_texture_use(gfx_context_t *ctxt, SDL_Texture *handle, int width, int height);
+void gfx_texture_immutable(gfx_context_t *ctxt, SDL_Texture *handle);
+void gfx_texture_registry_free(gfx_context_t *ctxt);
+
+// Sprite textures creation, without registration (gfx.c, gfx_qoi.c)
+SDL_Texture *gfx_sprite_texture_create(gfx_context_t *ctxt, const void *pixels, int pitch, int width, int height, const gfx_pixel_layout_t *layout);
+SDL_Texture *gfx_sprite_texture_load(gfx_context_t *ctxt, const char *filename);
+SDL_Texture *gfx_qoi_sprite_load(gfx_context_t *ctxt, const char *filename);
+
+// Resampling (gfx_scale.c)
+int gfx_pixels_scale(const pixel_t *src, int src_pitch, int src_width, int src_height,
+                     pixel_t *dst, int dst_pitch, int dst_width, int dst_height);
+pixel_t *gfx_texture_read(gfx_context_t *ctxt, SDL_Texture *texture, int width, int height);
+SDL_Texture *gfx_texture_scale(gfx_context_t *ctxt, SDL_Texture *texture, int width, int height);
+
+#endif
@@ -0,0 +1,142 @@
+/// @file gfx_latency.c
+/// Input-to-photon latency: the time from an input event, as timestamped by
+/// SDL, to the return of the gfx_present that first shows its effect. The
+/// event layer (gfx_input_poll) keeps the timestamp of the last input consumed;
+/// the application marks the frame it draws as reflecting that input:
+///
+///     SDL_Keycode key = gfx_keypressed();
+///     if (key == SDLK_LEFT) {
+///         x -= speed;
+///         gfx_latency_mark(ctxt, gfx_input_timestamp(ctxt));
+///     }
+///
+/// gfx_present then adds the latency of the inputs marked since the previous
+/// frame to a histogram, and periodically logs its distribution to stderr.
+/// With vsync SDL_RenderPresent returns at the vertical blank, so the figures
+/// include the wait for it; the display's own scanout and response are not.
+
+#include "gfx_internal.h"
+
+#define LATENCY_PENDING 64  // inputs marked per frame, more are ignored
+
+struct gfx_latency_t {
+    uint32_t pending[LATENCY_PENDING];  // timestamps marked during the current frame
+    int pending_count;
+    uint32_t total[GFX_LATENCY_BINS];   // histograms since the start,
+    uint32_t window[GFX_LATENCY_BINS];  // and since the last log
+    uint32_t log_interval;              // ms between logs, 0 if not logging
+    uint32_t log_last;                  // SDL_GetTicks of the last log
+};
+
+/// Get the latency structure of a context, created on first use.
+/// @return the structure or NULL on failure.
+static struct gfx_latency_t *latency_get(gfx_context_t *ctxt) {
+    if (!ctxt->latency) {
+        ctxt->latency = calloc(1, sizeof(struct gfx_latency_t));
+    }
+    return ctxt->latency;
+}
+
+/// Compute the distribution of a histogram.
+static void latency_histogram_stats(const uint32_t *histogram, gfx_latency_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    for (int i = 0; i < GFX_LATENCY_BINS; i++) {
+        stats->count += histogram[i];
+    }
+    if (stats->count == 0) {
+        return;
+    }
+    uint64_t seen = 0;
+    stats->min = UINT32_MAX;
+    for (int i = 0; i < GFX_LATENCY_BINS; i++) {
+        if (!histogram[i]) continue;
+        // Percentile p is the first latency at or above p% of the inputs.
+        if (seen*100 < stats->count*50 && (seen+histogram[i])*100 >= stats->count*50) stats->p50 = i;
+        if (seen*100 < stats->count*90 && (seen+histogram[i])*100 >= stats->count*90) stats->p90 = i;
+        if (seen*100 < stats->count*99 && (seen+histogram[i])*100 >= stats->count*99) stats->p99 = i;
+        stats->min = SDL_min(stats->min, (uint32_t)i);
+        stats->max = i;
+        seen += histogram[i];
+    }
+}
+
+/// Mark the frame being drawn as the first to show the effect of an input.
+/// @param ctxt graphic context.
+/// @param timestamp SDL timestamp of the input (see gfx_input_timestamp).
+/// The same input marked several times in a frame is counted once.
+/// @return 0 on success, -1 on failure.
+int gfx_latency_mark(gfx_context_t *ctxt, uint32_t timestamp) {
+    struct gfx_latency_t *latency = latency_get(ctxt);
+    if (!latency || latency->pending_count == LATENCY_PENDING) {
+        return -1;
+    }
+    for (int i = 0; i < latency->pending_count; i++) {
+        if (latency->pending[i] == timestamp) return 0;
+    }
+    latency->pending[latency->pending_count++] = timestamp;
+    return 0;
+}
+
+/// Log the latency distribution to stderr at regular intervals, from gfx_present.
+/// Also enabled by the environment variable GFX_LATENCY_LOG (interval in ms).
+/// @param ctxt graphic context.
+/// @param interval milliseconds between two logs, 0 to stop logging.
+/// @return 0 on success, -1 on failure.
+int gfx_latency_log(gfx_context_t *ctxt, uint32_t interval) {
+    struct gfx_latency_t *latency = latency_get(ctxt);
+    if (!latency) {
+        return -1;
+    }
+    latency->log_interval = interval;
+    latency->log_last = SDL_GetTicks();
+    memset(latency->window, 0, sizeof(latency->window));
+    return 0;
+}
+
+/// Retrieve the latency distribution of all the inputs marked so far.
+/// @param ctxt graphic context.
+/// @param stats returned statistics (all 0 if no input was marked).
+void gfx_latency_stats(gfx_context_t *ctxt, gfx_latency_stats_t *stats) {
+    if (!ctxt->latency) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    latency_histogram_stats(ctxt->latency->total, stats);
+}
+
+/// Account for the inputs shown by the frame just presented, and log the
+/// distribution when due (called by gfx_present, after SDL_RenderPresent).
+/// @param ctxt graphic context.
+void gfx_latency_frame(gfx_context_t *ctxt) {
+    struct gfx_latency_t *latency = ctxt->latency;
+    if (!latency) {
+        return;
+    }
+    uint32_t now = SDL_GetTicks();
+    for (int i = 0; i < latency->pending_count; i++) {
+        uint32_t ms = now - latency->pending[i];  // unsigned: right across the 49-day wrap
+        int bin = ms < GFX_LATENCY_BINS ? ms : GFX_LATENCY_BINS-1;
+        latency->total[bin]++;
+        latency->window[bin]++;
+    }
+    latency->pending_count = 0;
+
+    if (latency->log_interval && now - latency->log_last >= latency->log_interval) {
+        gfx_latency_stats_t stats;
+        latency_histogram_stats(latency->window, &stats);
+        if (stats.count) {
+            fprintf(stderr, "Input latency: %llu inputs, min %u ms, median %u ms, 90%% %u ms, 99%% %u ms, max %u%s ms\n",
+                    (unsigned long long)stats.count, stats.min, stats.p50, stats.p90, stats.p99, stats.max,
+                    stats.max == GFX_LATENCY_BINS-1 ? "+" : "");
+        }
+        memset(latency->window, 0, sizeof(latency->window));
+        latency->log_last = now;
+    }
+}
+
+/// Free the latency statistics (called by gfx_destroy).
+/// @param ctxt graphic context.
+void gfx_latency_free(gfx_context_t *ctxt) {
+    free(ctxt->latency);
+    ctxt->latency = NULL;
+}
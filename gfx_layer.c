@@ -0,0 +1,166 @@
+/// @file gfx_layer.c
+/// Composited pixel layers.
+/// Each layer owns a pixel buffer and a streaming texture. Writes only record
+/// dirty rectangles, and compositing uploads just those before drawing the
+/// layers in increasing z order: a static layer is uploaded once, while an
+/// overlay changing a few regions per frame uploads those regions only.
+
+#include "gfx_internal.h"
+
+/// Area of a rectangle.
+static inline int rect_area(const SDL_Rect *r) {
+    return r->w*r->h;
+}
+
+/// Create a layer, transparent black, and insert it among the layers of the context.
+/// With SDL_BLENDMODE_BLEND, draw with gfx_rgba(): GFX_RGB colors have a zero alpha.
+/// @param ctxt graphic context.
+/// @param width width in pixels.
+/// @param height height in pixels.
+/// @param z layers are composited by increasing z, equal ones in creation order.
+/// @param blend how the layer is blended over what is below.
+/// @return the layer or NULL on failure. Deallocate it with gfx_layer_destroy.
+gfx_layer_t *gfx_layer_create(gfx_context_t *ctxt, int width, int height, int z, SDL_BlendMode blend) {
+    if (width <= 0 || height <= 0) {
+        return NULL;
+    }
+    gfx_layer_t *layer = calloc(1, sizeof(gfx_layer_t));
+    if (!layer) {
+        return NULL;
+    }
+    layer->ctxt = ctxt;
+    layer->width = width;
+    layer->height = height;
+    layer->z = z;
+    layer->visible = true;
+    layer->blend = blend;
+    layer->pixels = calloc((size_t)width*height, sizeof(pixel_t));
+    SDL_Texture *tex = SDL_CreateTexture(ctxt->renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_STREAMING, width, height);
+    layer->texture = gfx_texture_register(ctxt, tex, NULL);
+    if (!layer->pixels || !layer->texture) {
+        if (layer->texture) gfx_texture_unregister(ctxt, layer->texture);
+        free(layer->pixels);
+        free(layer);
+        return NULL;
+    }
+    layer->dirty[0] = (SDL_Rect){ 0, 0, width, height };
+    layer->dirty_count = 1;
+
+    gfx_layer_t **link = &ctxt->layers;
+    while (*link && (*link)->z <= z) {
+        link = &(*link)->next;
+    }
+    layer->next = *link;
+    *link = layer;
+    return layer;
+}
+
+/// Destroy a layer and remove it from its context.
+/// @param layer the layer (NULL is allowed).
+void gfx_layer_destroy(gfx_layer_t *layer) {
+    if (!layer) {
+        return;
+    }
+    gfx_layer_t **link = &layer->ctxt->layers;
+    while (*link && *link != layer) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = layer->next;
+    }
+    gfx_texture_unregister(layer->ctxt, layer->texture);
+    free(layer->pixels);
+    free(layer);
+}
+
+/// Mark a region of a layer as modified, to be uploaded at the next compositing.
+/// Needed after writing layer->pixels directly; rectangles that overlap or touch
+/// are merged, and past GFX_LAYER_DIRTY_MAX the cheapest merge is made.
+/// @param layer the layer.
+/// @param rect modified region, NULL for the whole layer.
+void gfx_layer_dirty(gfx_layer_t *layer, const SDL_Rect *rect) {
+    SDL_Rect all = { 0, 0, layer->width, layer->height }, r;
+    if (!rect) {
+        layer->dirty[0] = all;
+        layer->dirty_count = 1;
+        return;
+    }
+    if (!SDL_IntersectRect(rect, &all, &r)) {
+        return;
+    }
+    int best = -1, best_cost = SDL_MAX_SINT32;
+    for (int i = 0; i < layer->dirty_count; i++) {
+        SDL_Rect u;
+        SDL_UnionRect(&layer->dirty[i], &r, &u);
+        // Extra pixels uploaded if merged, <= 0 when the rectangles overlap or touch.
+        int cost = rect_area(&u) - rect_area(&layer->dirty[i]) - rect_area(&r);
+        if (cost < best_cost) {
+            best = i;
+            best_cost = cost;
+        }
+    }
+    if (best >= 0 && (best_cost <= 0 || layer->dirty_count == GFX_LAYER_DIRTY_MAX)) {
+        SDL_UnionRect(&layer->dirty[best], &r, &layer->dirty[best]);
+    } else {
+        layer->dirty[layer->dirty_count++] = r;
+    }
+}
+
+/// Draw a pixel in a layer.
+/// @param layer the layer.
+/// @param x x coordinate of the pixel.
+/// @param y y coordinate of the pixel.
+/// @param color color of the pixel.
+void gfx_layer_putpixel(gfx_layer_t *layer, int x, int y, pixel_t color) {
+    if ((unsigned)x >= (unsigned)layer->width || (unsigned)y >= (unsigned)layer->height) {
+        return;
+    }
+    layer->pixels[(size_t)layer->width*y + x] = color;
+    if (layer->dirty_count > 0) {
+        SDL_Point p = { x, y };
+        if (SDL_PointInRect(&p, &layer->dirty[layer->dirty_count-1])) {
+            return;
+        }
+    }
+    gfx_layer_dirty(layer, &(SDL_Rect){ x, y, 1, 1 });
+}
+
+/// Fill a whole layer with a color.
+/// @param layer the layer.
+/// @param color the color, e.g. 0 for transparent.
+void gfx_layer_clear(gfx_layer_t *layer, pixel_t color) {
+    size_t n = (size_t)layer->width*layer->height;
+    if (color == 0) {
+        memset(layer->pixels, 0, n*sizeof(pixel_t));
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            layer->pixels[i] = color;
+        }
+    }
+    gfx_layer_dirty(layer, NULL);
+}
+
+/// Upload the dirty regions of the layers and draw the visible ones, by
+/// increasing z. gfx_present does it if it wasn't done during the frame; call
+/// it explicitly to render sprites over the layers.
+/// @param ctxt graphic context.
+void gfx_layers_render(gfx_context_t *ctxt) {
+    for (gfx_layer_t *layer = ctxt->layers; layer; layer = layer->next) {
+        if (!layer->visible) {
+            continue;  // keep its dirty regions for when it is shown again
+        }
+        SDL_Texture *tex = gfx_texture_use(ctxt, layer->texture, 0, 0);
+        if (!tex) {
+            continue;
+        }
+        for (int i = 0; i < layer->dirty_count; i++) {
+            const SDL_Rect *r = &layer->dirty[i];
+            SDL_UpdateTexture(tex, r, layer->pixels + (size_t)layer->width*r->y + r->x, layer->width*sizeof(pixel_t));
+        }
+        layer->dirty_count = 0;
+        SDL_SetTextureBlendMode(tex, layer->blend);
+        SDL_Rect dst = { layer->x, layer->y, layer->width, layer->height };
+        SDL_RenderCopy(ctxt->renderer, tex, NULL, &dst);
+    }
+    ctxt->layers_rendered = true;
+}
@@ -0,0 +1,162 @@
+/// @file gfx_mask.c
+/// Per-pixel collision masks.
+/// A mask holds one bit per sprite pixel (set when the pixel is opaque enough),
+/// packed in rows of 64-bit words: bit i of word k is the pixel at x = 64*k+i,
+/// and the bits beyond the width are always 0. Overlap tests first intersect
+/// the bounding boxes of the set bits, then AND whole words of both masks, the
+/// second one shifted to the first one's alignment.
+
+#include "gfx_internal.h"
+
+/// Create a mask for a given size, all bits cleared.
+static gfx_mask_t *mask_alloc(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return NULL;
+    }
+    gfx_mask_t *mask = malloc(sizeof(gfx_mask_t));
+    if (!mask) {
+        return NULL;
+    }
+    mask->width = width;
+    mask->height = height;
+    mask->words = (width+63)/64;
+    mask->bits = calloc((size_t)mask->words*height, sizeof(uint64_t));
+    if (!mask->bits) {
+        free(mask);
+        return NULL;
+    }
+    return mask;
+}
+
+/// Compute the bounding box of the set bits (empty if none).
+static void mask_bounds_update(gfx_mask_t *mask) {
+    int x0 = mask->width, y0 = mask->height, x1 = 0, y1 = 0;
+    for (int j = 0; j < mask->height; j++) {
+        const uint64_t *row = mask->bits + (size_t)mask->words*j;
+        for (int k = 0; k < mask->words; k++) {
+            if (!row[k]) continue;
+            x0 = SDL_min(x0, 64*k + __builtin_ctzll(row[k]));
+            x1 = SDL_max(x1, 64*k + 64 - __builtin_clzll(row[k]));
+            y0 = SDL_min(y0, j);
+            y1 = j+1;
+        }
+    }
+    mask->bounds = x1 > x0 ? (SDL_Rect){ x0, y0, x1-x0, y1-y0 } : (SDL_Rect){ 0, 0, 0, 0 };
+}
+
+/// Create a collision mask from the alpha channel of in-memory pixels.
+/// @param pixels array of pixels, e.g. those given to gfx_sprite_create_layout.
+/// @param pitch length of a row of pixels in bytes.
+/// @param width width in pixels.
+/// @param height height in pixels.
+/// @param layout layout of the pixels.
+/// @param threshold pixels with an alpha strictly above it are solid.
+/// @return the mask or NULL on failure. Deallocate it with gfx_mask_destroy.
+gfx_mask_t *gfx_mask_create(const void *pixels, int pitch, int width, int height, const gfx_pixel_layout_t *layout, uint8_t threshold) {
+    gfx_mask_t *mask = mask_alloc(width, height);
+    if (!mask) {
+        return NULL;
+    }
+    for (int j = 0; j < height; j++) {
+        const uint32_t *src = (const uint32_t *)((const uint8_t *)pixels + pitch*j);
+        uint64_t *row = mask->bits + (size_t)mask->words*j;
+        for (int i = 0; i < width; i++) {
+            uint64_t solid = ((src[i] >> layout->a_shift) & 0xff) > threshold;
+            row[i >> 6] |= solid << (i & 63);
+        }
+    }
+    mask_bounds_update(mask);
+    return mask;
+}
+
+/// Create the collision mask of a sprite, from the alpha channel of its texture.
+/// Call it right after loading the sprite: the texture is read back once.
+/// @param ctxt graphic context.
+/// @param sprite the sprite.
+/// @param threshold pixels with an alpha strictly above it are solid.
+/// @return the mask or NULL on failure (e.g. the renderer can't read textures
+/// back). Deallocate it with gfx_mask_destroy.
+gfx_mask_t *gfx_sprite_mask(gfx_context_t *ctxt, SDL_Texture *sprite, uint8_t threshold) {
+    SDL_Texture *texture = gfx_texture_use(ctxt, sprite, 0, 0);
+    int width, height;
+    if (!texture || SDL_QueryTexture(texture, NULL, NULL, &width, &height) != 0) {
+        return NULL;
+    }
+    pixel_t *pixels = gfx_texture_read(ctxt, texture, width, height);
+    if (!pixels) {
+        return NULL;
+    }
+    gfx_mask_t *mask = gfx_mask_create(pixels, width*sizeof(pixel_t), width, height, &gfx_pixel_layout, threshold);
+    free(pixels);
+    return mask;
+}
+
+/// Destroy a collision mask.
+/// @param mask the mask (NULL is allowed).
+void gfx_mask_destroy(gfx_mask_t *mask) {
+    if (mask) {
+        free(mask->bits);
+        free(mask);
+    }
+}
+
+/// Read 64 bits of a mask row starting at any bit position, 0 outside the row.
+static inline uint64_t row_bits(const uint64_t *row, int words, int bit) {
+    int k = bit >> 6;  // floor, also for negative positions
+    int shift = bit & 63;
+    uint64_t lo = k >= 0 && k < words ? row[k] : 0;
+    if (shift == 0) {
+        return lo;
+    }
+    uint64_t hi = k+1 >= 0 && k+1 < words ? row[k+1] : 0;
+    return lo >> shift | hi << (64-shift);
+}
+
+/// Whether the bounding boxes of two masks overlap, given their positions.
+/// Cheap pre-test of gfx_mask_overlap.
+/// @param a first mask.
+/// @param ax x coordinate of the first mask.
+/// @param ay y coordinate of the first mask.
+/// @param b second mask.
+/// @param bx x coordinate of the second mask.
+/// @param by y coordinate of the second mask.
+/// @return true if the boxes of their solid pixels intersect.
+bool gfx_mask_bounds_overlap(const gfx_mask_t *a, int ax, int ay, const gfx_mask_t *b, int bx, int by) {
+    const SDL_Rect *ra = &a->bounds, *rb = &b->bounds;
+    return ra->w > 0 && rb->w > 0 &&
+           ax+ra->x < bx+rb->x+rb->w && bx+rb->x < ax+ra->x+ra->w &&
+           ay+ra->y < by+rb->y+rb->h && by+rb->y < ay+ra->y+ra->h;
+}
+
+/// Whether two masks have a solid pixel in common, given their positions.
+/// Masks are in sprite pixels: sprites must be rendered at their native size.
+/// @param a first mask.
+/// @param ax x coordinate of the first mask.
+/// @param ay y coordinate of the first mask.
+/// @param b second mask.
+/// @param bx x coordinate of the second mask.
+/// @param by y coordinate of the second mask.
+/// @return true if the masks overlap.
+bool gfx_mask_overlap(const gfx_mask_t *a, int ax, int ay, const gfx_mask_t *b, int bx, int by) {
+    if (!gfx_mask_bounds_overlap(a, ax, ay, b, bx, by)) {
+        return false;
+    }
+    // Intersection of the boxes, in a's coordinates.
+    int x0 = SDL_max(a->bounds.x, bx-ax + b->bounds.x);
+    int x1 = SDL_min(a->bounds.x+a->bounds.w, bx-ax + b->bounds.x+b->bounds.w);
+    int y0 = SDL_max(a->bounds.y, by-ay + b->bounds.y);
+    int y1 = SDL_min(a->bounds.y+a->bounds.h, by-ay + b->bounds.y+b->bounds.h);
+    int dx = bx-ax, dy = by-ay;
+
+    for (int j = y0; j < y1; j++) {
+        const uint64_t *row_a = a->bits + (size_t)a->words*j;
+        const uint64_t *row_b = b->bits + (size_t)b->words*(j-dy);
+        for (int k = x0 >> 6; k <= (x1-1) >> 6; k++) {
+            // Columns 64k..64k+63 of a are columns 64k-dx.. of b.
+            if (row_a[k] & row_bits(row_b, b->words, 64*k - dx)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,419 @@
+/// @file gfx_memory.c
+/// Texture memory accounting and eviction.
+/// Every texture created by a context is recorded in a hash table keyed by the
+/// handle given to the application. Under a budget (see gfx_memory_budget_set),
+/// sprites loaded from files are reloadable: their handle is a 1x1 placeholder
+/// texture and the actual texture can be evicted, least recently rendered first,
+/// then transparently reloaded by gfx_sprite_render. The evictable ones are kept
+/// in a list from least to most recently rendered, so eviction never scans the table.
+/// Entries also hold the pre-scaled variant of immutable sprites (loaded from a
+/// file or embedded) rendered at the same non-native size frame after frame (see
+/// gfx_scale.c), accounted and evicted with them. Sprites whose pixels can change,
+/// such as those of gfx_sprite_create and render targets, are always scaled by
+/// the renderer.
+
+#include "gfx_internal.h"
+
+#define REGISTRY_MIN_CAPACITY 64
+#define SCALE_MIN_FRAMES 4            // consecutive frames drawing at one size before pre-scaling
+#define SCALE_MAX_PIXELS (2048*2048)  // larger variants are left to the renderer
+
+typedef struct {
+    SDL_Texture *handle;    // key, what the application holds; NULL for an empty slot
+    SDL_Texture *texture;   // actual texture, NULL when evicted
+    char *path;             // file to reload the texture from, NULL if not reloadable
+    bool immutable;         // pixels never change: may get a pre-scaled variant
+    size_t bytes;
+    uint32_t last_frame;    // frame the texture was last rendered on
+    SDL_Texture *scaled;    // pre-scaled variant, NULL if none
+    size_t scaled_bytes;
+    int scaled_width;
+    int scaled_height;
+    int draw_width;         // size of the latest draws, the number of frames in a row
+    int draw_height;        // drawn at that size only, and the last of those frames
+    int frames;
+    uint32_t draw_frame;
+    SDL_Texture *lru_prev;  // neighbors in the LRU list, by handle since entries
+    SDL_Texture *lru_next;  // move in the table
+} texture_entry_t;
+
+struct gfx_texture_registry_t {
+    texture_entry_t *entries;
+    int capacity;           // power of 2
+    int count;
+    size_t bytes;
+    size_t peak_bytes;
+    size_t budget;          // 0 = unlimited
+    SDL_Texture *lru_head;  // reloadable resident textures, least recently rendered first
+    SDL_Texture *lru_tail;
+    int evicted;
+    uint64_t evictions;
+    uint64_t reloads;
+};
+
+static inline int entry_slot(struct gfx_texture_registry_t *reg, SDL_Texture *handle) {
+    uint64_t h = (uintptr_t)handle;
+    h ^= h >> 17;
+    h *= 0x9e3779b97f4a7c15ull;
+    return (h >> 32) & (reg->capacity-1);
+}
+
+/// Find the entry of a handle.
+/// @return the entry or NULL if the handle isn't registered.
+static texture_entry_t *entry_find(struct gfx_texture_registry_t *reg, SDL_Texture *handle) {
+    if (!reg || !handle) {
+        return NULL;
+    }
+    for (int i = entry_slot(reg, handle);; i = (i+1) & (reg->capacity-1)) {
+        if (reg->entries[i].handle == handle) return &reg->entries[i];
+        if (!reg->entries[i].handle) return NULL;
+    }
+}
+
+/// Insert an entry (the handle must not be registered yet and there must be room).
+static void entry_insert(struct gfx_texture_registry_t *reg, const texture_entry_t *entry) {
+    int i = entry_slot(reg, entry->handle);
+    while (reg->entries[i].handle) {
+        i = (i+1) & (reg->capacity-1);
+    }
+    reg->entries[i] = *entry;
+    reg->count++;
+}
+
+/// Remove an entry, shifting back the following entries of its probe sequence.
+static void entry_remove(struct gfx_texture_registry_t *reg, texture_entry_t *entry) {
+    int mask = reg->capacity-1;
+    int i = entry - reg->entries;
+    for (int j = (i+1) & mask; reg->entries[j].handle; j = (j+1) & mask) {
+        int home = entry_slot(reg, reg->entries[j].handle);
+        // Move entry j into the hole at i if i lies between its home slot and j.
+        if (((j-home) & mask) >= ((j-i) & mask)) {
+            reg->entries[i] = reg->entries[j];
+            i = j;
+        }
+    }
+    memset(&reg->entries[i], 0, sizeof(texture_entry_t));
+    reg->count--;
+}
+
+/// Make room for one more entry, growing the table at 50% load.
+/// @return 0 on success, -1 if out of memory.
+static int registry_reserve(gfx_context_t *ctxt) {
+    struct gfx_texture_registry_t *reg = ctxt->textures;
+    if (!reg) {
+        reg = ctxt->textures = calloc(1, sizeof(struct gfx_texture_registry_t));
+        if (!reg) return -1;
+    }
+    if (2*(reg->count+1) <= reg->capacity) {
+        return 0;
+    }
+    int capacity = SDL_max(REGISTRY_MIN_CAPACITY, 2*reg->capacity);
+    texture_entry_t *old = reg->entries;
+    int old_capacity = reg->capacity;
+    texture_entry_t *entries = calloc(capacity, sizeof(texture_entry_t));
+    if (!entries) {
+        return -1;
+    }
+    reg->entries = entries;
+    reg->capacity = capacity;
+    reg->count = 0;
+    for (int i = 0; i < old_capacity; i++) {
+        if (old[i].handle) entry_insert(reg, &old[i]);
+    }
+    free(old);
+    return 0;
+}
+
+/// Whether an entry is in the LRU list: reloadable and resident.
+static inline bool entry_evictable(const texture_entry_t *e) {
+    return e->path && e->texture;
+}
+
+/// Append an entry to the LRU list, as the most recently rendered.
+static void lru_push(struct gfx_texture_registry_t *reg, texture_entry_t *e) {
+    e->lru_prev = reg->lru_tail;
+    e->lru_next = NULL;
+    if (reg->lru_tail) {
+        entry_find(reg, reg->lru_tail)->lru_next = e->handle;
+    } else {
+        reg->lru_head = e->handle;
+    }
+    reg->lru_tail = e->handle;
+}
+
+/// Remove an entry from the LRU list.
+static void lru_unlink(struct gfx_texture_registry_t *reg, texture_entry_t *e) {
+    if (e->lru_prev) {
+        entry_find(reg, e->lru_prev)->lru_next = e->lru_next;
+    } else {
+        reg->lru_head = e->lru_next;
+    }
+    if (e->lru_next) {
+        entry_find(reg, e->lru_next)->lru_prev = e->lru_prev;
+    } else {
+        reg->lru_tail = e->lru_prev;
+    }
+    e->lru_prev = e->lru_next = NULL;
+}
+
+/// Size of a texture in bytes.
+static size_t texture_bytes(SDL_Texture *texture) {
+    Uint32 format;
+    int w, h;
+    if (SDL_QueryTexture(texture, &format, NULL, &w, &h) != 0) {
+        return 0;
+    }
+    return (size_t)w*h*SDL_BYTESPERPIXEL(format);
+}
+
+/// Destroy the pre-scaled variant of an entry, if any.
+static void entry_scaled_free(struct gfx_texture_registry_t *reg, texture_entry_t *e) {
+    if (e->scaled) {
+        SDL_DestroyTexture(e->scaled);
+        reg->bytes -= e->scaled_bytes;
+        e->scaled = NULL;
+        e->scaled_bytes = 0;
+    }
+}
+
+/// Evict least recently rendered textures until the budget is met.
+/// Textures rendered during the current frame and the given entry are kept.
+static void registry_enforce_budget(gfx_context_t *ctxt, texture_entry_t *keep) {
+    struct gfx_texture_registry_t *reg = ctxt->textures;
+    SDL_Texture *next = reg->lru_head;
+    while (reg->budget && reg->bytes > reg->budget && next) {
+        texture_entry_t *lru = entry_find(reg, next);
+        next = lru->lru_next;
+        if (lru->last_frame == ctxt->frame) {
+            return;  // this one and all the following are in use
+        }
+        if (lru == keep) {
+            continue;
+        }
+        lru_unlink(reg, lru);
+        entry_scaled_free(reg, lru);
+        SDL_DestroyTexture(lru->texture);
+        lru->texture = NULL;
+        reg->bytes -= lru->bytes;
+        reg->evicted++;
+        reg->evictions++;
+    }
+}
+
+/// Record a texture created for the context.
+/// @param ctxt graphic context.
+/// @param texture the new texture.
+/// @param path file the texture was loaded from (makes it immutable, and
+/// reloadable under a budget), or NULL.
+/// @return the handle to give to the application: the texture itself, or a
+/// placeholder if the texture is reloadable. NULL on failure (the texture is destroyed).
+SDL_Texture *gfx_texture_register(gfx_context_t *ctxt, SDL_Texture *texture, const char *path) {
+    if (!texture) {
+        return NULL;
+    }
+    texture_entry_t entry = {
+        .handle = texture, .texture = texture, .immutable = path != NULL,
+        .bytes = texture_bytes(texture), .last_frame = ctxt->frame,
+    };
+    bool ok = registry_reserve(ctxt) == 0;
+    if (ok && path && ctxt->textures->budget) {
+        entry.path = strdup(path);
+        entry.handle = SDL_CreateTexture(ctxt->renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_STATIC, 1, 1);
+        ok = entry.path && entry.handle;
+    }
+    if (!ok) {
+        if (entry.handle && entry.handle != texture) SDL_DestroyTexture(entry.handle);
+        free(entry.path);
+        SDL_DestroyTexture(texture);
+        return NULL;
+    }
+
+    struct gfx_texture_registry_t *reg = ctxt->textures;
+    entry_insert(reg, &entry);
+    texture_entry_t *e = entry_find(reg, entry.handle);
+    if (entry_evictable(e)) {
+        lru_push(reg, e);
+    }
+    reg->bytes += entry.bytes;
+    reg->peak_bytes = SDL_max(reg->peak_bytes, reg->bytes);
+    registry_enforce_budget(ctxt, e);
+    return entry.handle;
+}
+
+/// Forget a texture and destroy it (and its placeholder, if any).
+/// @param ctxt graphic context.
+/// @param handle handle returned by gfx_texture_register.
+void gfx_texture_unregister(gfx_context_t *ctxt, SDL_Texture *handle) {
+    struct gfx_texture_registry_t *reg = ctxt ? ctxt->textures : NULL;
+    texture_entry_t *e = entry_find(reg, handle);
+    if (!e) {
+        SDL_DestroyTexture(handle);  // not created by gfxlib
+        return;
+    }
+    if (entry_evictable(e)) {
+        lru_unlink(reg, e);
+    }
+    entry_scaled_free(reg, e);
+    if (e->texture) {
+        reg->bytes -= e->bytes;
+        if (e->texture != handle) SDL_DestroyTexture(e->texture);
+    } else {
+        reg->evicted--;
+    }
+    SDL_DestroyTexture(handle);
+    free(e->path);
+    entry_remove(reg, e);
+}
+
+/// Whether a handle was registered by a context (and not unregistered since).
+/// @param ctxt graphic context.
+/// @param handle texture handle.
+/// @return true if the handle belongs to the context.
+bool gfx_texture_registered(gfx_context_t *ctxt, SDL_Texture *handle) {
+    return entry_find(ctxt->textures, handle) != NULL;
+}
+
+/// Use the pre-scaled variant of an entry for a draw of the given size, building
+/// it once the sprite has been drawn at that size only for SCALE_MIN_FRAMES
+/// frames in a row (a sprite drawn at several sizes per frame never gets one).
+/// The variant takes the color mod, alpha mod and blend mode of the texture.
+/// @return the variant or NULL to scale the texture itself.
+static SDL_Texture *entry_scaled_use(gfx_context_t *ctxt, texture_entry_t *e, int width, int height) {
+    struct gfx_texture_registry_t *reg = ctxt->textures;
+    if (e->draw_width != width || e->draw_height != height) {
+        e->draw_width = width;
+        e->draw_height = height;
+        e->frames = 1;
+        e->draw_frame = ctxt->frame;
+    } else if (e->draw_frame != ctxt->frame) {
+        e->frames++;
+        e->draw_frame = ctxt->frame;
+    }
+    if (!e->scaled || e->scaled_width != width || e->scaled_height != height) {
+        if (e->frames < SCALE_MIN_FRAMES || (int64_t)width*height > SCALE_MAX_PIXELS) {
+            return NULL;
+        }
+        entry_scaled_free(reg, e);
+        e->scaled = gfx_texture_scale(ctxt, e->texture, width, height);
+        if (!e->scaled) {
+            e->frames = INT32_MIN;  // don't retry on every frame
+            return NULL;
+        }
+        e->scaled_width = width;
+        e->scaled_height = height;
+        e->scaled_bytes = texture_bytes(e->scaled);
+        reg->bytes += e->scaled_bytes;
+        reg->peak_bytes = SDL_max(reg->peak_bytes, reg->bytes);
+        registry_enforce_budget(ctxt, e);
+    }
+    Uint8 r, g, b, a;
+    SDL_BlendMode blend;
+    SDL_GetTextureColorMod(e->texture, &r, &g, &b);
+    SDL_GetTextureAlphaMod(e->texture, &a);
+    SDL_GetTextureBlendMode(e->texture, &blend);
+    SDL_SetTextureColorMod(e->scaled, r, g, b);
+    SDL_SetTextureAlphaMod(e->scaled, a);
+    SDL_SetTextureBlendMode(e->scaled, blend);
+    return e->scaled;
+}
+
+/// Get the actual texture behind a handle about to be rendered, reloading it if
+/// it was evicted, and mark it as recently used.
+/// @param ctxt graphic context.
+/// @param handle sprite handle.
+/// @param width display width of the sprite (0 for its native size).
+/// @param height display height of the sprite (0 for its native size).
+/// @return the texture to render (possibly a variant pre-scaled to the display
+/// size), NULL if it can't be reloaded.
+SDL_Texture *gfx_texture_use(gfx_context_t *ctxt, SDL_Texture *handle, int width, int height) {
+    struct gfx_texture_registry_t *reg = ctxt->textures;
+    texture_entry_t *e = entry_find(reg, handle);
+    if (!e) {
+        return handle;
+    }
+    if (entry_evictable(e) && e->last_frame != ctxt->frame) {
+        lru_unlink(reg, e);  // first draw of the frame: becomes the most recent
+        lru_push(reg, e);
+    }
+    e->last_frame = ctxt->frame;
+    if (!e->texture) {
+        e->texture = gfx_sprite_texture_load(ctxt, e->path);
+        if (!e->texture) {
+            return NULL;
+        }
+        lru_push(reg, e);
+        reg->bytes += e->bytes;
+        reg->peak_bytes = SDL_max(reg->peak_bytes, reg->bytes);
+        reg->evicted--;
+        reg->reloads++;
+        registry_enforce_budget(ctxt, e);
+    }
+    int native_width, native_height;
+    if (width > 0 && height > 0 && SDL_QueryTexture(e->texture, NULL, NULL, &native_width, &native_height) == 0 &&
+        e->immutable && (width != native_width || height != native_height)) {
+        SDL_Texture *scaled = entry_scaled_use(ctxt, e, width, height);
+        if (scaled) {
+            return scaled;
+        }
+    }
+    return e->texture;
+}
+
+/// Mark a texture whose pixels never change after its creation (e.g. embedded
+/// assets), so that it may get pre-scaled variants like file-loaded sprites.
+/// @param ctxt graphic context.
+/// @param handle handle returned by gfx_texture_register.
+void gfx_texture_immutable(gfx_context_t *ctxt, SDL_Texture *handle) {
+    texture_entry_t *e = entry_find(ctxt->textures, handle);
+    if (e) {
+        e->immutable = true;
+    }
+}
+
+/// Free the registry (the textures themselves go away with the renderer).
+/// @param ctxt graphic context.
+void gfx_texture_registry_free(gfx_context_t *ctxt) {
+    struct gfx_texture_registry_t *reg = ctxt->textures;
+    if (!reg) {
+        return;
+    }
+    for (int i = 0; i < reg->capacity; i++) {
+        free(reg->entries[i].path);
+    }
+    free(reg->entries);
+    free(reg);
+    ctxt->textures = NULL;
+}
+
+/// Limit the memory held by the context's textures.
+/// Sprites loaded from files with gfx_sprite_load after this call become
+/// reloadable: when over budget, the least recently rendered ones are evicted
+/// and reloaded on their next gfx_sprite_render. Such sprites must only be used
+/// through the gfx_sprite_* functions (their handle is a placeholder texture).
+/// @param ctxt graphic context.
+/// @param bytes budget in bytes, 0 for unlimited.
+void gfx_memory_budget_set(gfx_context_t *ctxt, size_t bytes) {
+    if (registry_reserve(ctxt) < 0) {
+        return;
+    }
+    ctxt->textures->budget = bytes;
+    registry_enforce_budget(ctxt, NULL);
+}
+
+/// Retrieve the texture memory statistics of a context.
+/// @param ctxt graphic context.
+/// @param stats returned statistics.
+void gfx_memory_stats(gfx_context_t *ctxt, gfx_memory_stats_t *stats) {
+    struct gfx_texture_registry_t *reg = ctxt->textures;
+    memset(stats, 0, sizeof(gfx_memory_stats_t));
+    if (!reg) {
+        return;
+    }
+    stats->bytes = reg->bytes;
+    stats->peak_bytes = reg->peak_bytes;
+    stats->budget = reg->budget;
+    stats->textures = reg->count - reg->evicted;
+    stats->evicted = reg->evicted;
+    stats->evictions = reg->evictions;
+    stats->reloads = reg->reloads;
+}
@@ -0,0 +1,87 @@
+/// @file gfx_pack.c
+/// Memory-mapped asset packs: pre-decoded sprite pixels plus an index, written by
+/// tools/gfxpack. Sprites are created straight from the mapped pages: no image
+/// decoding and no intermediate buffer.
+
+#include "gfx.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+struct gfx_pack_t {
+    const uint8_t *data;
+    size_t size;
+    const gfx_pack_entry_t *entries;
+    uint32_t count;
+};
+
+/// Map an asset pack in memory and validate its index.
+/// @param path pack file.
+/// @return the pack or NULL if it is missing or invalid.
+/// When not needed anymore, release it with gfx_pack_close.
+gfx_pack_t *gfx_pack_open(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(gfx_pack_header_t)) {
+        close(fd);
+        return NULL;
+    }
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping stays valid
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+
+    const gfx_pack_header_t *header = data;
+    const gfx_pack_entry_t *entries = (const gfx_pack_entry_t *)(header+1);
+    size_t size = st.st_size;
+    bool valid = memcmp(header->magic, GFX_PACK_MAGIC, sizeof(header->magic)) == 0 &&
+                 header->version == GFX_PACK_VERSION &&
+                 header->count <= (size-sizeof(*header))/sizeof(gfx_pack_entry_t);
+    for (uint32_t i = 0; valid && i < header->count; i++) {
+        const gfx_pack_entry_t *e = &entries[i];
+        valid = memchr(e->name, 0, sizeof(e->name)) != NULL &&
+                gfx_pixel_layout_find(e->format) != NULL &&
+                e->pitch >= e->width*sizeof(pixel_t) &&
+                e->offset <= size && (uint64_t)e->pitch*e->height <= size-e->offset;
+    }
+    gfx_pack_t *pack = valid ? malloc(sizeof(gfx_pack_t)) : NULL;
+    if (!pack) {
+        munmap(data, size);
+        return NULL;
+    }
+    pack->data = data;
+    pack->size = size;
+    pack->entries = entries;
+    pack->count = header->count;
+    return pack;
+}
+
+/// Create a sprite from an asset pack.
+/// Pixels are copied from the mapped file into the texture, converted only
+/// if they were packed in another format than the renderer's native one.
+/// @param ctxt graphic context.
+/// @param pack asset pack.
+/// @param name name of the sprite in the pack (by default, the packed file's path).
+/// @return a pointer to the sprite or NULL if it isn't in the pack or in case of failure.
+/// When not needed anymore, deallocate it with gfx_sprite_destroy.
+SDL_Texture *gfx_pack_sprite(gfx_context_t *ctxt, gfx_pack_t *pack, const char *name) {
+    for (uint32_t i = 0; i < pack->count; i++) {
+        const gfx_pack_entry_t *e = &pack->entries[i];
+        if (strcmp(e->name, name) == 0) {
+            return gfx_sprite_create_layout(ctxt, pack->data+e->offset, e->pitch, e->width, e->height, gfx_pixel_layout_find(e->format));
+        }
+    }
+    return NULL;
+}
+
+/// Unmap an asset pack. Sprites created from it remain valid.
+/// @param pack asset pack.
+void gfx_pack_close(gfx_pack_t *pack) {
+    munmap((void *)pack->data, pack->size);
+    free(pack);
+}
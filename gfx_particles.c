@@ -0,0 +1,258 @@
+/// @file gfx_particles.c
+/// Particle system.
+/// Particles are stored as a structure of float arrays, alive ones packed at the
+/// front: the free slots are always [count, capacity), so emitting appends and
+/// the kill pass compacts the survivors in place. Integration and aging run 4
+/// particles at a time. Particles are drawn either as single pixels added into
+/// the background buffer (saturated), or as batched additive quads.
+
+#include "gfx_internal.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/// Create a particle system.
+/// @param capacity maximum number of live particles.
+/// @return the particle system or NULL on failure. Deallocate it with gfx_particles_destroy.
+gfx_particles_t *gfx_particles_create(int capacity) {
+    gfx_particles_t *ps = calloc(1, sizeof(gfx_particles_t));
+    if (!ps || capacity <= 0) {
+        free(ps);
+        return NULL;
+    }
+    ps->capacity = capacity;
+    ps->x = malloc(capacity*sizeof(float));
+    ps->y = malloc(capacity*sizeof(float));
+    ps->vx = malloc(capacity*sizeof(float));
+    ps->vy = malloc(capacity*sizeof(float));
+    ps->life = malloc(capacity*sizeof(float));
+    ps->color = malloc(capacity*sizeof(pixel_t));
+    ps->seed = 0x9e3779b9;
+    if (!ps->x || !ps->y || !ps->vx || !ps->vy || !ps->life || !ps->color) {
+        gfx_particles_destroy(ps);
+        return NULL;
+    }
+    return ps;
+}
+
+/// Destroy a particle system.
+/// @param ps the particle system (NULL is allowed).
+void gfx_particles_destroy(gfx_particles_t *ps) {
+    if (!ps) {
+        return;
+    }
+    free(ps->x);
+    free(ps->y);
+    free(ps->vx);
+    free(ps->vy);
+    free(ps->life);
+    free(ps->color);
+    free(ps->vertices);
+    free(ps->indices);
+    free(ps);
+}
+
+/// Uniform random number in [-1, 1) (xorshift32).
+static inline float random_signed(uint32_t *seed) {
+    uint32_t s = *seed;
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    *seed = s;
+    return (int32_t)s * (1.0f/2147483648.0f);
+}
+
+/// Emit particles from a point, in random directions.
+/// @param ps particle system.
+/// @param n number of particles.
+/// @param x emission point's x coordinate.
+/// @param y emission point's y coordinate.
+/// @param speed maximum speed along each axis, in pixels per time unit.
+/// @param life lifetime in time units (see gfx_particles_update).
+/// @param color particle color, added to what is below.
+/// @return the number of particles emitted (less than n when the system is full).
+int gfx_particles_emit(gfx_particles_t *ps, int n, float x, float y, float speed, float life, pixel_t color) {
+    n = SDL_min(n, ps->capacity - ps->count);
+    for (int i = ps->count; i < ps->count+n; i++) {
+        ps->x[i] = x;
+        ps->y[i] = y;
+        ps->vx[i] = speed*random_signed(&ps->seed);
+        ps->vy[i] = speed*random_signed(&ps->seed);
+        // Spread lifetimes a bit so that a burst doesn't vanish on a single frame.
+        ps->life[i] = life*(0.75f + 0.25f*random_signed(&ps->seed));
+        ps->color[i] = color;
+    }
+    ps->count += n;
+    return n;
+}
+
+/// Copy particle src into slot dst.
+static inline void particle_move(gfx_particles_t *ps, int dst, int src) {
+    ps->x[dst] = ps->x[src];
+    ps->y[dst] = ps->y[src];
+    ps->vx[dst] = ps->vx[src];
+    ps->vy[dst] = ps->vy[src];
+    ps->life[dst] = ps->life[src];
+    ps->color[dst] = ps->color[src];
+}
+
+/// Advance the particles: apply gravity, move, age, and remove the dead ones.
+/// @param ps particle system.
+/// @param dt elapsed time.
+void gfx_particles_update(gfx_particles_t *ps, float dt) {
+    int n = ps->count, i = 0;
+#ifdef __SSE2__
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 gx = _mm_set1_ps(ps->gravity_x*dt), gy = _mm_set1_ps(ps->gravity_y*dt);
+    for (; i+4 <= n; i += 4) {
+        __m128 vx = _mm_add_ps(_mm_loadu_ps(ps->vx+i), gx);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(ps->vy+i), gy);
+        _mm_storeu_ps(ps->vx+i, vx);
+        _mm_storeu_ps(ps->vy+i, vy);
+        _mm_storeu_ps(ps->x+i, _mm_add_ps(_mm_loadu_ps(ps->x+i), _mm_mul_ps(vx, vdt)));
+        _mm_storeu_ps(ps->y+i, _mm_add_ps(_mm_loadu_ps(ps->y+i), _mm_mul_ps(vy, vdt)));
+        _mm_storeu_ps(ps->life+i, _mm_sub_ps(_mm_loadu_ps(ps->life+i), vdt));
+    }
+#endif
+    for (; i < n; i++) {
+        ps->vx[i] += ps->gravity_x*dt;
+        ps->vy[i] += ps->gravity_y*dt;
+        ps->x[i] += ps->vx[i]*dt;
+        ps->y[i] += ps->vy[i]*dt;
+        ps->life[i] -= dt;
+    }
+
+    // Stream compaction: skip the leading live particles 4 at a time, then
+    // pack the survivors behind them.
+    i = 0;
+#ifdef __SSE2__
+    const __m128 zero = _mm_setzero_ps();
+    while (i+4 <= n && _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(ps->life+i), zero)) == 0xf) {
+        i += 4;
+    }
+#endif
+    int alive = i;
+    for (; i < n; i++) {
+        if (ps->life[i] > 0) {
+            if (alive != i) particle_move(ps, alive, i);
+            alive++;
+        }
+    }
+    ps->count = alive;
+}
+
+/// Add the particles to the background buffer, one pixel each, with saturation.
+/// Positions are on screen (the background scroll origin is applied).
+/// Call it before gfx_background_update.
+/// @param ctxt graphic context.
+/// @param ps particle system.
+void gfx_particles_render(gfx_context_t *ctxt, gfx_particles_t *ps) {
+    int stride = ctxt->pitch/sizeof(pixel_t);
+    int i = 0;
+#ifdef __SSE2__
+    const __m128i w = _mm_set1_epi32(ctxt->width), h = _mm_set1_epi32(ctxt->height);
+    const __m128i minus_one = _mm_set1_epi32(-1), vstride = _mm_set1_epi32(stride);
+    const __m128i sx = _mm_set1_epi32(ctxt->scroll_x), sy = _mm_set1_epi32(ctxt->scroll_y);
+    const __m128i wmax = _mm_set1_epi32(ctxt->width-1), hmax = _mm_set1_epi32(ctxt->height-1);
+    for (; i+4 <= ps->count; i += 4) {
+        // Truncation toward 0 would fold (-1, 0) onto column 0: floor first.
+        __m128i x = _mm_cvttps_epi32(_mm_add_ps(_mm_loadu_ps(ps->x+i), _mm_set1_ps(1.0f)));
+        __m128i y = _mm_cvttps_epi32(_mm_add_ps(_mm_loadu_ps(ps->y+i), _mm_set1_ps(1.0f)));
+        x = _mm_add_epi32(x, minus_one);
+        y = _mm_add_epi32(y, minus_one);
+        __m128i in = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(x, minus_one), _mm_cmplt_epi32(x, w)),
+                                   _mm_and_si128(_mm_cmpgt_epi32(y, minus_one), _mm_cmplt_epi32(y, h)));
+        int bits = _mm_movemask_ps(_mm_castsi128_ps(in));
+        if (!bits) continue;
+        // Apply the scroll origin, wrapping around.
+        x = _mm_add_epi32(x, sx);
+        y = _mm_add_epi32(y, sy);
+        x = _mm_sub_epi32(x, _mm_and_si128(w, _mm_cmpgt_epi32(x, wmax)));
+        y = _mm_sub_epi32(y, _mm_and_si128(h, _mm_cmpgt_epi32(y, hmax)));
+        // offset = y*stride + x, with 16x16 bit products (coordinates fit in 16 bits).
+        __m128i offset = _mm_add_epi32(_mm_madd_epi16(y, vstride), x);
+        int32_t offsets[4];
+        _mm_storeu_si128((__m128i *)offsets, offset);
+        for (int k = 0; k < 4; k++) {
+            if (!(bits & (1 << k))) continue;
+            pixel_t *p = ctxt->background + offsets[k];
+            __m128i sum = _mm_adds_epu8(_mm_cvtsi32_si128(*p), _mm_cvtsi32_si128(ps->color[i+k]));
+            *p = _mm_cvtsi128_si32(sum);
+        }
+    }
+#endif
+    for (; i < ps->count; i++) {
+        float fx = ps->x[i], fy = ps->y[i];
+        if (fx < 0 || fy < 0 || fx >= ctxt->width || fy >= ctxt->height) continue;
+        int x = (int)fx + ctxt->scroll_x, y = (int)fy + ctxt->scroll_y;
+        if (x >= ctxt->width) x -= ctxt->width;
+        if (y >= ctxt->height) y -= ctxt->height;
+        pixel_t *p = ctxt->background + stride*y + x;
+        pixel_t a = *p, b = ps->color[i], sum = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            sum |= (pixel_t)SDL_min(((a >> shift) & 0xff) + ((b >> shift) & 0xff), 255) << shift;
+        }
+        *p = sum;
+    }
+}
+
+/// Draw the particles as squares, additively blended, in a single draw call.
+/// @param ctxt graphic context.
+/// @param ps particle system.
+/// @param size side of the squares in pixels.
+/// @return 0 on success, -1 on failure.
+int gfx_particles_render_quads(gfx_context_t *ctxt, gfx_particles_t *ps, float size) {
+    if (ps->count == 0) {
+        return 0;
+    }
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (ps->count > ps->quad_capacity) {
+        SDL_Vertex *vertices = realloc(ps->vertices, (size_t)ps->capacity*4*sizeof(SDL_Vertex));
+        if (vertices) ps->vertices = vertices;
+        int *indices = realloc(ps->indices, (size_t)ps->capacity*6*sizeof(int));
+        if (indices) ps->indices = indices;
+        if (!vertices || !indices) {
+            return -1;
+        }
+        for (int q = 0; q < ps->capacity; q++) {
+            int *idx = ps->indices + 6*q;
+            idx[0] = 4*q;
+            idx[1] = 4*q+1;
+            idx[2] = 4*q+2;
+            idx[3] = 4*q+2;
+            idx[4] = 4*q+1;
+            idx[5] = 4*q+3;
+        }
+        ps->quad_capacity = ps->capacity;
+    }
+    float half = size/2;
+    for (int i = 0; i < ps->count; i++) {
+        pixel_t c = ps->color[i];
+        SDL_Color color = { GFX_RED(c), GFX_GREEN(c), GFX_BLUE(c), 255 };
+        float x0 = ps->x[i]-half, y0 = ps->y[i]-half, x1 = x0+size, y1 = y0+size;
+        SDL_Vertex *v = ps->vertices + 4*i;
+        v[0] = (SDL_Vertex){ { x0, y0 }, color, { 0, 0 } };
+        v[1] = (SDL_Vertex){ { x1, y0 }, color, { 0, 0 } };
+        v[2] = (SDL_Vertex){ { x0, y1 }, color, { 0, 0 } };
+        v[3] = (SDL_Vertex){ { x1, y1 }, color, { 0, 0 } };
+    }
+    SDL_BlendMode blend;
+    SDL_GetRenderDrawBlendMode(ctxt->renderer, &blend);
+    SDL_SetRenderDrawBlendMode(ctxt->renderer, SDL_BLENDMODE_ADD);
+    int ret = SDL_RenderGeometry(ctxt->renderer, NULL, ps->vertices, 4*ps->count, ps->indices, 6*ps->count);
+    SDL_SetRenderDrawBlendMode(ctxt->renderer, blend);
+    return ret;
+#else
+    SDL_BlendMode blend;
+    SDL_GetRenderDrawBlendMode(ctxt->renderer, &blend);
+    SDL_SetRenderDrawBlendMode(ctxt->renderer, SDL_BLENDMODE_ADD);
+    for (int i = 0; i < ps->count; i++) {
+        pixel_t c = ps->color[i];
+        SDL_FRect rect = { ps->x[i]-size/2, ps->y[i]-size/2, size, size };
+        SDL_SetRenderDrawColor(ctxt->renderer, GFX_RED(c), GFX_GREEN(c), GFX_BLUE(c), 255);
+        SDL_RenderFillRectF(ctxt->renderer, &rect);
+    }
+    SDL_SetRenderDrawBlendMode(ctxt->renderer, blend);
+    return 0;
+#endif
+}
@@ -0,0 +1,346 @@
+/// @file gfx_qoi.c
+/// QOI ("Quite OK Image") lossless codec, see https://qoiformat.org/qoi-specification.pdf
+/// The decoder is streaming: it consumes input in arbitrary pieces and writes
+/// native pixels straight to their destination (e.g. a locked texture).
+/// The encoder can split the image into chunks encoded in parallel; chunks are
+/// concatenated into a single standard QOI stream.
+
+#include "gfx_internal.h"
+#include <fcntl.h>
+#include <unistd.h>
+
+#define QOI_OP_INDEX 0x00  // 00xxxxxx
+#define QOI_OP_DIFF  0x40  // 01xxxxxx
+#define QOI_OP_LUMA  0x80  // 10xxxxxx
+#define QOI_OP_RUN   0xc0  // 11xxxxxx
+#define QOI_OP_RGB   0xfe  // 11111110
+#define QOI_OP_RGBA  0xff  // 11111111
+#define QOI_MASK_2   0xc0
+
+#define QOI_HASH(c) (((c).r*3 + (c).g*5 + (c).b*7 + (c).a*11) % 64)
+#define QOI_READ_SIZE 65536
+#define QOI_CHUNK_MIN_PIXELS 65536  // don't spawn threads for smaller chunks
+
+static const uint8_t qoi_padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+static inline uint32_t read_be32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static inline void write_be32(uint8_t *p, uint32_t v) {
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+/// Start decoding a QOI image.
+/// Set dec->pixels and dec->pitch to the destination before feeding data.
+/// @param dec decoder state.
+/// @param header the first GFX_QOI_HEADER_SIZE bytes of the image.
+/// @return 0 on success, -1 if the header is invalid.
+int gfx_qoi_decoder_init(gfx_qoi_decoder_t *dec, const uint8_t *header) {
+    memset(dec, 0, sizeof(gfx_qoi_decoder_t));
+    dec->width = read_be32(header+4);
+    dec->height = read_be32(header+8);
+    dec->channels = header[12];
+    if (memcmp(header, "qoif", 4) != 0 || dec->width <= 0 || dec->height <= 0 ||
+        dec->width > 32768 || dec->height > 32768 || (dec->channels != 3 && dec->channels != 4)) {
+        return -1;
+    }
+    dec->px.a = 255;
+    return 0;
+}
+
+/// Decode as many pixels as possible from a piece of the QOI stream (following the header).
+/// An operation split at the end of the piece isn't consumed: pass the remaining
+/// bytes again, followed by more data.
+/// @param dec decoder state.
+/// @param data piece of the stream.
+/// @param size size of the piece in bytes.
+/// @return the number of bytes consumed.
+size_t gfx_qoi_decoder_feed(gfx_qoi_decoder_t *dec, const uint8_t *data, size_t size) {
+    size_t p = 0;
+    while (dec->y < dec->height) {
+        if (dec->run > 0) {
+            dec->run--;
+        } else {
+            if (p >= size) break;
+            uint8_t b1 = data[p];
+            size_t len = b1 == QOI_OP_RGBA ? 5 : b1 == QOI_OP_RGB ? 4 : (b1 & QOI_MASK_2) == QOI_OP_LUMA ? 2 : 1;
+            if (p+len > size) break;
+
+            if (b1 == QOI_OP_RGB) {
+                dec->px.r = data[p+1];
+                dec->px.g = data[p+2];
+                dec->px.b = data[p+3];
+            } else if (b1 == QOI_OP_RGBA) {
+                dec->px.r = data[p+1];
+                dec->px.g = data[p+2];
+                dec->px.b = data[p+3];
+                dec->px.a = data[p+4];
+            } else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+                dec->px = dec->index[b1];
+            } else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+                dec->px.r += ((b1 >> 4) & 0x03) - 2;
+                dec->px.g += ((b1 >> 2) & 0x03) - 2;
+                dec->px.b += (b1 & 0x03) - 2;
+            } else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+                uint8_t b2 = data[p+1];
+                int vg = (b1 & 0x3f) - 32;
+                dec->px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+                dec->px.g += vg;
+                dec->px.b += vg - 8 + (b2 & 0x0f);
+            } else {
+                dec->run = b1 & 0x3f;
+            }
+            dec->index[QOI_HASH(dec->px)] = dec->px;
+            p += len;
+        }
+
+        pixel_t *row = (pixel_t *)((uint8_t *)dec->pixels + dec->pitch*dec->y);
+        row[dec->x] = gfx_rgba(dec->px.r, dec->px.g, dec->px.b, dec->px.a);
+        if (++dec->x == dec->width) {
+            dec->x = 0;
+            dec->y++;
+        }
+    }
+    return p;
+}
+
+/// Whether a file starts with the QOI magic.
+/// @param filename path to the file.
+/// @return true if the file is a QOI image.
+bool gfx_qoi_file(const char *filename) {
+    char magic[4];
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    bool is_qoi = read(fd, magic, sizeof(magic)) == sizeof(magic) && memcmp(magic, "qoif", 4) == 0;
+    close(fd);
+    return is_qoi;
+}
+
+/// Load a sprite from a QOI image, decoding the file as it is read straight
+/// into the locked texture. The texture isn't recorded by the context.
+/// @param ctxt graphic context.
+/// @param filename path to the file to load.
+/// @return the texture or NULL in case of failure.
+SDL_Texture *gfx_qoi_sprite_load(gfx_context_t *ctxt, const char *filename) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    uint8_t *buf = malloc(QOI_READ_SIZE);
+    SDL_Texture *tex = NULL;
+    gfx_qoi_decoder_t dec;
+    size_t len = 0;
+
+    // The header is tiny, fill the buffer once and parse it from there.
+    ssize_t n = buf ? read(fd, buf, QOI_READ_SIZE) : -1;
+    if (n < GFX_QOI_HEADER_SIZE || gfx_qoi_decoder_init(&dec, buf) < 0) {
+        goto out;
+    }
+    tex = SDL_CreateTexture(ctxt->renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_STREAMING, dec.width, dec.height);
+    if (!tex) {
+        goto out;
+    }
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    if (SDL_LockTexture(tex, NULL, &dec.pixels, &dec.pitch) != 0) {
+        SDL_DestroyTexture(tex);
+        tex = NULL;
+        goto out;
+    }
+
+    len = n - GFX_QOI_HEADER_SIZE;
+    memmove(buf, buf+GFX_QOI_HEADER_SIZE, len);
+    for (;;) {
+        size_t used = gfx_qoi_decoder_feed(&dec, buf, len);
+        len -= used;
+        memmove(buf, buf+used, len);
+        if (dec.y == dec.height) break;
+        n = read(fd, buf+len, QOI_READ_SIZE-len);
+        if (n <= 0) break;  // truncated image
+        len += n;
+    }
+    SDL_UnlockTexture(tex);
+    if (dec.y < dec.height) {
+        SDL_DestroyTexture(tex);
+        tex = NULL;
+    }
+
+out:
+    free(buf);
+    close(fd);
+    return tex;
+}
+
+typedef struct {
+    const pixel_t *pixels;
+    int pitch;
+    int width;
+    int first_row;
+    int last_row;     // excluded
+    uint8_t *out;     // worst case sized
+    size_t size;      // bytes produced
+} qoi_chunk_t;
+
+/// Encode a range of rows as QOI operations.
+/// The encoder only refers to index entries it set itself, and starts from the
+/// actual previous pixel of the image, so that the output of consecutive chunks
+/// concatenates into a valid stream.
+static int qoi_encode_chunk(void *data) {
+    qoi_chunk_t *chunk = data;
+    gfx_qoi_rgba_t index[64], px, prev = { 0, 0, 0, 255 };
+    uint64_t valid = 0;  // bit i set when index[i] was written by this chunk
+    uint8_t *out = chunk->out;
+    int run = 0;
+
+    if (chunk->first_row > 0) {
+        const pixel_t *row = (const pixel_t *)((const uint8_t *)chunk->pixels + chunk->pitch*(chunk->first_row-1));
+        pixel_t p = row[chunk->width-1];
+        prev = (gfx_qoi_rgba_t){ GFX_RED(p), GFX_GREEN(p), GFX_BLUE(p), GFX_ALPHA(p) };
+    }
+
+    for (int j = chunk->first_row; j < chunk->last_row; j++) {
+        const pixel_t *row = (const pixel_t *)((const uint8_t *)chunk->pixels + chunk->pitch*j);
+        for (int i = 0; i < chunk->width; i++) {
+            px = (gfx_qoi_rgba_t){ GFX_RED(row[i]), GFX_GREEN(row[i]), GFX_BLUE(row[i]), GFX_ALPHA(row[i]) };
+            if (px.r == prev.r && px.g == prev.g && px.b == prev.b && px.a == prev.a) {
+                if (++run == 62) {
+                    *out++ = QOI_OP_RUN | (run-1);
+                    run = 0;
+                }
+                continue;
+            }
+            if (run > 0) {
+                *out++ = QOI_OP_RUN | (run-1);
+                run = 0;
+            }
+            int pos = QOI_HASH(px);
+            gfx_qoi_rgba_t *c = &index[pos];
+            if ((valid >> pos & 1) && c->r == px.r && c->g == px.g && c->b == px.b && c->a == px.a) {
+                *out++ = QOI_OP_INDEX | pos;
+            } else {
+                index[pos] = px;
+                valid |= (uint64_t)1 << pos;
+                if (px.a == prev.a) {
+                    int8_t vr = px.r - prev.r, vg = px.g - prev.g, vb = px.b - prev.b;
+                    int8_t vg_r = vr - vg, vg_b = vb - vg;
+                    if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+                        *out++ = QOI_OP_DIFF | (vr+2) << 4 | (vg+2) << 2 | (vb+2);
+                    } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+                        *out++ = QOI_OP_LUMA | (vg+32);
+                        *out++ = (vg_r+8) << 4 | (vg_b+8);
+                    } else {
+                        *out++ = QOI_OP_RGB;
+                        *out++ = px.r;
+                        *out++ = px.g;
+                        *out++ = px.b;
+                    }
+                } else {
+                    *out++ = QOI_OP_RGBA;
+                    *out++ = px.r;
+                    *out++ = px.g;
+                    *out++ = px.b;
+                    *out++ = px.a;
+                }
+            }
+            prev = px;
+        }
+    }
+    if (run > 0) {
+        *out++ = QOI_OP_RUN | (run-1);
+    }
+    chunk->size = out - chunk->out;
+    return 0;
+}
+
+/// Encode pixels as a QOI image (4 channels, sRGB).
+/// @param pixels pixels to encode.
+/// @param pitch length of a row of pixels in bytes.
+/// @param width image width.
+/// @param height image height.
+/// @param threads number of threads to encode with, 0 for one per CPU
+/// (small images are always encoded by the calling thread).
+/// @param size returned size of the encoded image.
+/// @return the encoded image (to free with free) or NULL on failure.
+uint8_t *gfx_qoi_encode(const pixel_t *pixels, int pitch, int width, int height, int threads, size_t *size) {
+    if (threads <= 0) {
+        threads = SDL_GetCPUCount();
+    }
+    threads = SDL_max(1, SDL_min(threads, (int)((int64_t)width*height/QOI_CHUNK_MIN_PIXELS)));
+    threads = SDL_min(threads, height);
+
+    qoi_chunk_t *chunks = calloc(threads, sizeof(qoi_chunk_t));
+    SDL_Thread **workers = calloc(threads, sizeof(SDL_Thread *));
+    uint8_t *image = NULL;
+    bool ok = chunks && workers;
+    for (int t = 0; ok && t < threads; t++) {
+        qoi_chunk_t *c = &chunks[t];
+        c->pixels = pixels;
+        c->pitch = pitch;
+        c->width = width;
+        c->first_row = (int64_t)height*t/threads;
+        c->last_row = (int64_t)height*(t+1)/threads;
+        c->out = malloc((size_t)width*(c->last_row-c->first_row)*5);
+        ok = c->out != NULL;
+    }
+    if (ok) {
+        for (int t = 1; t < threads; t++) {
+            workers[t] = SDL_CreateThread(qoi_encode_chunk, "gfx_qoi", &chunks[t]);
+            if (!workers[t]) qoi_encode_chunk(&chunks[t]);
+        }
+        qoi_encode_chunk(&chunks[0]);
+        for (int t = 1; t < threads; t++) {
+            if (workers[t]) SDL_WaitThread(workers[t], NULL);
+        }
+
+        size_t total = GFX_QOI_HEADER_SIZE + sizeof(qoi_padding);
+        for (int t = 0; t < threads; t++) total += chunks[t].size;
+        image = malloc(total);
+        if (image) {
+            memcpy(image, "qoif", 4);
+            write_be32(image+4, width);
+            write_be32(image+8, height);
+            image[12] = 4;  // channels
+            image[13] = 0;  // sRGB with linear alpha
+            uint8_t *p = image + GFX_QOI_HEADER_SIZE;
+            for (int t = 0; t < threads; t++) {
+                memcpy(p, chunks[t].out, chunks[t].size);
+                p += chunks[t].size;
+            }
+            memcpy(p, qoi_padding, sizeof(qoi_padding));
+            *size = total;
+        }
+    }
+
+    for (int t = 0; chunks && t < threads; t++) free(chunks[t].out);
+    free(workers);
+    free(chunks);
+    return image;
+}
+
+/// Save pixels as a QOI file.
+/// @param filename path to the file to write.
+/// @param pixels pixels to encode.
+/// @param pitch length of a row of pixels in bytes.
+/// @param width image width.
+/// @param height image height.
+/// @param threads see gfx_qoi_encode.
+/// @return 0 on success, -1 on failure.
+int gfx_qoi_save(const char *filename, const pixel_t *pixels, int pitch, int width, int height, int threads) {
+    size_t size;
+    uint8_t *image = gfx_qoi_encode(pixels, pitch, width, height, threads, &size);
+    if (!image) {
+        return -1;
+    }
+    FILE *f = fopen(filename, "wb");
+    int ret = f && fwrite(image, size, 1, f) == 1 ? 0 : -1;
+    if (f && fclose(f) != 0) {
+        ret = -1;
+    }
+    free(image);
+    return ret;
+}
@@ -0,0 +1,135 @@
+/// @file gfx_scale.c
+/// Pre-scaled sprite variants.
+/// A sprite repeatedly rendered at the same non-native size gets a texture of
+/// that size (see gfx_texture_use), so that each draw becomes a plain copy.
+/// Variants are resampled once on the CPU: box filter when shrinking, nearest
+/// neighbour when enlarging (like the renderer's default scaling).
+
+#include "gfx_internal.h"
+
+/// Compute the source span [first, last) of each destination pixel along one axis.
+/// Shrinking averages all the source pixels covered, enlarging picks the nearest one.
+static void scale_spans(int src_size, int dst_size, int *first, int *last) {
+    for (int i = 0; i < dst_size; i++) {
+        first[i] = (int)((int64_t)i*src_size / dst_size);
+        last[i] = SDL_max(first[i]+1, (int)((int64_t)(i+1)*src_size / dst_size));
+    }
+}
+
+/// Resample packed pixels (gfx_pixel_layout) to another size.
+/// Colors are weighted by alpha, so that transparent pixels don't bleed into edges.
+/// @param src source pixels.
+/// @param src_pitch length of a source row in bytes.
+/// @param src_width source width in pixels.
+/// @param src_height source height in pixels.
+/// @param dst destination pixels.
+/// @param dst_pitch length of a destination row in bytes.
+/// @param dst_width destination width in pixels.
+/// @param dst_height destination height in pixels.
+/// @return 0 on success, -1 if out of memory.
+int gfx_pixels_scale(const pixel_t *src, int src_pitch, int src_width, int src_height,
+                     pixel_t *dst, int dst_pitch, int dst_width, int dst_height) {
+    int *spans = malloc(2*(dst_width+dst_height)*sizeof(int));
+    if (!spans) {
+        return -1;
+    }
+    int *x0 = spans, *x1 = x0+dst_width, *y0 = x1+dst_width, *y1 = y0+dst_height;
+    scale_spans(src_width, dst_width, x0, x1);
+    scale_spans(src_height, dst_height, y0, y1);
+
+    for (int j = 0; j < dst_height; j++) {
+        pixel_t *out = (pixel_t *)((uint8_t *)dst + dst_pitch*j);
+        for (int i = 0; i < dst_width; i++) {
+            if (x1[i]-x0[i] == 1 && y1[j]-y0[j] == 1) {
+                out[i] = ((const pixel_t *)((const uint8_t *)src + src_pitch*y0[j]))[x0[i]];
+                continue;
+            }
+            uint64_t r = 0, g = 0, b = 0, a = 0;
+            for (int y = y0[j]; y < y1[j]; y++) {
+                const pixel_t *row = (const pixel_t *)((const uint8_t *)src + src_pitch*y);
+                for (int x = x0[i]; x < x1[i]; x++) {
+                    pixel_t p = row[x];
+                    uint32_t pa = GFX_ALPHA(p);
+                    r += GFX_RED(p)*pa;
+                    g += GFX_GREEN(p)*pa;
+                    b += GFX_BLUE(p)*pa;
+                    a += pa;
+                }
+            }
+            uint32_t count = (x1[i]-x0[i])*(y1[j]-y0[j]);
+            out[i] = a ? gfx_rgba(r/a, g/a, b/a, a/count) : gfx_rgba(0, 0, 0, 0);
+        }
+    }
+    free(spans);
+    return 0;
+}
+
+/// Read back the pixels of a texture by copying it into a render target.
+/// @param ctxt graphic context.
+/// @param texture texture to read.
+/// @param width texture's width.
+/// @param height texture's height.
+/// @return the pixels (gfx_pixel_layout, packed rows) to free, or NULL on failure.
+pixel_t *gfx_texture_read(gfx_context_t *ctxt, SDL_Texture *texture, int width, int height) {
+    SDL_Renderer *renderer = ctxt->renderer;
+    if (!SDL_RenderTargetSupported(renderer)) {
+        return NULL;
+    }
+    pixel_t *pixels = malloc((size_t)width*height*sizeof(pixel_t));
+    SDL_Texture *target = SDL_CreateTexture(renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!pixels || !target) {
+        goto error;
+    }
+    SDL_Texture *prev_target = SDL_GetRenderTarget(renderer);
+    Uint8 r, g, b, a;
+    SDL_BlendMode blend;
+    SDL_GetTextureColorMod(texture, &r, &g, &b);
+    SDL_GetTextureAlphaMod(texture, &a);
+    SDL_GetTextureBlendMode(texture, &blend);
+    SDL_SetTextureColorMod(texture, 255, 255, 255);  // read the pixels themselves
+    SDL_SetTextureAlphaMod(texture, 255);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);  // keep alpha as is
+    int ret = SDL_SetRenderTarget(renderer, target);
+    if (ret == 0) {
+        ret = SDL_RenderCopy(renderer, texture, NULL, NULL) ||
+              SDL_RenderReadPixels(renderer, NULL, gfx_pixel_layout.format, pixels, width*sizeof(pixel_t));
+    }
+    SDL_SetRenderTarget(renderer, prev_target);
+    SDL_SetTextureColorMod(texture, r, g, b);
+    SDL_SetTextureAlphaMod(texture, a);
+    SDL_SetTextureBlendMode(texture, blend);
+    if (ret != 0) {
+        goto error;
+    }
+    SDL_DestroyTexture(target);
+    return pixels;
+
+error:
+    if (target) SDL_DestroyTexture(target);
+    free(pixels);
+    return NULL;
+}
+
+/// Create a copy of a texture resampled to another size.
+/// The new texture isn't recorded by the context.
+/// @param ctxt graphic context.
+/// @param texture source texture.
+/// @param width width of the new texture.
+/// @param height height of the new texture.
+/// @return the new texture or NULL on failure (e.g. no render target support).
+SDL_Texture *gfx_texture_scale(gfx_context_t *ctxt, SDL_Texture *texture, int width, int height) {
+    int src_width, src_height;
+    if (SDL_QueryTexture(texture, NULL, NULL, &src_width, &src_height) != 0) {
+        return NULL;
+    }
+    pixel_t *src = gfx_texture_read(ctxt, texture, src_width, src_height);
+    pixel_t *dst = malloc((size_t)width*height*sizeof(pixel_t));
+    SDL_Texture *scaled = NULL;
+    if (src && dst && gfx_pixels_scale(src, src_width*sizeof(pixel_t), src_width, src_height,
+                                       dst, width*sizeof(pixel_t), width, height) == 0) {
+        scaled = gfx_sprite_texture_create(ctxt, dst, width*sizeof(pixel_t), width, height, &gfx_pixel_layout);
+    }
+    free(dst);
+    free(src);
+    return scaled;
+}
@@ -0,0 +1,184 @@
+/// @file gfx_shm.c
+/// Shared-memory export of the presented frames, for other processes
+/// (recorders, monitors) to read them in place. gfx_present copies the
+/// background into the next of GFX_SHM_SLOTS slots of a shm_open or memfd
+/// region and publishes it with a seqlock: the render path never takes a lock
+/// nor waits on readers, and readers never copy unless they want to.
+///
+///     uint32_t seq;
+///     const gfx_shm_slot_t *slot = gfx_shm_acquire(shm, &seq);
+///     if (slot) {
+///         ...read (const uint8_t *)shm + slot->offset...
+///         if (!gfx_shm_release(slot, seq)) ...overwritten meanwhile, discard...
+///     }
+
+#define _GNU_SOURCE  // memfd_create
+#include "gfx_internal.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SHM_ALIGN 4096  // slots start on page boundaries
+
+struct gfx_shm_t {
+    int fd;
+    char *name;             // shm_open name, NULL for a memfd
+    gfx_shm_header_t *header;
+};
+
+/// Start exporting the presented frames to shared memory.
+/// The slots are sized for the current background: frames of a larger
+/// background (after a resize) are not exported.
+/// @param ctxt graphic context.
+/// @param name shm_open name (e.g. "/gfx_frames", removed by gfx_shm_stop), or
+/// NULL for an anonymous memfd, inherited by child processes or passed over a
+/// Unix socket.
+/// @return the file descriptor of the region, owned by the context, or -1 on failure.
+int gfx_shm_start(gfx_context_t *ctxt, const char *name) {
+    if (ctxt->shm) {
+        return -1;
+    }
+    uint64_t capacity = ((uint64_t)ctxt->pitch*ctxt->height + SHM_ALIGN-1) / SHM_ALIGN * SHM_ALIGN;
+    uint64_t header_size = (sizeof(gfx_shm_header_t) + SHM_ALIGN-1) / SHM_ALIGN * SHM_ALIGN;
+    uint64_t size = header_size + GFX_SHM_SLOTS*capacity;
+
+    struct gfx_shm_t *shm = calloc(1, sizeof(struct gfx_shm_t));
+    if (!shm) {
+        return -1;
+    }
+    shm->name = name ? strdup(name) : NULL;
+    shm->fd = name ? shm_open(name, O_RDWR|O_CREAT|O_TRUNC, 0600) : memfd_create("gfx_frames", 0);
+    void *data = MAP_FAILED;
+    if ((!name || shm->name) && shm->fd >= 0 && ftruncate(shm->fd, size) == 0) {
+        data = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, shm->fd, 0);
+    }
+    if (data == MAP_FAILED) {
+        if (shm->fd >= 0) {
+            close(shm->fd);
+            if (name) shm_unlink(name);
+        }
+        free(shm->name);
+        free(shm);
+        return -1;
+    }
+
+    gfx_shm_header_t *header = data;  // zero-filled by ftruncate
+    header->format = gfx_pixel_layout.format;
+    header->size = size;
+    header->slot_capacity = capacity;
+    for (int i = 0; i < GFX_SHM_SLOTS; i++) {
+        header->slots[i].offset = header_size + i*capacity;
+    }
+    memcpy(header->magic, GFX_SHM_MAGIC, sizeof(header->magic));
+    shm->header = header;
+    ctxt->shm = shm;
+    return shm->fd;
+}
+
+/// Publish the background in the next slot (called by gfx_present).
+/// @param ctxt graphic context.
+void gfx_shm_frame(gfx_context_t *ctxt) {
+    struct gfx_shm_t *shm = ctxt->shm;
+    if (!shm) {
+        return;
+    }
+    gfx_shm_header_t *header = shm->header;
+    int pitch = ctxt->width*sizeof(pixel_t);
+    if ((uint64_t)pitch*ctxt->height > header->slot_capacity) {
+        return;
+    }
+    // The slot written is the oldest one: readers still on the latest two are undisturbed.
+    uint32_t latest = (header->latest+1) % GFX_SHM_SLOTS;
+    gfx_shm_slot_t *slot = &header->slots[latest];
+    uint32_t seq = slot->seq;
+    __atomic_store_n(&slot->seq, seq+1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);  // odd seq visible before any pixel
+    gfx_background_copy(ctxt, (pixel_t *)((uint8_t *)header + slot->offset), pitch);
+    slot->width = ctxt->width;
+    slot->height = ctxt->height;
+    slot->pitch = pitch;
+    slot->frame = ctxt->frame;
+    __atomic_store_n(&slot->seq, seq+2, __ATOMIC_RELEASE);
+    __atomic_store_n(&header->latest, latest, __ATOMIC_RELEASE);
+}
+
+/// Stop exporting frames: the region is unmapped and its name removed, but
+/// readers that mapped it keep a valid (frozen) mapping.
+/// @param ctxt graphic context.
+void gfx_shm_stop(gfx_context_t *ctxt) {
+    struct gfx_shm_t *shm = ctxt->shm;
+    if (!shm) {
+        return;
+    }
+    munmap(shm->header, shm->header->size);
+    close(shm->fd);
+    if (shm->name) {
+        shm_unlink(shm->name);
+        free(shm->name);
+    }
+    free(shm);
+    ctxt->shm = NULL;
+}
+
+/// Map a frame export read-only, from another process.
+/// @param name shm_open name given to gfx_shm_start, or NULL to use fd.
+/// @param fd file descriptor of the region (memfd), used when name is NULL.
+/// @return the region or NULL if it can't be mapped or is invalid.
+/// Unmap it with gfx_shm_detach.
+const gfx_shm_header_t *gfx_shm_attach(const char *name, int fd) {
+    int map_fd = name ? shm_open(name, O_RDONLY, 0) : fd;
+    struct stat st;
+    if (map_fd < 0 || fstat(map_fd, &st) < 0 || (size_t)st.st_size < sizeof(gfx_shm_header_t)) {
+        if (name && map_fd >= 0) close(map_fd);
+        return NULL;
+    }
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, map_fd, 0);
+    if (name) close(map_fd);  // the mapping stays valid
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+    const gfx_shm_header_t *header = data;
+    bool valid = memcmp(header->magic, GFX_SHM_MAGIC, sizeof(header->magic)) == 0 &&
+                 header->size == (uint64_t)st.st_size;
+    for (int i = 0; valid && i < GFX_SHM_SLOTS; i++) {
+        valid = header->slots[i].offset <= header->size && header->slot_capacity <= header->size - header->slots[i].offset;
+    }
+    if (!valid) {
+        munmap(data, st.st_size);
+        return NULL;
+    }
+    return header;
+}
+
+/// Unmap a frame export.
+/// @param shm the region (NULL is allowed).
+void gfx_shm_detach(const gfx_shm_header_t *shm) {
+    if (shm) {
+        munmap((void *)shm, shm->size);
+    }
+}
+
+/// Get the slot holding the last completed frame, to read it in place.
+/// @param shm the region.
+/// @param seq returned sequence number, to give to gfx_shm_release.
+/// @return the slot, NULL if no frame was published yet or the writer is
+/// already overwriting it (try again).
+const gfx_shm_slot_t *gfx_shm_acquire(const gfx_shm_header_t *shm, uint32_t *seq) {
+    uint32_t latest = __atomic_load_n(&shm->latest, __ATOMIC_ACQUIRE);
+    const gfx_shm_slot_t *slot = &shm->slots[latest % GFX_SHM_SLOTS];
+    *seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+    if (*seq == 0 || (*seq & 1) || (uint64_t)slot->pitch*slot->height > shm->slot_capacity) {
+        return NULL;
+    }
+    return slot;
+}
+
+/// Check that a slot read since gfx_shm_acquire wasn't overwritten meanwhile.
+/// @param slot slot returned by gfx_shm_acquire.
+/// @param seq sequence number returned by gfx_shm_acquire.
+/// @return true if what was read is a complete frame, false to discard it.
+bool gfx_shm_release(const gfx_shm_slot_t *slot, uint32_t seq) {
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);  // reads of the pixels done before the check
+    return __atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq;
+}
@@ -0,0 +1,399 @@
+/// @file gfx_spatial.c
+/// Spatial hash broadphase for large sprite populations.
+/// Objects are rectangles identified by small integers chosen by the application
+/// (e.g. indices in its own arrays). The plane is split into square cells, hashed
+/// into buckets; every object is listed in the bucket of each cell it overlaps.
+/// Buckets are flat arrays built with a counting sort: count, prefix sum, fill.
+/// Objects that moved to other cells since the last full rebuild are moved out
+/// to a second, small index rebuilt on each update, so that mostly static
+/// populations only pay for what moved.
+
+#include "gfx_internal.h"
+
+#define SPATIAL_MIN_BUCKETS 64
+
+enum {
+    OBJECT_ACTIVE = 1,
+    OBJECT_DIRTY = 2,   // rectangle changed since the last update
+    OBJECT_BASE = 4,    // listed in the base index (with its current cells)
+    OBJECT_DELTA = 8,   // listed in the delta index
+};
+
+typedef struct {
+    int id;
+    int cx;             // cell coordinates
+    int cy;
+} spatial_item_t;
+
+typedef struct {
+    int *start;         // bucket b lists items[start[b]] to items[start[b+1]-1]
+    spatial_item_t *items;
+    int count;
+    int capacity;
+} spatial_index_t;
+
+typedef struct {
+    int cx0, cy0, cx1, cy1;  // range of cells overlapped (inclusive)
+} cell_range_t;
+
+struct gfx_spatial_t {
+    int cell_size;
+    int buckets;        // power of 2
+    int count;          // object slots (highest id + 1)
+    int capacity;
+    SDL_Rect *rects;
+    cell_range_t *ranges;
+    uint8_t *flags;
+    uint32_t *marks;    // query deduplication
+    uint32_t mark;
+    int *dirty;         // ids of dirty objects
+    int dirty_count;
+    int *delta;         // ids of objects in the delta index
+    int delta_count;
+    int active;
+    spatial_index_t base;
+    spatial_index_t index_delta;
+    spatial_item_t *scratch;  // pairs: items of one bucket
+    int scratch_capacity;
+    bool built;
+};
+
+static inline int floor_div(int a, int b) {
+    return a >= 0 ? a/b : -((-a+b-1)/b);
+}
+
+static inline int cell_bucket(const gfx_spatial_t *s, int cx, int cy) {
+    uint32_t h = (uint32_t)cx*73856093u ^ (uint32_t)cy*19349663u;
+    return (h ^ h >> 16) & (s->buckets-1);
+}
+
+static cell_range_t cell_range(const gfx_spatial_t *s, const SDL_Rect *r) {
+    return (cell_range_t){ floor_div(r->x, s->cell_size), floor_div(r->y, s->cell_size),
+                           floor_div(r->x+r->w-1, s->cell_size), floor_div(r->y+r->h-1, s->cell_size) };
+}
+
+static inline bool rects_overlap(const SDL_Rect *a, const SDL_Rect *b) {
+    return a->x < b->x+b->w && b->x < a->x+a->w && a->y < b->y+b->h && b->y < a->y+a->h;
+}
+
+/// Create a spatial hash.
+/// @param cell_size size of the cells in pixels, about the size of typical objects.
+/// @return the spatial hash or NULL on failure. Deallocate it with gfx_spatial_destroy.
+gfx_spatial_t *gfx_spatial_create(int cell_size) {
+    if (cell_size <= 0) {
+        return NULL;
+    }
+    gfx_spatial_t *s = calloc(1, sizeof(gfx_spatial_t));
+    if (!s) {
+        return NULL;
+    }
+    s->cell_size = cell_size;
+    s->buckets = SPATIAL_MIN_BUCKETS;
+    return s;
+}
+
+/// Destroy a spatial hash.
+/// @param s the spatial hash (NULL is allowed).
+void gfx_spatial_destroy(gfx_spatial_t *s) {
+    if (!s) {
+        return;
+    }
+    free(s->rects);
+    free(s->ranges);
+    free(s->flags);
+    free(s->marks);
+    free(s->dirty);
+    free(s->delta);
+    free(s->base.start);
+    free(s->base.items);
+    free(s->index_delta.start);
+    free(s->index_delta.items);
+    free(s->scratch);
+    free(s);
+}
+
+/// Grow a buffer to hold at least n elements (1.5x amortized).
+/// @return 0 on success, -1 if out of memory.
+static int buffer_reserve(void **buf, int *capacity, int n, size_t size) {
+    if (n <= *capacity) {
+        return 0;
+    }
+    int new_capacity = SDL_max(n, *capacity + *capacity/2 + 16);
+    void *p = realloc(*buf, (size_t)new_capacity*size);
+    if (!p) {
+        return -1;
+    }
+    *buf = p;
+    *capacity = new_capacity;
+    return 0;
+}
+
+/// Make room for object ids up to id.
+static int objects_reserve(gfx_spatial_t *s, int id) {
+    if (id < s->capacity) {
+        return 0;
+    }
+    int capacity = SDL_max(id+1, s->capacity + s->capacity/2 + 16);
+    SDL_Rect *rects = realloc(s->rects, capacity*sizeof(SDL_Rect));
+    if (rects) s->rects = rects;
+    cell_range_t *ranges = realloc(s->ranges, capacity*sizeof(cell_range_t));
+    if (ranges) s->ranges = ranges;
+    uint8_t *flags = realloc(s->flags, capacity);
+    if (flags) s->flags = flags;
+    uint32_t *marks = realloc(s->marks, capacity*sizeof(uint32_t));
+    if (marks) s->marks = marks;
+    int *dirty = realloc(s->dirty, capacity*sizeof(int));
+    if (dirty) s->dirty = dirty;
+    int *delta = realloc(s->delta, capacity*sizeof(int));
+    if (delta) s->delta = delta;
+    if (!rects || !ranges || !flags || !marks || !dirty || !delta) {
+        return -1;
+    }
+    memset(flags + s->capacity, 0, capacity - s->capacity);
+    memset(marks + s->capacity, 0, (capacity - s->capacity)*sizeof(uint32_t));
+    s->capacity = capacity;
+    return 0;
+}
+
+static void object_dirty(gfx_spatial_t *s, int id) {
+    if (!(s->flags[id] & OBJECT_DIRTY)) {
+        s->flags[id] |= OBJECT_DIRTY;
+        s->dirty[s->dirty_count++] = id;
+    }
+}
+
+/// Insert or move an object. Takes effect at the next gfx_spatial_update.
+/// @param s spatial hash.
+/// @param id object identifier (>= 0, keep them dense: arrays are sized by the largest).
+/// @param rect object bounds.
+/// @return 0 on success, -1 on failure.
+int gfx_spatial_set(gfx_spatial_t *s, int id, const SDL_Rect *rect) {
+    if (id < 0 || rect->w <= 0 || rect->h <= 0 || objects_reserve(s, id) < 0) {
+        return -1;
+    }
+    s->count = SDL_max(s->count, id+1);
+    if (!(s->flags[id] & OBJECT_ACTIVE)) {
+        s->active++;
+    }
+    s->flags[id] |= OBJECT_ACTIVE;
+    s->rects[id] = *rect;
+    object_dirty(s, id);
+    return 0;
+}
+
+/// Remove an object. Takes effect immediately.
+/// @param s spatial hash.
+/// @param id object identifier.
+void gfx_spatial_remove(gfx_spatial_t *s, int id) {
+    if (id < 0 || id >= s->count || !(s->flags[id] & OBJECT_ACTIVE)) {
+        return;
+    }
+    s->flags[id] &= ~OBJECT_ACTIVE;
+    s->active--;
+    object_dirty(s, id);
+}
+
+/// Build an index of the given objects with a counting sort over buckets.
+/// @return 0 on success, -1 if out of memory.
+static int index_build(gfx_spatial_t *s, spatial_index_t *ix, const int *ids, int n) {
+    int *start = realloc(ix->start, (s->buckets+1)*sizeof(int));
+    if (!start) {
+        return -1;
+    }
+    ix->start = start;
+    memset(start, 0, (s->buckets+1)*sizeof(int));
+
+    int total = 0;
+    for (int i = 0; i < n; i++) {
+        cell_range_t *r = &s->ranges[ids[i]];
+        for (int cy = r->cy0; cy <= r->cy1; cy++) {
+            for (int cx = r->cx0; cx <= r->cx1; cx++) {
+                start[cell_bucket(s, cx, cy)+1]++;
+            }
+        }
+        total += (r->cx1-r->cx0+1)*(r->cy1-r->cy0+1);
+    }
+    if (buffer_reserve((void **)&ix->items, &ix->capacity, total, sizeof(spatial_item_t)) < 0) {
+        return -1;
+    }
+    for (int b = 0; b < s->buckets; b++) {
+        start[b+1] += start[b];
+    }
+    // Fill using start[b] as the insertion cursor of bucket b, then shift back.
+    for (int i = 0; i < n; i++) {
+        cell_range_t *r = &s->ranges[ids[i]];
+        for (int cy = r->cy0; cy <= r->cy1; cy++) {
+            for (int cx = r->cx0; cx <= r->cx1; cx++) {
+                ix->items[start[cell_bucket(s, cx, cy)]++] = (spatial_item_t){ ids[i], cx, cy };
+            }
+        }
+    }
+    memmove(start+1, start, s->buckets*sizeof(int));
+    start[0] = 0;
+    ix->count = total;
+    return 0;
+}
+
+/// Apply the changes made since the last update.
+/// Objects whose cells changed go to the delta index; everything is rebuilt
+/// when the delta index grows past a quarter of the population.
+/// @param s spatial hash.
+/// @return 0 on success, -1 if out of memory.
+int gfx_spatial_update(gfx_spatial_t *s) {
+    for (int i = 0; i < s->dirty_count; i++) {
+        int id = s->dirty[i];
+        s->flags[id] &= ~OBJECT_DIRTY;
+        if (!(s->flags[id] & OBJECT_ACTIVE)) {
+            continue;
+        }
+        cell_range_t range = cell_range(s, &s->rects[id]);
+        if ((s->flags[id] & OBJECT_BASE) && memcmp(&range, &s->ranges[id], sizeof(range)) == 0) {
+            continue;  // still in the same cells
+        }
+        s->ranges[id] = range;
+        s->flags[id] &= ~OBJECT_BASE;  // its base entries are stale for good
+        if (!(s->flags[id] & OBJECT_DELTA)) {
+            s->flags[id] |= OBJECT_DELTA;
+            s->delta[s->delta_count++] = id;
+        }
+    }
+    s->dirty_count = 0;
+
+    if (s->built && s->delta_count <= s->active/4) {
+        // Drop removed objects from the delta list, then reindex it.
+        int n = 0;
+        for (int i = 0; i < s->delta_count; i++) {
+            if (s->flags[s->delta[i]] & OBJECT_ACTIVE) s->delta[n++] = s->delta[i];
+            else s->flags[s->delta[i]] &= ~OBJECT_DELTA;
+        }
+        s->delta_count = n;
+        return index_build(s, &s->index_delta, s->delta, n);
+    }
+
+    // Full rebuild, with buckets sized for the population.
+    int n = 0;
+    for (int id = 0; id < s->count; id++) {
+        s->flags[id] &= ~(OBJECT_BASE | OBJECT_DELTA);
+        if (s->flags[id] & OBJECT_ACTIVE) {
+            s->flags[id] |= OBJECT_BASE;
+            s->delta[n++] = id;
+        }
+    }
+    s->buckets = SPATIAL_MIN_BUCKETS;
+    while (s->buckets < 2*n) s->buckets *= 2;
+    s->delta_count = 0;
+    s->built = true;
+    if (index_build(s, &s->index_delta, s->delta, 0) < 0 || index_build(s, &s->base, s->delta, n) < 0) {
+        s->built = false;
+        return -1;
+    }
+    return 0;
+}
+
+/// Whether an item is current: its object is active and listed in this index.
+static inline bool item_live(const gfx_spatial_t *s, const spatial_item_t *item, bool delta) {
+    uint8_t flags = s->flags[item->id];
+    return (flags & OBJECT_ACTIVE) && (flags & (delta ? OBJECT_DELTA : OBJECT_BASE));
+}
+
+/// Find the objects overlapping a region.
+/// @param s spatial hash.
+/// @param region region to search.
+/// @param out receives the object ids, in no particular order.
+/// @param max size of out.
+/// @return the number of objects found (ids beyond max are not written).
+int gfx_spatial_query(gfx_spatial_t *s, const SDL_Rect *region, int *out, int max) {
+    if (!s->built || region->w <= 0 || region->h <= 0) {
+        return 0;
+    }
+    if (++s->mark == 0) {
+        memset(s->marks, 0, s->capacity*sizeof(uint32_t));
+        s->mark = 1;
+    }
+    int found = 0;
+    cell_range_t r = cell_range(s, region);
+    for (int cy = r.cy0; cy <= r.cy1; cy++) {
+        for (int cx = r.cx0; cx <= r.cx1; cx++) {
+            int b = cell_bucket(s, cx, cy);
+            for (int pass = 0; pass < 2; pass++) {
+                const spatial_index_t *ix = pass ? &s->index_delta : &s->base;
+                for (int k = ix->start[b]; k < ix->start[b+1]; k++) {
+                    const spatial_item_t *item = &ix->items[k];
+                    int id = item->id;
+                    if (s->marks[id] == s->mark || !item_live(s, item, pass) || !rects_overlap(&s->rects[id], region)) {
+                        continue;
+                    }
+                    s->marks[id] = s->mark;
+                    if (found < max) out[found] = id;
+                    found++;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+/// Find the objects containing a point, e.g. for mouse picking.
+/// @param s spatial hash.
+/// @param x point's x coordinate.
+/// @param y point's y coordinate.
+/// @param out receives the object ids, in no particular order.
+/// @param max size of out.
+/// @return the number of objects found (ids beyond max are not written).
+int gfx_spatial_pick(gfx_spatial_t *s, int x, int y, int *out, int max) {
+    SDL_Rect point = { x, y, 1, 1 };
+    return gfx_spatial_query(s, &point, out, max);
+}
+
+/// Find all the pairs of overlapping objects.
+/// Each pair is reported once, by the cell holding the top-left corner of the
+/// intersection of both rectangles.
+/// @param s spatial hash.
+/// @param out receives the pairs (a < b).
+/// @param max size of out.
+/// @return the number of pairs found (pairs beyond max are not written), -1 if out of memory.
+int gfx_spatial_pairs(gfx_spatial_t *s, gfx_spatial_pair_t *out, int max) {
+    if (!s->built) {
+        return 0;
+    }
+    int found = 0;
+    for (int b = 0; b < s->buckets; b++) {
+        // Gather the live items of the bucket from both indexes.
+        int n = 0;
+        int size = s->base.start[b+1]-s->base.start[b] + s->index_delta.start[b+1]-s->index_delta.start[b];
+        if (size < 2) {
+            continue;
+        }
+        if (buffer_reserve((void **)&s->scratch, &s->scratch_capacity, size, sizeof(spatial_item_t)) < 0) {
+            return -1;
+        }
+        for (int pass = 0; pass < 2; pass++) {
+            const spatial_index_t *ix = pass ? &s->index_delta : &s->base;
+            for (int k = ix->start[b]; k < ix->start[b+1]; k++) {
+                if (item_live(s, &ix->items[k], pass)) s->scratch[n++] = ix->items[k];
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            const spatial_item_t *p = &s->scratch[i];
+            const SDL_Rect *ra = &s->rects[p->id];
+            for (int j = i+1; j < n; j++) {
+                const spatial_item_t *q = &s->scratch[j];
+                const SDL_Rect *rb = &s->rects[q->id];
+                // Different cells may share the bucket: only pair items of the same cell.
+                if (p->cx != q->cx || p->cy != q->cy || !rects_overlap(ra, rb)) {
+                    continue;
+                }
+                if (floor_div(SDL_max(ra->x, rb->x), s->cell_size) != p->cx ||
+                    floor_div(SDL_max(ra->y, rb->y), s->cell_size) != p->cy) {
+                    continue;  // reported by another cell
+                }
+                if (found < max) {
+                    out[found] = (gfx_spatial_pair_t){ SDL_min(p->id, q->id), SDL_max(p->id, q->id) };
+                }
+                found++;
+            }
+        }
+    }
+    return found;
+}
@@ -0,0 +1,331 @@
+/// @file gfx_sprite_layer.c
+/// Sprite instances stored as a structure of arrays, rendered in one call.
+/// Positions, sizes and velocities are contiguous float arrays, so that the
+/// motion update and visibility culling run 4 instances at a time. Rendering
+/// sorts the visible instances by z then texture (radix sort) and submits each
+/// run of instances sharing a texture as a single geometry draw.
+
+#include "gfx_internal.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/// Create an empty sprite layer.
+/// @param capacity number of instances to allocate room for (grows as needed).
+/// @return the layer or NULL on failure. Deallocate it with gfx_sprite_layer_destroy.
+gfx_sprite_layer_t *gfx_sprite_layer_create(int capacity) {
+    gfx_sprite_layer_t *layer = calloc(1, sizeof(gfx_sprite_layer_t));
+    if (!layer || gfx_sprite_layer_reserve(layer, SDL_max(capacity, 16)) < 0) {
+        gfx_sprite_layer_destroy(layer);
+        return NULL;
+    }
+    return layer;
+}
+
+/// Destroy a sprite layer (not the textures it refers to).
+/// @param layer the layer (NULL is allowed).
+void gfx_sprite_layer_destroy(gfx_sprite_layer_t *layer) {
+    if (!layer) {
+        return;
+    }
+    free(layer->x);
+    free(layer->y);
+    free(layer->w);
+    free(layer->h);
+    free(layer->vx);
+    free(layer->vy);
+    free(layer->texture);
+    free(layer->src);
+    free(layer->z);
+    free(layer->textures);
+    free(layer->visible);
+    free(layer->sorted);
+    free(layer->vertices);
+    free(layer->indices);
+    free(layer);
+}
+
+#define LAYER_GROW(field) do { \
+        void *p = realloc(layer->field, (size_t)capacity*sizeof(*layer->field)); \
+        if (!p) return -1; \
+        layer->field = p; \
+    } while (0)
+
+/// Make room for a number of instances.
+/// @param layer sprite layer.
+/// @param capacity number of instances.
+/// @return 0 on success, -1 if out of memory.
+int gfx_sprite_layer_reserve(gfx_sprite_layer_t *layer, int capacity) {
+    if (capacity <= layer->capacity) {
+        return 0;
+    }
+    LAYER_GROW(x);
+    LAYER_GROW(y);
+    LAYER_GROW(w);
+    LAYER_GROW(h);
+    LAYER_GROW(vx);
+    LAYER_GROW(vy);
+    LAYER_GROW(texture);
+    LAYER_GROW(src);
+    LAYER_GROW(z);
+    LAYER_GROW(visible);
+    LAYER_GROW(sorted);
+    layer->capacity = capacity;
+    return 0;
+}
+
+/// Get the texture id of a sprite in a layer, adding it if needed.
+/// @param layer sprite layer.
+/// @param sprite the sprite.
+/// @return the texture id, -1 on failure.
+int gfx_sprite_layer_texture(gfx_sprite_layer_t *layer, SDL_Texture *sprite) {
+    for (int i = 0; i < layer->texture_count; i++) {
+        if (layer->textures[i] == sprite) return i;
+    }
+    if (layer->texture_count == UINT16_MAX) {
+        return -1;
+    }
+    SDL_Texture **textures = realloc(layer->textures, (layer->texture_count+1)*sizeof(SDL_Texture *));
+    if (!textures) {
+        return -1;
+    }
+    layer->textures = textures;
+    layer->textures[layer->texture_count] = sprite;
+    return layer->texture_count++;
+}
+
+/// Append instances to a layer.
+/// @param layer sprite layer.
+/// @param instances instances to add.
+/// @param n number of instances.
+/// @return the index of the first added instance, -1 on failure.
+int gfx_sprite_layer_add(gfx_sprite_layer_t *layer, const gfx_sprite_instance_t *instances, int n) {
+    int first = layer->count;
+    if (first+n > layer->capacity &&
+        gfx_sprite_layer_reserve(layer, SDL_max(first+n, layer->capacity + layer->capacity/2)) < 0) {
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        const gfx_sprite_instance_t *inst = &instances[i];
+        int k = first+i;
+        layer->x[k] = inst->x;
+        layer->y[k] = inst->y;
+        layer->w[k] = inst->w;
+        layer->h[k] = inst->h;
+        layer->vx[k] = inst->vx;
+        layer->vy[k] = inst->vy;
+        layer->texture[k] = inst->texture;
+        layer->src[k] = inst->src;
+        layer->z[k] = inst->z;
+    }
+    layer->count += n;
+    return first;
+}
+
+static int index_compare_desc(const void *a, const void *b) {
+    return *(const int *)b - *(const int *)a;
+}
+
+/// Remove instances from a layer. Each hole is filled with the last instance,
+/// so the indices of the instances at the end of the layer change.
+/// @param layer sprite layer.
+/// @param indices indices of the instances to remove (sorted in place, duplicates allowed).
+/// @param n number of indices.
+void gfx_sprite_layer_remove(gfx_sprite_layer_t *layer, int *indices, int n) {
+    // Highest first, so that the instance moved into a hole is never one to remove.
+    qsort(indices, n, sizeof(int), index_compare_desc);
+    for (int i = 0; i < n; i++) {
+        int k = indices[i];
+        if (k < 0 || k >= layer->count || (i > 0 && k == indices[i-1])) {
+            continue;
+        }
+        int last = --layer->count;
+        layer->x[k] = layer->x[last];
+        layer->y[k] = layer->y[last];
+        layer->w[k] = layer->w[last];
+        layer->h[k] = layer->h[last];
+        layer->vx[k] = layer->vx[last];
+        layer->vy[k] = layer->vy[last];
+        layer->texture[k] = layer->texture[last];
+        layer->src[k] = layer->src[last];
+        layer->z[k] = layer->z[last];
+    }
+}
+
+/// Move every instance of a layer along its velocity.
+/// @param layer sprite layer.
+/// @param dt elapsed time, in the unit of the velocities.
+void gfx_sprite_layer_move(gfx_sprite_layer_t *layer, float dt) {
+    int i = 0;
+#ifdef __SSE2__
+    __m128 vdt = _mm_set1_ps(dt);
+    for (; i+4 <= layer->count; i += 4) {
+        _mm_storeu_ps(layer->x+i, _mm_add_ps(_mm_loadu_ps(layer->x+i), _mm_mul_ps(_mm_loadu_ps(layer->vx+i), vdt)));
+        _mm_storeu_ps(layer->y+i, _mm_add_ps(_mm_loadu_ps(layer->y+i), _mm_mul_ps(_mm_loadu_ps(layer->vy+i), vdt)));
+    }
+#endif
+    for (; i < layer->count; i++) {
+        layer->x[i] += layer->vx[i]*dt;
+        layer->y[i] += layer->vy[i]*dt;
+    }
+}
+
+/// List the instances intersecting the screen.
+/// @return the number of visible instances, listed in layer->visible.
+static int layer_cull(gfx_sprite_layer_t *layer, float width, float height) {
+    int n = 0, i = 0;
+#ifdef __SSE2__
+    const __m128 zero = _mm_setzero_ps(), vw = _mm_set1_ps(width), vh = _mm_set1_ps(height);
+    for (; i+4 <= layer->count; i += 4) {
+        __m128 x = _mm_loadu_ps(layer->x+i), y = _mm_loadu_ps(layer->y+i);
+        __m128 in = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(x, vw), _mm_cmplt_ps(y, vh)),
+                               _mm_and_ps(_mm_cmpgt_ps(_mm_add_ps(x, _mm_loadu_ps(layer->w+i)), zero),
+                                          _mm_cmpgt_ps(_mm_add_ps(y, _mm_loadu_ps(layer->h+i)), zero)));
+        int bits = _mm_movemask_ps(in);
+        while (bits) {
+            layer->visible[n++] = i + __builtin_ctz(bits);
+            bits &= bits-1;
+        }
+    }
+#endif
+    for (; i < layer->count; i++) {
+        if (layer->x[i] < width && layer->y[i] < height && layer->x[i]+layer->w[i] > 0 && layer->y[i]+layer->h[i] > 0) {
+            layer->visible[n++] = i;
+        }
+    }
+    return n;
+}
+
+static inline uint32_t instance_key(const gfx_sprite_layer_t *layer, int i) {
+    return (uint32_t)(uint16_t)(layer->z[i] ^ 0x8000) << 16 | layer->texture[i];
+}
+
+/// Sort the visible instances by z then texture with a stable LSD radix sort,
+/// skipping the bytes all keys share.
+/// @return the sorted indices (layer->visible or layer->sorted).
+static int *layer_sort(gfx_sprite_layer_t *layer, int n) {
+    int *src = layer->visible, *dst = layer->sorted;
+    for (int shift = 0; shift < 32; shift += 8) {
+        int count[257] = { 0 };
+        for (int i = 0; i < n; i++) {
+            count[((instance_key(layer, src[i]) >> shift) & 0xff) + 1]++;
+        }
+        if (count[((instance_key(layer, src[0]) >> shift) & 0xff) + 1] == n) {
+            continue;  // all keys share this byte
+        }
+        for (int b = 0; b < 256; b++) {
+            count[b+1] += count[b];
+        }
+        for (int i = 0; i < n; i++) {
+            dst[count[(instance_key(layer, src[i]) >> shift) & 0xff]++] = src[i];
+        }
+        int *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    return src;
+}
+
+/// Make room for the geometry of n quads.
+static int layer_geometry_reserve(gfx_sprite_layer_t *layer, int n) {
+    if (n <= layer->quad_capacity) {
+        return 0;
+    }
+    SDL_Vertex *vertices = realloc(layer->vertices, (size_t)n*4*sizeof(SDL_Vertex));
+    if (vertices) layer->vertices = vertices;
+    int *indices = realloc(layer->indices, (size_t)n*6*sizeof(int));
+    if (indices) layer->indices = indices;
+    if (!vertices || !indices) {
+        return -1;
+    }
+    // Two triangles per quad, the pattern never changes.
+    for (int q = layer->quad_capacity; q < n; q++) {
+        int *idx = layer->indices + 6*q;
+        idx[0] = 4*q;
+        idx[1] = 4*q+1;
+        idx[2] = 4*q+2;
+        idx[3] = 4*q+2;
+        idx[4] = 4*q+1;
+        idx[5] = 4*q+3;
+    }
+    for (int v = 4*layer->quad_capacity; v < 4*n; v++) {
+        layer->vertices[v].color = (SDL_Color){ 255, 255, 255, 255 };
+    }
+    layer->quad_capacity = n;
+    return 0;
+}
+
+/// Draw a run of instances sharing a texture.
+/// @return 0 on success, -1 on failure.
+static int layer_draw_run(gfx_context_t *ctxt, gfx_sprite_layer_t *layer, SDL_Texture *texture, const int *run, int n) {
+    int tex_w, tex_h;
+    if (SDL_QueryTexture(texture, NULL, NULL, &tex_w, &tex_h) != 0) {
+        return -1;
+    }
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (layer_geometry_reserve(layer, n) < 0) {
+        return -1;
+    }
+    float sx = 1.0f/tex_w, sy = 1.0f/tex_h;
+    for (int q = 0; q < n; q++) {
+        int i = run[q];
+        const SDL_Rect *src = &layer->src[i];
+        float u0 = 0, v0 = 0, u1 = 1, v1 = 1;
+        if (src->w > 0) {
+            u0 = src->x*sx;
+            v0 = src->y*sy;
+            u1 = (src->x+src->w)*sx;
+            v1 = (src->y+src->h)*sy;
+        }
+        float x0 = layer->x[i], y0 = layer->y[i], x1 = x0+layer->w[i], y1 = y0+layer->h[i];
+        SDL_Vertex *v = layer->vertices + 4*q;
+        v[0].position = (SDL_FPoint){ x0, y0 }; v[0].tex_coord = (SDL_FPoint){ u0, v0 };
+        v[1].position = (SDL_FPoint){ x1, y0 }; v[1].tex_coord = (SDL_FPoint){ u1, v0 };
+        v[2].position = (SDL_FPoint){ x0, y1 }; v[2].tex_coord = (SDL_FPoint){ u0, v1 };
+        v[3].position = (SDL_FPoint){ x1, y1 }; v[3].tex_coord = (SDL_FPoint){ u1, v1 };
+    }
+    return SDL_RenderGeometry(ctxt->renderer, texture, layer->vertices, 4*n, layer->indices, 6*n);
+#else
+    for (int q = 0; q < n; q++) {
+        int i = run[q];
+        SDL_FRect dst = { layer->x[i], layer->y[i], layer->w[i], layer->h[i] };
+        SDL_RenderCopyF(ctxt->renderer, texture, layer->src[i].w > 0 ? &layer->src[i] : NULL, &dst);
+    }
+    return 0;
+#endif
+}
+
+/// Render the visible instances of a layer: lower z first, and within a z
+/// level one draw call per texture (the order of instances sharing a z level
+/// is unspecified). Instances outside the current render target (the screen,
+/// or e.g. a gfx_target being baked) are culled.
+/// @param ctxt graphic context.
+/// @param layer sprite layer.
+/// @return the number of instances drawn.
+int gfx_sprite_layer_render(gfx_context_t *ctxt, gfx_sprite_layer_t *layer) {
+    int width = ctxt->width, height = ctxt->height;
+    SDL_Texture *target = SDL_GetRenderTarget(ctxt->renderer);
+    int target_width, target_height;
+    if (target && SDL_QueryTexture(target, NULL, NULL, &target_width, &target_height) == 0) {
+        width = target_width;
+        height = target_height;
+    }
+    int n = layer_cull(layer, width, height);
+    if (n == 0) {
+        return 0;
+    }
+    int *order = layer_sort(layer, n);
+    int drawn = 0;
+    for (int start = 0; start < n;) {
+        uint32_t key = instance_key(layer, order[start]);
+        int end = start+1;
+        while (end < n && instance_key(layer, order[end]) == key) end++;
+        int id = layer->texture[order[start]];
+        SDL_Texture *texture = id < layer->texture_count ? gfx_texture_use(ctxt, layer->textures[id], 0, 0) : NULL;
+        if (texture && layer_draw_run(ctxt, layer, texture, order+start, end-start) == 0) {
+            drawn += end-start;
+        }
+        start = end;
+    }
+    return drawn;
+}
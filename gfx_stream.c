@@ -0,0 +1,486 @@
+/// @file gfx_stream.c
+/// Framebuffer streaming to a remote viewer (see tools/gfxview.c).
+/// At gfx_present the background is snapshotted for a sender thread, which
+/// compares it with the last frame sent in GFX_STREAM_TILE x GFX_STREAM_TILE
+/// tiles and sends only the tiles that changed, RLE-compressed, over a Unix or
+/// TCP socket: the bandwidth follows what changes on the screen, not its size.
+/// One viewer is served at a time; it gets a full frame when it connects.
+
+#include "gfx_internal.h"
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define STREAM_ACCEPT_TIMEOUT 100  // ms between checks for a viewer connecting or hanging up
+#define STREAM_SEND_TIMEOUT 2000   // ms without progress before a viewer is dropped
+#define STREAM_MAX_SIZE 16384      // largest frame side accepted by the receiver
+
+struct gfx_stream_t {
+    int listen_fd;
+    int client_fd;                 // connected viewer, -1 if none
+    char *unix_path;               // socket file to remove at the end, if any
+    pixel_t *snapshot;             // frame handed to the sender thread
+    int snapshot_width;
+    int snapshot_height;
+    uint32_t snapshot_frame;
+    bool pending;                  // snapshot waiting to be sent
+    bool stopping;
+    // Sender thread state.
+    pixel_t *sent;                 // frame as the viewer has it
+    int sent_width;
+    int sent_height;
+    bool full;                     // send every tile, e.g. to a new viewer
+    uint8_t *out;                  // message being built
+    size_t out_capacity;
+    uint32_t tile[GFX_STREAM_TILE*GFX_STREAM_TILE];     // tile being encoded
+    uint32_t pixels[GFX_STREAM_TILE*GFX_STREAM_TILE];   // its RLE pixels
+    uint8_t control[GFX_STREAM_TILE*GFX_STREAM_TILE];   // and control bytes
+    gfx_stream_stats_t stats;
+    SDL_mutex *lock;
+    SDL_cond *cond;
+    SDL_Thread *thread;
+};
+
+/// Resolve an address: "unix:PATH" or "tcp:HOST:PORT".
+/// @return 0 on success, -1 on failure.
+static int address_parse(const char *address, struct sockaddr_storage *sa, socklen_t *len) {
+    memset(sa, 0, sizeof(*sa));
+    if (strncmp(address, "unix:", 5) == 0) {
+        struct sockaddr_un *un = (struct sockaddr_un *)sa;
+        if (strlen(address+5) >= sizeof(un->sun_path)) {
+            return -1;
+        }
+        un->sun_family = AF_UNIX;
+        strcpy(un->sun_path, address+5);
+        *len = sizeof(struct sockaddr_un);
+        return 0;
+    }
+    const char *colon = strncmp(address, "tcp:", 4) == 0 ? strrchr(address+4, ':') : NULL;
+    if (!colon || colon == address+4 || colon-address-4 >= NI_MAXHOST) {
+        return -1;
+    }
+    char host[NI_MAXHOST];
+    memcpy(host, address+4, colon-address-4);
+    host[colon-address-4] = '\0';
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM }, *res;
+    if (getaddrinfo(host, colon+1, &hints, &res) != 0) {
+        return -1;
+    }
+    memcpy(sa, res->ai_addr, res->ai_addrlen);
+    *len = res->ai_addrlen;
+    freeaddrinfo(res);
+    return 0;
+}
+
+/// Whether gfx_stream_stop was called.
+static bool stream_stopping(struct gfx_stream_t *st) {
+    SDL_LockMutex(st->lock);
+    bool stopping = st->stopping;
+    SDL_UnlockMutex(st->lock);
+    return stopping;
+}
+
+/// Send a whole buffer to the viewer, retrying on short writes.
+/// Gives up when the viewer stops reading for STREAM_SEND_TIMEOUT ms or the
+/// stream is stopped, so that a stalled viewer can't block gfx_stream_stop.
+/// @return 0 on success, -1 on error (e.g. the viewer went away or stalled).
+static int send_all(struct gfx_stream_t *st, const void *buf, size_t size) {
+    const uint8_t *p = buf;
+    int waited = 0;
+    while (size > 0) {
+        ssize_t n = send(st->client_fd, p, size, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return -1;
+            // Socket buffer full: wait for the viewer to read, a bit at a time.
+            struct pollfd pfd = { .fd = st->client_fd, .events = POLLOUT };
+            if (poll(&pfd, 1, STREAM_ACCEPT_TIMEOUT) == 0) {
+                waited += STREAM_ACCEPT_TIMEOUT;
+            }
+            if (waited >= STREAM_SEND_TIMEOUT || stream_stopping(st)) {
+                return -1;
+            }
+            continue;
+        }
+        p += n;
+        size -= n;
+        waited = 0;
+    }
+    return 0;
+}
+
+/// Read a whole buffer.
+/// @return 0 on success, -1 on error or end of stream.
+static int read_all(int fd, void *buf, size_t size) {
+    uint8_t *p = buf;
+    while (size > 0) {
+        ssize_t n = read(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        size -= n;
+    }
+    return 0;
+}
+
+/// Whether two tiles of frames with the same stride are identical.
+/// @param a first pixel of the tile in the first frame.
+/// @param b first pixel of the tile in the second frame.
+/// @param stride length of a frame row in pixels.
+/// @param width tile width.
+/// @param height tile height.
+static bool tile_equal(const pixel_t *a, const pixel_t *b, int stride, int width, int height) {
+    for (int j = 0; j < height; j++) {
+        const pixel_t *ra = a + (size_t)stride*j, *rb = b + (size_t)stride*j;
+        int i = 0;
+#ifdef __SSE2__
+        __m128i diff = _mm_setzero_si128();
+        for (; i+8 <= width; i += 8) {
+            __m128i d0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(ra+i)), _mm_loadu_si128((const __m128i *)(rb+i)));
+            __m128i d1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(ra+i+4)), _mm_loadu_si128((const __m128i *)(rb+i+4)));
+            diff = _mm_or_si128(diff, _mm_or_si128(d0, d1));
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) != 0xffff) {
+            return false;
+        }
+#endif
+        for (; i < width; i++) {
+            if (ra[i] != rb[i]) return false;
+        }
+    }
+    return true;
+}
+
+/// Make the sender's copy of the frame match the snapshot size.
+/// @return 0 on success, -1 on failure.
+static int stream_resize(struct gfx_stream_t *st, int width, int height) {
+    if (st->sent && st->sent_width == width && st->sent_height == height) {
+        return 0;
+    }
+    int tiles = ((width+GFX_STREAM_TILE-1)/GFX_STREAM_TILE) * ((height+GFX_STREAM_TILE-1)/GFX_STREAM_TILE);
+    size_t tile_max = sizeof(gfx_stream_tile_t) + GFX_STREAM_TILE*GFX_STREAM_TILE*(1+sizeof(uint32_t)) + 3;
+    size_t capacity = sizeof(gfx_stream_frame_t) + tiles*tile_max;
+    pixel_t *sent = realloc(st->sent, (size_t)width*height*sizeof(pixel_t));
+    if (sent) st->sent = sent;
+    uint8_t *out = capacity > st->out_capacity ? realloc(st->out, capacity) : st->out;
+    if (out && capacity > st->out_capacity) {
+        st->out = out;
+        st->out_capacity = capacity;
+    }
+    if (!sent || !out) {
+        return -1;
+    }
+    st->sent_width = width;
+    st->sent_height = height;
+    st->full = true;
+    return 0;
+}
+
+/// Build the message holding the tiles of the snapshot that differ from the
+/// frame sent last, and update the latter.
+/// @return the message size, 0 if nothing changed.
+static size_t stream_encode(struct gfx_stream_t *st) {
+    uint32_t *tile = st->tile, *pixels = st->pixels;
+    uint8_t *control = st->control;
+    int width = st->sent_width, height = st->sent_height;
+    gfx_stream_frame_t header = { .frame = st->snapshot_frame, .width = width, .height = height };
+    memcpy(header.magic, GFX_STREAM_MAGIC, sizeof(header.magic));
+    size_t size = sizeof(header);
+
+    for (int y = 0; y < height; y += GFX_STREAM_TILE) {
+        for (int x = 0; x < width; x += GFX_STREAM_TILE) {
+            int w = SDL_min(GFX_STREAM_TILE, width-x), h = SDL_min(GFX_STREAM_TILE, height-y);
+            const pixel_t *src = st->snapshot + (size_t)width*y + x;
+            pixel_t *sent = st->sent + (size_t)width*y + x;
+            if (!st->full && tile_equal(src, sent, width, w, h)) {
+                continue;
+            }
+            for (int j = 0; j < h; j++) {
+                gfx_pixels_convert(tile + w*j, &gfx_pixel_layout_rgba32, src + (size_t)width*j, &gfx_pixel_layout, w);
+                memcpy(sent + (size_t)width*j, src + (size_t)width*j, w*sizeof(pixel_t));
+            }
+            gfx_stream_tile_t th = { .x = x, .y = y, .width = w, .height = h };
+            th.pixel_count = gfx_rle_encode(tile, w*h, control, pixels, &th.control_size);
+            uint32_t padded = (th.control_size+3)/4*4;
+            memcpy(st->out + size, &th, sizeof(th));
+            size += sizeof(th);
+            memcpy(st->out + size, control, th.control_size);
+            memset(st->out + size + th.control_size, 0, padded - th.control_size);
+            size += padded;
+            memcpy(st->out + size, pixels, th.pixel_count*sizeof(uint32_t));
+            size += th.pixel_count*sizeof(uint32_t);
+            header.tiles++;
+        }
+    }
+    st->full = false;
+    if (header.tiles == 0) {
+        return 0;
+    }
+    memcpy(st->out, &header, sizeof(header));
+    return size;
+}
+
+/// Sender thread: accepts a viewer, then sends it the snapshots.
+static int stream_thread(void *data) {
+    struct gfx_stream_t *st = data;
+
+    SDL_LockMutex(st->lock);
+    while (!st->stopping) {
+        if (st->client_fd < 0) {
+            SDL_UnlockMutex(st->lock);
+            struct pollfd pfd = { .fd = st->listen_fd, .events = POLLIN };
+            int fd = poll(&pfd, 1, STREAM_ACCEPT_TIMEOUT) > 0 ? accept(st->listen_fd, NULL, NULL) : -1;
+            SDL_LockMutex(st->lock);
+            if (fd >= 0) {
+                st->client_fd = fd;
+                st->full = true;
+                st->stats.connected = true;
+            }
+            continue;
+        }
+        if (!st->pending) {
+            SDL_CondWaitTimeout(st->cond, st->lock, STREAM_ACCEPT_TIMEOUT);
+            // The viewer never writes: the socket becomes readable when it hangs up.
+            struct pollfd pfd = { .fd = st->client_fd, .events = POLLIN };
+            if (!st->pending && poll(&pfd, 1, 0) > 0) {
+                close(st->client_fd);
+                st->client_fd = -1;
+                st->stats.connected = false;
+            }
+            continue;
+        }
+        SDL_UnlockMutex(st->lock);
+
+        // The snapshot is owned by this thread until pending is cleared.
+        size_t size = 0;
+        bool failed = stream_resize(st, st->snapshot_width, st->snapshot_height) < 0;
+        if (!failed) {
+            size = stream_encode(st);
+            failed = size > 0 && send_all(st, st->out, size) < 0;
+        }
+
+        SDL_LockMutex(st->lock);
+        if (failed) {
+            close(st->client_fd);
+            st->client_fd = -1;
+            st->stats.connected = false;
+        } else if (size > 0) {
+            st->stats.frames++;
+            st->stats.tiles += ((gfx_stream_frame_t *)st->out)->tiles;
+            st->stats.bytes += size;
+        }
+        st->pending = false;
+    }
+    SDL_UnlockMutex(st->lock);
+    return 0;
+}
+
+/// Start serving the background to a viewer (see tools/gfxview.c).
+/// A snapshot is taken at each gfx_present while a viewer is connected.
+/// @param ctxt graphic context.
+/// @param address "unix:PATH" (an existing socket file is replaced) or
+/// "tcp:HOST:PORT" (e.g. "tcp:0.0.0.0:5900" to accept remote viewers).
+/// @return 0 on success, -1 on failure.
+int gfx_stream_start(gfx_context_t *ctxt, const char *address) {
+    struct sockaddr_storage sa;
+    socklen_t len;
+    if (ctxt->stream || address_parse(address, &sa, &len) < 0) {
+        return -1;
+    }
+    struct gfx_stream_t *st = calloc(1, sizeof(struct gfx_stream_t));
+    if (!st) {
+        return -1;
+    }
+    st->client_fd = -1;
+    st->listen_fd = socket(sa.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    bool ok = st->listen_fd >= 0;
+    if (ok && sa.ss_family == AF_UNIX) {
+        struct stat info;
+        st->unix_path = strdup(((struct sockaddr_un *)&sa)->sun_path);
+        if (st->unix_path && stat(st->unix_path, &info) == 0 && S_ISSOCK(info.st_mode)) {
+            unlink(st->unix_path);  // left by a previous run
+        }
+        ok = st->unix_path != NULL;
+    } else if (ok) {
+        setsockopt(st->listen_fd, SOL_SOCKET, SO_REUSEADDR, &(int){ 1 }, sizeof(int));
+    }
+    ok = ok && bind(st->listen_fd, (struct sockaddr *)&sa, len) == 0 && listen(st->listen_fd, 1) == 0;
+    if (!ok && st->unix_path) {
+        free(st->unix_path);
+        st->unix_path = NULL;  // not ours to remove
+    }
+    st->lock = SDL_CreateMutex();
+    st->cond = SDL_CreateCond();
+    if (ok && st->lock && st->cond) {
+        st->thread = SDL_CreateThread(stream_thread, "gfx_stream", st);
+    }
+    if (!st->thread) {
+        if (st->cond) SDL_DestroyCond(st->cond);
+        if (st->lock) SDL_DestroyMutex(st->lock);
+        if (st->listen_fd >= 0) close(st->listen_fd);
+        if (st->unix_path) unlink(st->unix_path);
+        free(st->unix_path);
+        free(st);
+        return -1;
+    }
+    ctxt->stream = st;
+    return 0;
+}
+
+/// Snapshot the background for the sender thread (called by gfx_present).
+/// Never blocks: the frame is skipped while no viewer is connected or while
+/// the previous one is still being sent.
+/// @param ctxt graphic context.
+void gfx_stream_frame(gfx_context_t *ctxt) {
+    struct gfx_stream_t *st = ctxt->stream;
+    if (!st) {
+        return;
+    }
+    SDL_LockMutex(st->lock);
+    bool skip = st->pending || !st->stats.connected;
+    if (st->pending && st->stats.connected) {
+        st->stats.dropped++;
+    }
+    SDL_UnlockMutex(st->lock);
+    if (skip) {
+        return;
+    }
+
+    // The snapshot is owned by the render thread while not pending.
+    if (st->snapshot_width != ctxt->width || st->snapshot_height != ctxt->height) {
+        pixel_t *snapshot = realloc(st->snapshot, (size_t)ctxt->width*ctxt->height*sizeof(pixel_t));
+        if (!snapshot) {
+            return;
+        }
+        st->snapshot = snapshot;
+        st->snapshot_width = ctxt->width;
+        st->snapshot_height = ctxt->height;
+    }
+    gfx_background_copy(ctxt, st->snapshot, ctxt->width*sizeof(pixel_t));
+    st->snapshot_frame = ctxt->frame;
+
+    SDL_LockMutex(st->lock);
+    st->pending = true;
+    SDL_CondSignal(st->cond);
+    SDL_UnlockMutex(st->lock);
+}
+
+/// Retrieve the stream counters.
+/// @param ctxt graphic context.
+/// @param stats returned counters, all 0 if not streaming.
+void gfx_stream_stats(gfx_context_t *ctxt, gfx_stream_stats_t *stats) {
+    struct gfx_stream_t *st = ctxt->stream;
+    memset(stats, 0, sizeof(*stats));
+    if (st) {
+        SDL_LockMutex(st->lock);
+        *stats = st->stats;
+        SDL_UnlockMutex(st->lock);
+    }
+}
+
+/// Stop streaming: the frame being sent, if any, is finished first unless the
+/// viewer isn't reading it (it is then dropped).
+/// @param ctxt graphic context.
+void gfx_stream_stop(gfx_context_t *ctxt) {
+    struct gfx_stream_t *st = ctxt->stream;
+    if (!st) {
+        return;
+    }
+    SDL_LockMutex(st->lock);
+    st->stopping = true;
+    SDL_CondSignal(st->cond);
+    SDL_UnlockMutex(st->lock);
+    SDL_WaitThread(st->thread, NULL);
+
+    if (st->client_fd >= 0) close(st->client_fd);
+    close(st->listen_fd);
+    if (st->unix_path) unlink(st->unix_path);
+    free(st->unix_path);
+    SDL_DestroyCond(st->cond);
+    SDL_DestroyMutex(st->lock);
+    free(st->snapshot);
+    free(st->sent);
+    free(st->out);
+    free(st);
+    ctxt->stream = NULL;
+}
+
+/// Connect to a stream server.
+/// @param address see gfx_stream_start.
+/// @return the socket to give to gfx_stream_receive, -1 on failure.
+int gfx_stream_connect(const char *address) {
+    struct sockaddr_storage sa;
+    socklen_t len;
+    if (address_parse(address, &sa, &len) < 0) {
+        return -1;
+    }
+    int fd = socket(sa.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd >= 0 && connect(fd, (struct sockaddr *)&sa, len) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/// Receive one message from a stream server and apply its tiles to a view.
+/// Blocks until a message arrives: poll the socket first to avoid it.
+/// @param fd socket returned by gfx_stream_connect.
+/// @param view reassembled frame, zero-initialized before the first call.
+/// Deallocate its pixels with gfx_stream_view_free.
+/// @return 0 on success, -1 on error or end of stream.
+int gfx_stream_receive(int fd, gfx_stream_view_t *view) {
+    uint32_t pixels[GFX_STREAM_TILE*GFX_STREAM_TILE];
+    uint8_t control[GFX_STREAM_TILE*GFX_STREAM_TILE+3];
+    gfx_stream_frame_t header;
+    if (read_all(fd, &header, sizeof(header)) < 0 ||
+        memcmp(header.magic, GFX_STREAM_MAGIC, sizeof(header.magic)) != 0 ||
+        header.width == 0 || header.height == 0 || header.width > STREAM_MAX_SIZE || header.height > STREAM_MAX_SIZE) {
+        return -1;
+    }
+    if ((int)header.width != view->width || (int)header.height != view->height) {
+        uint32_t *p = realloc(view->pixels, (size_t)header.width*header.height*sizeof(uint32_t));
+        if (!p) {
+            return -1;
+        }
+        memset(p, 0, (size_t)header.width*header.height*sizeof(uint32_t));
+        view->pixels = p;
+        view->width = header.width;
+        view->height = header.height;
+    }
+    view->frame = header.frame;
+    view->tiles = header.tiles;
+
+    for (uint32_t t = 0; t < header.tiles; t++) {
+        gfx_stream_tile_t th;
+        if (read_all(fd, &th, sizeof(th)) < 0 ||
+            th.width == 0 || th.height == 0 || th.width > GFX_STREAM_TILE || th.height > GFX_STREAM_TILE ||
+            th.x + th.width > view->width || th.y + th.height > view->height ||
+            th.control_size > (uint32_t)th.width*th.height || th.pixel_count > (uint32_t)th.width*th.height ||
+            read_all(fd, control, (th.control_size+3)/4*4) < 0 ||
+            read_all(fd, pixels, th.pixel_count*sizeof(uint32_t)) < 0) {
+            return -1;
+        }
+        uint32_t *dst = view->pixels + (size_t)view->width*th.y + th.x;
+        if (gfx_rle_decode(control, th.control_size, pixels, th.pixel_count, dst, &gfx_pixel_layout_rgba32,
+                           view->width*sizeof(uint32_t), th.width, th.height) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/// Free the pixels of a view.
+/// @param view the view (NULL is allowed).
+void gfx_stream_view_free(gfx_stream_view_t *view) {
+    if (view) {
+        free(view->pixels);
+        memset(view, 0, sizeof(*view));
+    }
+}
@@ -0,0 +1,128 @@
+/// @file gfx_target.c
+/// Render-to-texture targets.
+/// A target wraps an SDL_TEXTUREACCESS_TARGET texture into which any sequence
+/// of gfx draws can be baked once, then drawn as a single sprite. Its content
+/// stays valid until invalidated by the application, or until the renderer
+/// loses its targets (SDL_RENDER_TARGETS_RESET), and is only re-baked then:
+///
+///     if (gfx_target_begin(target) > 0) {
+///         ...draws...
+///         gfx_target_end(target);
+///     }
+///     gfx_sprite_render(ctxt, gfx_target_sprite(target), x, y, w, h);
+
+#include "gfx_internal.h"
+
+struct gfx_target_t {
+    gfx_context_t *ctxt;
+    SDL_Texture *texture;       // registered handle
+    int width;
+    int height;
+    bool valid;                 // baked and not invalidated since
+    uint32_t targets_reset;     // ctxt->targets_reset when baked
+    SDL_Texture *prev_target;   // render target to restore at gfx_target_end
+    bool baking;
+};
+
+/// Create a render target, initially invalid (transparent).
+/// @param ctxt graphic context.
+/// @param width width in pixels.
+/// @param height height in pixels.
+/// @return the target or NULL on failure (e.g. the renderer doesn't support
+/// render targets). Deallocate it with gfx_target_destroy.
+gfx_target_t *gfx_target_create(gfx_context_t *ctxt, int width, int height) {
+    if (width <= 0 || height <= 0 || !SDL_RenderTargetSupported(ctxt->renderer)) {
+        return NULL;
+    }
+    gfx_target_t *target = calloc(1, sizeof(gfx_target_t));
+    if (!target) {
+        return NULL;
+    }
+    SDL_Texture *tex = SDL_CreateTexture(ctxt->renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (tex) {
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    }
+    target->texture = gfx_texture_register(ctxt, tex, NULL);
+    if (!target->texture) {
+        free(target);
+        return NULL;
+    }
+    target->ctxt = ctxt;
+    target->width = width;
+    target->height = height;
+    return target;
+}
+
+/// Destroy a render target and its texture.
+/// @param target the target (NULL is allowed).
+void gfx_target_destroy(gfx_target_t *target) {
+    if (!target) {
+        return;
+    }
+    if (target->baking) {
+        gfx_target_end(target);
+    }
+    gfx_texture_unregister(target->ctxt, target->texture);
+    free(target);
+}
+
+/// Start baking a target if its content isn't valid: subsequent draws go into
+/// its texture, cleared to transparent, until gfx_target_end.
+/// Targets can be nested.
+/// @param target the target.
+/// @return 1 if baking started (draw, then call gfx_target_end), 0 if the
+/// content is still valid (nothing to draw), -1 on failure.
+int gfx_target_begin(gfx_target_t *target) {
+    gfx_context_t *ctxt = target->ctxt;
+    if (target->baking) {
+        return -1;
+    }
+    if (gfx_target_valid(target)) {
+        return 0;
+    }
+    target->prev_target = SDL_GetRenderTarget(ctxt->renderer);
+    if (SDL_SetRenderTarget(ctxt->renderer, target->texture) != 0) {
+        return -1;
+    }
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(ctxt->renderer, &r, &g, &b, &a);
+    SDL_SetRenderDrawColor(ctxt->renderer, 0, 0, 0, 0);
+    SDL_RenderClear(ctxt->renderer);
+    SDL_SetRenderDrawColor(ctxt->renderer, r, g, b, a);
+    target->baking = true;
+    return 1;
+}
+
+/// Finish baking a target: draws go back to the previous render target, and
+/// the target stays valid until invalidated.
+/// @param target the target.
+void gfx_target_end(gfx_target_t *target) {
+    if (!target->baking) {
+        return;
+    }
+    SDL_SetRenderTarget(target->ctxt->renderer, target->prev_target);
+    target->baking = false;
+    target->valid = true;
+    target->targets_reset = target->ctxt->targets_reset;
+}
+
+/// Mark the content of a target as outdated: the next gfx_target_begin re-bakes it.
+/// @param target the target.
+void gfx_target_invalidate(gfx_target_t *target) {
+    target->valid = false;
+}
+
+/// Whether a target holds a valid baked content.
+/// @param target the target.
+/// @return true if baked and neither invalidated nor lost since.
+bool gfx_target_valid(gfx_target_t *target) {
+    return target->valid && target->targets_reset == target->ctxt->targets_reset;
+}
+
+/// Get the texture of a target, to be drawn like a sprite (gfx_sprite_render,
+/// sprite layers, tilesets...). It belongs to the target: don't destroy it.
+/// @param target the target.
+/// @return the texture.
+SDL_Texture *gfx_target_sprite(gfx_target_t *target) {
+    return target->texture;
+}
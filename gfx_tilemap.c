@@ -0,0 +1,237 @@
+/// @file gfx_tilemap.c
+/// Chunked tilemap renderer.
+/// Tiles are 16-bit indices in a tileset texture. The map is split into chunks
+/// of GFX_TILEMAP_CHUNK x GFX_TILEMAP_CHUNK tiles, each pre-rendered into its
+/// own render target texture. Changing a tile only marks its chunk dirty; dirty
+/// chunks are re-baked when they become visible, and so are all chunks after the
+/// renderer lost its render targets. A frame then costs one copy per chunk
+/// intersecting the viewport, whatever the number of tiles.
+
+#include "gfx_internal.h"
+
+typedef struct {
+    SDL_Texture *texture;   // baked tiles, NULL if not created yet (or empty)
+    bool dirty;
+    bool empty;             // no tile at all: nothing to draw
+} tilemap_chunk_t;
+
+struct gfx_tilemap_t {
+    gfx_context_t *ctxt;
+    SDL_Texture *tileset;
+    int tile_size;
+    int tileset_columns;
+    int width;              // in tiles
+    int height;
+    uint16_t *tiles;
+    int chunks_x;
+    int chunks_y;
+    tilemap_chunk_t *chunks;
+    uint32_t targets_reset; // ctxt->targets_reset the chunks were baked with
+};
+
+/// Create a tilemap, all tiles empty.
+/// @param ctxt graphic context.
+/// @param tileset sprite holding the tiles, left to right then top to bottom.
+/// @param tile_size side of a tile in pixels.
+/// @param width map width in tiles.
+/// @param height map height in tiles.
+/// @return the tilemap or NULL on failure. Deallocate it with gfx_tilemap_destroy.
+gfx_tilemap_t *gfx_tilemap_create(gfx_context_t *ctxt, SDL_Texture *tileset, int tile_size, int width, int height) {
+    int tileset_width;
+    if (tile_size <= 0 || width <= 0 || height <= 0 ||
+        SDL_QueryTexture(gfx_texture_use(ctxt, tileset, 0, 0), NULL, NULL, &tileset_width, NULL) != 0) {
+        return NULL;
+    }
+    gfx_tilemap_t *tm = calloc(1, sizeof(gfx_tilemap_t));
+    if (!tm) {
+        return NULL;
+    }
+    tm->ctxt = ctxt;
+    tm->tileset = tileset;
+    tm->tile_size = tile_size;
+    tm->tileset_columns = SDL_max(tileset_width/tile_size, 1);
+    tm->targets_reset = ctxt->targets_reset;
+    tm->width = width;
+    tm->height = height;
+    tm->chunks_x = (width + GFX_TILEMAP_CHUNK-1) / GFX_TILEMAP_CHUNK;
+    tm->chunks_y = (height + GFX_TILEMAP_CHUNK-1) / GFX_TILEMAP_CHUNK;
+    tm->tiles = malloc((size_t)width*height*sizeof(uint16_t));
+    tm->chunks = calloc((size_t)tm->chunks_x*tm->chunks_y, sizeof(tilemap_chunk_t));
+    if (!tm->tiles || !tm->chunks) {
+        gfx_tilemap_destroy(tm);
+        return NULL;
+    }
+    memset(tm->tiles, 0xff, (size_t)width*height*sizeof(uint16_t));  // GFX_TILE_EMPTY
+    for (int i = 0; i < tm->chunks_x*tm->chunks_y; i++) {
+        tm->chunks[i].empty = true;
+    }
+    return tm;
+}
+
+/// Destroy a tilemap (not its tileset).
+/// @param tm the tilemap (NULL is allowed).
+void gfx_tilemap_destroy(gfx_tilemap_t *tm) {
+    if (!tm) {
+        return;
+    }
+    for (int i = 0; tm->chunks && i < tm->chunks_x*tm->chunks_y; i++) {
+        if (tm->chunks[i].texture) gfx_texture_unregister(tm->ctxt, tm->chunks[i].texture);
+    }
+    free(tm->chunks);
+    free(tm->tiles);
+    free(tm);
+}
+
+/// Set a tile.
+/// @param tm tilemap.
+/// @param x tile column.
+/// @param y tile row.
+/// @param tile index of the tile in the tileset, or GFX_TILE_EMPTY.
+void gfx_tilemap_set(gfx_tilemap_t *tm, int x, int y, uint16_t tile) {
+    if ((unsigned)x >= (unsigned)tm->width || (unsigned)y >= (unsigned)tm->height) {
+        return;
+    }
+    uint16_t *t = &tm->tiles[(size_t)tm->width*y + x];
+    if (*t != tile) {
+        *t = tile;
+        tm->chunks[tm->chunks_x*(y/GFX_TILEMAP_CHUNK) + x/GFX_TILEMAP_CHUNK].dirty = true;
+    }
+}
+
+/// Get a tile.
+/// @param tm tilemap.
+/// @param x tile column.
+/// @param y tile row.
+/// @return the tile index, GFX_TILE_EMPTY if empty or outside the map.
+uint16_t gfx_tilemap_get(gfx_tilemap_t *tm, int x, int y) {
+    if ((unsigned)x >= (unsigned)tm->width || (unsigned)y >= (unsigned)tm->height) {
+        return GFX_TILE_EMPTY;
+    }
+    return tm->tiles[(size_t)tm->width*y + x];
+}
+
+/// Mark every chunk for re-baking, e.g. after the tileset changed or render
+/// targets were lost (SDL_RENDER_TARGETS_RESET).
+/// @param tm tilemap.
+void gfx_tilemap_invalidate(gfx_tilemap_t *tm) {
+    for (int i = 0; i < tm->chunks_x*tm->chunks_y; i++) {
+        tm->chunks[i].dirty = true;
+    }
+}
+
+/// Draw the tiles of a chunk, its top-left corner at (x, y) on the current target.
+static void chunk_draw_tiles(gfx_tilemap_t *tm, SDL_Texture *tileset, int cx, int cy, int x, int y) {
+    int ts = tm->tile_size;
+    int i0 = cx*GFX_TILEMAP_CHUNK, i1 = SDL_min(i0+GFX_TILEMAP_CHUNK, tm->width);
+    int j0 = cy*GFX_TILEMAP_CHUNK, j1 = SDL_min(j0+GFX_TILEMAP_CHUNK, tm->height);
+    for (int j = j0; j < j1; j++) {
+        const uint16_t *row = tm->tiles + (size_t)tm->width*j;
+        for (int i = i0; i < i1; i++) {
+            if (row[i] == GFX_TILE_EMPTY) continue;
+            SDL_Rect src = { row[i] % tm->tileset_columns * ts, row[i] / tm->tileset_columns * ts, ts, ts };
+            SDL_Rect dst = { x + (i-i0)*ts, y + (j-j0)*ts, ts, ts };
+            SDL_RenderCopy(tm->ctxt->renderer, tileset, &src, &dst);
+        }
+    }
+}
+
+/// Whether a chunk has no tile.
+static bool chunk_is_empty(gfx_tilemap_t *tm, int cx, int cy) {
+    int i0 = cx*GFX_TILEMAP_CHUNK, i1 = SDL_min(i0+GFX_TILEMAP_CHUNK, tm->width);
+    int j0 = cy*GFX_TILEMAP_CHUNK, j1 = SDL_min(j0+GFX_TILEMAP_CHUNK, tm->height);
+    for (int j = j0; j < j1; j++) {
+        for (int i = i0; i < i1; i++) {
+            if (tm->tiles[(size_t)tm->width*j + i] != GFX_TILE_EMPTY) return false;
+        }
+    }
+    return true;
+}
+
+/// Render the tiles of a chunk into its texture.
+/// @return 0 on success, -1 on failure.
+static int chunk_bake(gfx_tilemap_t *tm, SDL_Texture *tileset, int cx, int cy) {
+    tilemap_chunk_t *chunk = &tm->chunks[tm->chunks_x*cy + cx];
+    SDL_Renderer *renderer = tm->ctxt->renderer;
+    chunk->empty = chunk_is_empty(tm, cx, cy);
+    if (chunk->empty) {
+        chunk->dirty = false;
+        return 0;  // keep the texture, if any, for later
+    }
+    if (!chunk->texture) {
+        int size = GFX_TILEMAP_CHUNK*tm->tile_size;
+        SDL_Texture *tex = SDL_CreateTexture(renderer, gfx_pixel_layout.format, SDL_TEXTUREACCESS_TARGET, size, size);
+        if (!tex) {
+            return -1;
+        }
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        chunk->texture = gfx_texture_register(tm->ctxt, tex, NULL);
+        if (!chunk->texture) {
+            return -1;
+        }
+    }
+
+    SDL_Texture *prev_target = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, chunk->texture) != 0) {
+        return -1;
+    }
+    Uint8 r, g, b, a;
+    SDL_BlendMode blend;
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    // Tiles don't overlap: copy them as is, alpha included.
+    SDL_GetTextureBlendMode(tileset, &blend);
+    SDL_SetTextureBlendMode(tileset, SDL_BLENDMODE_NONE);
+    chunk_draw_tiles(tm, tileset, cx, cy, 0, 0);
+    SDL_SetTextureBlendMode(tileset, blend);
+    SDL_SetRenderTarget(renderer, prev_target);
+    chunk->dirty = false;
+    return 0;
+}
+
+/// Render the part of a tilemap visible through the screen.
+/// Dirty chunks coming into view are re-baked first.
+/// @param ctxt graphic context.
+/// @param tm tilemap.
+/// @param view_x x coordinate, in map pixels, shown at the left of the screen.
+/// @param view_y y coordinate, in map pixels, shown at the top of the screen.
+void gfx_tilemap_render(gfx_context_t *ctxt, gfx_tilemap_t *tm, int view_x, int view_y) {
+    SDL_Texture *tileset = gfx_texture_use(ctxt, tm->tileset, 0, 0);
+    if (!tileset) {
+        return;
+    }
+    if (view_x+ctxt->width <= 0 || view_y+ctxt->height <= 0) {
+        return;
+    }
+    int chunk_size = GFX_TILEMAP_CHUNK*tm->tile_size;
+    int cx0 = SDL_max(view_x, 0) / chunk_size, cx1 = SDL_min((view_x+ctxt->width-1) / chunk_size, tm->chunks_x-1);
+    int cy0 = SDL_max(view_y, 0) / chunk_size, cy1 = SDL_min((view_y+ctxt->height-1) / chunk_size, tm->chunks_y-1);
+    bool baked = SDL_RenderTargetSupported(ctxt->renderer);
+    if (tm->targets_reset != ctxt->targets_reset) {
+        gfx_tilemap_invalidate(tm);  // the baked chunks were lost
+        tm->targets_reset = ctxt->targets_reset;
+    }
+
+    // Bake before drawing, to switch render targets as little as possible.
+    for (int cy = cy0; baked && cy <= cy1; cy++) {
+        for (int cx = cx0; cx <= cx1; cx++) {
+            tilemap_chunk_t *chunk = &tm->chunks[tm->chunks_x*cy + cx];
+            if (chunk->dirty && chunk_bake(tm, tileset, cx, cy) < 0) {
+                baked = false;
+            }
+        }
+    }
+    for (int cy = cy0; cy <= cy1; cy++) {
+        for (int cx = cx0; cx <= cx1; cx++) {
+            tilemap_chunk_t *chunk = &tm->chunks[tm->chunks_x*cy + cx];
+            int x = cx*chunk_size - view_x, y = cy*chunk_size - view_y;
+            if (!baked) {
+                chunk_draw_tiles(tm, tileset, cx, cy, x, y);  // no render targets: tile by tile
+            } else if (!chunk->empty) {
+                SDL_Rect dst = { x, y, chunk_size, chunk_size };
+                SDL_RenderCopy(ctxt->renderer, chunk->texture, NULL, &dst);
+            }
+        }
+    }
+}
@@ -0,0 +1,184 @@
+/// @file gfx_trace.c
+/// Trace events in the Chrome trace-event format (chrome://tracing, Perfetto).
+/// Each thread records its GFX_TRACE_SCOPE events into its own ring buffer of
+/// the last GFX_TRACE_EVENTS events: no lock and no allocation after the
+/// thread's first event. A dump reads all the rings while they keep being
+/// written, and drops the events that may have been overwritten meanwhile.
+/// Rings of exited threads are reused by new threads.
+
+#include "gfx_internal.h"
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+typedef struct {
+    const char *name;
+    uint64_t start;
+    uint64_t end;
+    uint32_t tid;
+} trace_event_t;
+
+typedef struct trace_ring_t {
+    struct trace_ring_t *next;      // all rings, linked once and never freed
+    int in_use;                     // owned by a live thread
+    uint64_t head;                  // number of events written so far
+    trace_event_t events[GFX_TRACE_EVENTS];
+} trace_ring_t;
+
+int gfx_trace_enabled = 0;
+static trace_ring_t *trace_rings = NULL;
+static __thread trace_ring_t *trace_ring = NULL;    // ring of the calling thread
+static __thread uint32_t trace_tid = 0;
+static pthread_key_t trace_key;
+static pthread_once_t trace_key_once = PTHREAD_ONCE_INIT;
+static char *trace_signal_path = NULL;
+static volatile sig_atomic_t trace_dump_requested = 0;
+
+/// Give the ring of an exiting thread back.
+static void trace_ring_release(void *ring) {
+    __atomic_store_n(&((trace_ring_t *)ring)->in_use, 0, __ATOMIC_RELEASE);
+}
+
+static void trace_key_create(void) {
+    pthread_key_create(&trace_key, trace_ring_release);
+}
+
+/// Find a free ring or create one for the calling thread.
+/// @return the ring or NULL on failure.
+static trace_ring_t *trace_ring_acquire(void) {
+    pthread_once(&trace_key_once, trace_key_create);
+    trace_ring_t *ring = __atomic_load_n(&trace_rings, __ATOMIC_ACQUIRE);
+    for (; ring; ring = ring->next) {
+        int expected = 0;
+        if (__atomic_compare_exchange_n(&ring->in_use, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+    if (!ring) {
+        ring = calloc(1, sizeof(trace_ring_t));
+        if (!ring) {
+            return NULL;
+        }
+        ring->in_use = 1;
+        ring->next = __atomic_load_n(&trace_rings, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&trace_rings, &ring->next, ring, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+        }
+    }
+    pthread_setspecific(trace_key, ring);
+    trace_tid = (uint32_t)SDL_ThreadID();
+    return ring;
+}
+
+/// Record an event of the calling thread (used by GFX_TRACE_SCOPE).
+/// @param name name of the event.
+/// @param start start time (SDL_GetPerformanceCounter).
+/// @param end end time.
+void gfx_trace_record(const char *name, uint64_t start, uint64_t end) {
+    trace_ring_t *ring = trace_ring;
+    if (!ring) {
+        ring = trace_ring = trace_ring_acquire();
+        if (!ring) {
+            return;
+        }
+    }
+    uint64_t head = ring->head;  // only written by this thread
+    trace_event_t *e = &ring->events[head & (GFX_TRACE_EVENTS-1)];
+    e->name = name;
+    e->start = start;
+    e->end = end;
+    e->tid = trace_tid;
+    __atomic_store_n(&ring->head, head+1, __ATOMIC_RELEASE);
+}
+
+/// Start or stop recording trace events.
+/// @param enabled true to record.
+void gfx_trace_enable(bool enabled) {
+    __atomic_store_n(&gfx_trace_enabled, enabled, __ATOMIC_RELAXED);
+}
+
+/// Write a string as a JSON string.
+static void json_string(FILE *f, const char *s) {
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', f);
+        if ((unsigned char)*s >= 0x20) fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+/// Write the events recorded so far to a Chrome trace-event JSON file.
+/// Can be called while other threads keep recording.
+/// @param path file to write.
+/// @return the number of events written, -1 on failure.
+int gfx_trace_dump(const char *path) {
+    trace_event_t *events = malloc(GFX_TRACE_EVENTS*sizeof(trace_event_t));
+    FILE *f = events ? fopen(path, "w") : NULL;
+    if (!f) {
+        free(events);
+        return -1;
+    }
+    double us_per_tick = 1e6 / SDL_GetPerformanceFrequency();
+    int pid = getpid(), count = 0;
+    fprintf(f, "{\"traceEvents\":[");
+    for (trace_ring_t *ring = __atomic_load_n(&trace_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next) {
+        uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        uint64_t first = head > GFX_TRACE_EVENTS ? head - GFX_TRACE_EVENTS : 0;
+        for (uint64_t i = first; i < head; i++) {
+            events[i-first] = ring->events[i & (GFX_TRACE_EVENTS-1)];
+        }
+        // Event i is being overwritten once the writer reached i + GFX_TRACE_EVENTS.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint64_t now = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+        uint64_t valid = now >= GFX_TRACE_EVENTS ? now - GFX_TRACE_EVENTS + 1 : 0;
+        for (uint64_t i = SDL_max(first, valid); i < head; i++) {
+            const trace_event_t *e = &events[i-first];
+            fprintf(f, "%s\n{\"name\":", count++ ? "," : "");
+            json_string(f, e->name);
+            fprintf(f, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%u}",
+                    e->start*us_per_tick, (e->end-e->start)*us_per_tick, pid, e->tid);
+        }
+    }
+    fprintf(f, "\n]}\n");
+    free(events);
+    if (fclose(f) != 0) {
+        return -1;
+    }
+    return count;
+}
+
+/// Signal handler: only requests a dump, written by the next gfx_present.
+static void trace_signal_handler(int signum) {
+    (void)signum;
+    trace_dump_requested = 1;
+}
+
+/// Dump the trace whenever a signal is received (e.g. kill -USR1 <pid>).
+/// The file is written by the next gfx_present, out of the signal handler.
+/// @param signum signal to catch.
+/// @param path file to write.
+/// @return 0 on success, -1 on failure.
+int gfx_trace_dump_on_signal(int signum, const char *path) {
+    char *copy = strdup(path);
+    struct sigaction sa = { .sa_handler = trace_signal_handler, .sa_flags = SA_RESTART };
+    sigemptyset(&sa.sa_mask);
+    if (!copy || sigaction(signum, &sa, NULL) != 0) {
+        free(copy);
+        return -1;
+    }
+    free(trace_signal_path);
+    trace_signal_path = copy;
+    return 0;
+}
+
+/// Write the trace if a signal asked for it (called by gfx_present).
+void gfx_trace_poll(void) {
+    if (trace_dump_requested && trace_signal_path) {
+        trace_dump_requested = 0;
+        int count = gfx_trace_dump(trace_signal_path);
+        if (count < 0) {
+            fprintf(stderr, "Failed writing trace \"%s\"\n", trace_signal_path);
+        } else {
+            fprintf(stderr, "Trace \"%s\": %d events\n", trace_signal_path, count);
+        }
+    }
+}
@@ -0,0 +1,285 @@
+/// @file golden.c
+/// Golden-image regression tests.
+/// Renders scripted frames headless (dummy video driver, software renderer), reads
+/// back the composited frame and compares it with a reference PNG stored in
+/// tests/golden. A missing reference is a failure: set GOLDEN_UPDATE=1 to (re)create
+/// all of them after adding a scene or an intended rendering change. On mismatch,
+/// the frame and a diff image (mismatches in red) are written to tests/output.
+
+#include <stdlib.h>
+#include <sys/stat.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "../gfx.h"
+#include "../examples/plasma.h"
+
+GFX_ASSET_DECLARE(tux_cow);
+
+#define WIDTH  640
+#define HEIGHT 360
+#define GOLDEN_DIR "tests/golden"
+#define OUTPUT_DIR "tests/output"
+
+typedef struct {
+    char *name;
+    void (*render)(gfx_context_t *ctxt);
+    uint8_t tolerance[4];  // maximum difference allowed per channel: r, g, b, a
+    SDL_Rect ignore[4];    // regions excluded from the comparison (w == 0 ends the list)
+} scene_t;
+
+typedef struct {
+    int mismatches;        // number of pixels out of tolerance
+    int max_delta;         // largest channel difference found
+} diff_result_t;
+
+static SDL_Texture *sprite_jedi = NULL;
+static SDL_Texture *sprite_cow = NULL;
+
+/// Compare two images of width*height packed pixels.
+/// A pixel mismatches if any channel differs by more than its tolerance.
+/// @param a first image.
+/// @param b second image.
+/// @param count number of pixels.
+/// @param tolerance per channel tolerance, packed like a pixel.
+/// @param mask per pixel mask (0 = ignored), or NULL to compare every pixel.
+/// @param diff if not NULL, receives a diff image: mismatches in red, ignored
+/// pixels in blue, matching pixels darkened.
+/// @return number of mismatching pixels and largest channel difference.
+static diff_result_t image_diff(const pixel_t *a, const pixel_t *b, int count, pixel_t tolerance, const uint8_t *mask, pixel_t *diff) {
+    diff_result_t res = { 0, 0 };
+    const pixel_t red = GFX_RGB(255,0,0), blue = GFX_RGB(0,0,96);
+    int i = 0;
+
+#ifdef __SSE2__
+    const __m128i tol = _mm_set1_epi32(tolerance), zero = _mm_setzero_si128();
+    __m128i max_delta = zero;
+    for (; i+4 <= count; i += 4) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a+i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b+i));
+        __m128i delta = _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+        __m128i over = _mm_subs_epu8(delta, tol);
+        int ok = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(over, zero)));
+        if (mask) {
+            __m128i keep = _mm_set_epi32(-!!mask[i+3], -!!mask[i+2], -!!mask[i+1], -!!mask[i]);
+            ok |= ~_mm_movemask_ps(_mm_castsi128_ps(keep)) & 0xf;
+            delta = _mm_and_si128(delta, keep);
+        }
+        max_delta = _mm_max_epu8(max_delta, delta);
+        res.mismatches += __builtin_popcount(~ok & 0xf);
+        if (diff) {
+            for (int k = 0; k < 4; k++) {
+                if (mask && !mask[i+k]) diff[i+k] = blue;
+                else if (!(ok & (1 << k))) diff[i+k] = red;
+                else diff[i+k] = (a[i+k] >> 2) & 0x3f3f3f3f;
+            }
+        }
+    }
+    uint8_t lanes[16];
+    _mm_storeu_si128((__m128i *)lanes, max_delta);
+    for (int k = 0; k < 16; k++) {
+        res.max_delta = SDL_max(res.max_delta, lanes[k]);
+    }
+#endif
+
+    for (; i < count; i++) {
+        bool ignored = mask && !mask[i];
+        bool ok = true;
+        for (int shift = 0; shift < 32 && !ignored; shift += 8) {
+            int delta = abs((int)((a[i] >> shift) & 0xff) - (int)((b[i] >> shift) & 0xff));
+            res.max_delta = SDL_max(res.max_delta, delta);
+            ok = ok && delta <= (int)((tolerance >> shift) & 0xff);
+        }
+        res.mismatches += !ok;
+        if (diff) {
+            diff[i] = ignored ? blue : !ok ? red : (a[i] >> 2) & 0x3f3f3f3f;
+        }
+    }
+    return res;
+}
+
+/// Save packed pixels as a PNG file.
+/// @return 0 on success, -1 on failure.
+static int image_save(const char *path, pixel_t *pixels) {
+    SDL_Surface *s = SDL_CreateRGBSurfaceWithFormatFrom(pixels, WIDTH, HEIGHT, 32, WIDTH*sizeof(pixel_t), gfx_pixel_layout.format);
+    if (!s) {
+        return -1;
+    }
+    int ret = IMG_SavePNG(s, path);
+    SDL_FreeSurface(s);
+    return ret;
+}
+
+/// Load a WIDTH x HEIGHT image file into packed pixels.
+/// @return 0 on success, -1 if the file is missing, invalid or of another size.
+static int image_load(const char *path, pixel_t *pixels) {
+    SDL_Surface *loaded = IMG_Load(path);
+    if (!loaded) {
+        return -1;
+    }
+    SDL_Surface *s = SDL_ConvertSurfaceFormat(loaded, gfx_pixel_layout.format, 0);
+    SDL_FreeSurface(loaded);
+    if (!s) {
+        return -1;
+    }
+    int ret = -1;
+    if (s->w == WIDTH && s->h == HEIGHT) {
+        SDL_LockSurface(s);
+        for (int j = 0; j < HEIGHT; j++) {
+            memcpy(pixels + WIDTH*j, (uint8_t *)s->pixels + s->pitch*j, WIDTH*sizeof(pixel_t));
+        }
+        SDL_UnlockSurface(s);
+        ret = 0;
+    }
+    SDL_FreeSurface(s);
+    return ret;
+}
+
+static void scene_clear(gfx_context_t *ctxt) {
+    gfx_background_clear(ctxt, GFX_COL_PURPLE);
+    gfx_background_update(ctxt);
+}
+
+/// Pseudo-random numbers independent of the C library, so that the noise scene
+/// renders the same everywhere (rand() differs between implementations).
+static uint32_t noise_seed;
+
+static uint32_t noise_rand() {
+    noise_seed = noise_seed*1664525u + 1013904223u;  // LCG from Numerical Recipes
+    return noise_seed >> 8;                         // the low bits are the least random
+}
+
+static void scene_noise(gfx_context_t *ctxt) {
+    noise_seed = 1;
+    gfx_background_clear(ctxt, GFX_COL_BLACK);
+    for (int i = 0; i < WIDTH*HEIGHT/10; i++) {
+        int x = noise_rand() % ctxt->width;
+        int y = noise_rand() % ctxt->height;
+        uint32_t intensity = noise_rand() % 256;
+        gfx_background_putpixel(ctxt, x, y, GFX_RGB(intensity,intensity,intensity));
+    }
+    gfx_background_update(ctxt);
+}
+
+static void scene_plasma(gfx_context_t *ctxt) {
+    for (int i = 0; i < 20; i++) {
+        render_plasma(ctxt);
+    }
+    gfx_background_update(ctxt);
+}
+
+static void scene_sprites(gfx_context_t *ctxt) {
+    render_plasma(ctxt);
+    gfx_background_update(ctxt);
+    gfx_sprite_render(ctxt, sprite_jedi, 400, 100, 128, 128);
+    gfx_sprite_render(ctxt, sprite_cow, 30, 40, 256, 256);
+}
+
+// Scenes run in this order: the plasma keeps its animation state between scenes.
+static scene_t scenes[] = {
+    { "clear",   scene_clear,   { 0, 0, 0, 255 }, { { 0 } } },
+    { "noise",   scene_noise,   { 0, 0, 0, 255 }, { { 0 } } },
+    { "plasma",  scene_plasma,  { 0, 0, 0, 255 }, { { 0 } } },
+    { "sprites", scene_sprites, { 2, 2, 2, 255 }, { { 0 } } },
+};
+
+/// Render a scene, read it back and compare it with its golden image.
+/// @return true if the scene passed (or its golden image was written on update).
+static bool scene_run(gfx_context_t *ctxt, scene_t *scene, bool update, pixel_t *frame, pixel_t *golden, uint8_t *mask) {
+    char path[256], out_path[256];
+    snprintf(path, sizeof(path), GOLDEN_DIR "/%s.png", scene->name);
+
+    scene->render(ctxt);
+    if (SDL_RenderReadPixels(ctxt->renderer, NULL, gfx_pixel_layout.format, frame, WIDTH*sizeof(pixel_t)) != 0) {
+        printf("FAIL %-10s read back: %s\n", scene->name, SDL_GetError());
+        return false;
+    }
+    gfx_present(ctxt);
+
+    // Background alpha is meaningless, make the frame opaque so that PNGs can be viewed.
+    pixel_t opaque = gfx_rgba(0, 0, 0, 255);
+    for (int i = 0; i < WIDTH*HEIGHT; i++) {
+        frame[i] |= opaque;
+    }
+
+    if (update) {
+        if (image_save(path, frame) < 0) {
+            printf("FAIL %-10s cannot write %s\n", scene->name, path);
+            return false;
+        }
+        printf("NEW  %-10s %s\n", scene->name, path);
+        return true;
+    }
+    if (image_load(path, golden) < 0) {
+        printf("FAIL %-10s missing or invalid %s (GOLDEN_UPDATE=1 creates it)\n", scene->name, path);
+        return false;
+    }
+
+    memset(mask, 1, WIDTH*HEIGHT);
+    for (int r = 0; r < 4 && scene->ignore[r].w; r++) {
+        SDL_Rect *rect = &scene->ignore[r];
+        for (int j = SDL_max(rect->y, 0); j < SDL_min(rect->y+rect->h, HEIGHT); j++) {
+            int x0 = SDL_max(rect->x, 0), x1 = SDL_min(rect->x+rect->w, WIDTH);
+            if (x1 > x0) memset(mask + WIDTH*j + x0, 0, x1-x0);
+        }
+    }
+
+    uint8_t *t = scene->tolerance;
+    pixel_t tolerance = gfx_rgba(t[0], t[1], t[2], t[3]);
+    diff_result_t res = image_diff(frame, golden, WIDTH*HEIGHT, tolerance, mask, NULL);
+    if (res.mismatches == 0) {
+        printf("OK   %-10s max delta %d\n", scene->name, res.max_delta);
+        return true;
+    }
+
+    image_diff(frame, golden, WIDTH*HEIGHT, tolerance, mask, golden);
+    mkdir(OUTPUT_DIR, 0755);
+    snprintf(out_path, sizeof(out_path), OUTPUT_DIR "/%s.png", scene->name);
+    image_save(out_path, frame);
+    snprintf(out_path, sizeof(out_path), OUTPUT_DIR "/%s_diff.png", scene->name);
+    image_save(out_path, golden);
+    printf("FAIL %-10s %d pixels differ (max delta %d), see %s\n", scene->name, res.mismatches, res.max_delta, out_path);
+    return false;
+}
+
+/// Program entry point.
+/// @return the number of failed scenes.
+int main() {
+    // Headless and always the same renderer, so that frames are reproducible.
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+    gfx_context_t *ctxt = gfx_create("Golden Tests", WIDTH, HEIGHT);
+    if (!ctxt) {
+        fprintf(stderr, "Graphics initialization failed!\n");
+        return EXIT_FAILURE;
+    }
+    sprite_jedi = gfx_sprite_load(ctxt, "examples/tux_jedi.png");
+    sprite_cow = gfx_sprite_create_embedded(ctxt, gfx_asset_tux_cow);
+    pixel_t *frame = malloc(WIDTH*HEIGHT*sizeof(pixel_t));
+    pixel_t *golden = malloc(WIDTH*HEIGHT*sizeof(pixel_t));
+    uint8_t *mask = malloc(WIDTH*HEIGHT);
+    if (!sprite_jedi || !sprite_cow || !frame || !golden || !mask) {
+        fprintf(stderr, "Test setup failed!\n");
+        return EXIT_FAILURE;
+    }
+
+    char *update_env = getenv("GOLDEN_UPDATE");
+    bool update = update_env && strcmp(update_env, "1") == 0;
+    if (update) {
+        mkdir(GOLDEN_DIR, 0755);
+    }
+
+    int failed = 0;
+    for (size_t i = 0; i < sizeof(scenes)/sizeof(scenes[0]); i++) {
+        failed += !scene_run(ctxt, &scenes[i], update, frame, golden, mask);
+    }
+
+    free(mask);
+    free(golden);
+    free(frame);
+    gfx_sprite_destroy(sprite_jedi);
+    gfx_sprite_destroy(sprite_cow);
+    gfx_destroy(ctxt);
+    return failed;
+}
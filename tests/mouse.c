@@ -0,0 +1,66 @@
+/// @file mouse.c
+/// Mouse coordinates under the resize policies: a headless window is resized,
+/// mouse events are posted in window coordinates (going through SDL's renderer
+/// event watch like real ones) and gfx_mouse_state must report the background
+/// pixel under the pointer.
+
+#include <stdlib.h>
+#include "../gfx.h"
+
+#define WIDTH  320
+#define HEIGHT 200
+
+/// Resize the window and let the context handle the resize event.
+static void resize(gfx_context_t *ctxt, int width, int height) {
+    SDL_SetWindowSize(ctxt->window, width, height);
+    while (gfx_keypressed() != 0) {
+    }
+}
+
+/// Post a mouse motion at a window position and check the background position.
+/// @return true if the check passed.
+static bool check_motion(gfx_context_t *ctxt, const char *name, int window_x, int window_y, int x, int y) {
+    SDL_Event event = { 0 };
+    event.type = SDL_MOUSEMOTION;
+    event.motion.windowID = SDL_GetWindowID(ctxt->window);
+    event.motion.x = window_x;
+    event.motion.y = window_y;
+    SDL_PushEvent(&event);
+    while (gfx_keypressed() != 0) {
+    }
+    int mx, my;
+    gfx_mouse_state(ctxt, &mx, &my);
+    bool ok = mx == x && my == y;
+    printf("%-22s %s: (%d, %d) -> (%d, %d), expected (%d, %d)\n", name, ok ? "OK  " : "FAIL",
+           window_x, window_y, mx, my, x, y);
+    return ok;
+}
+
+/// Program entry point.
+/// @return the application status code (0 if success).
+int main() {
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+    gfx_context_t *ctxt = gfx_create("Mouse Test", WIDTH, HEIGHT);
+    if (!ctxt) {
+        fprintf(stderr, "Graphics initialization failed!\n");
+        return EXIT_FAILURE;
+    }
+
+    int failed = 0;
+    failed += !check_motion(ctxt, "initial size", 100, 150, 100, 150);
+
+    // 640x600: scaled 2x, 100 pixel bars above and below the image
+    gfx_resize_policy_set(ctxt, GFX_RESIZE_LETTERBOX);
+    resize(ctxt, 640, 600);
+    failed += !check_motion(ctxt, "letterbox resized", 100, 150, 50, 25);
+    failed += !check_motion(ctxt, "letterbox last pixel", 639, 499, 319, 199);
+    failed += !check_motion(ctxt, "letterbox bar", 100, 50, 50, -25);
+
+    gfx_resize_policy_set(ctxt, GFX_RESIZE_STRETCH);
+    failed += !check_motion(ctxt, "stretch resized", 100, 150, 50, 50);
+
+    gfx_destroy(ctxt);
+    return failed;
+}
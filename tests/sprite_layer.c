@@ -0,0 +1,109 @@
+/// @file sprite_layer.c
+/// Sprite layer test: instances are added one at a time on a grid covering the
+/// screen, plus some off screen, then a third of them are removed. The layer
+/// must grow reasonably, draw the instances left and cull the others, which is
+/// checked on the frame read back.
+
+#include <stdlib.h>
+#include "../gfx.h"
+
+#define WIDTH  320
+#define HEIGHT 200
+#define CELL   8
+#define COLUMNS (WIDTH/CELL)
+#define GRID   (COLUMNS*(HEIGHT/CELL))
+#define OFFSCREEN 10
+
+/// Whether the cell of grid instance i is filled with the sprite's color.
+static bool cell_filled(const pixel_t *frame, int i, pixel_t color) {
+    int x0 = i % COLUMNS * CELL, y0 = i / COLUMNS * CELL;
+    pixel_t rgb = ~((pixel_t)0xff << gfx_pixel_layout.a_shift);  // the frame's alpha is meaningless
+    for (int y = y0; y < y0+CELL; y++) {
+        for (int x = x0; x < x0+CELL; x++) {
+            if ((frame[WIDTH*y + x] & rgb) != (color & rgb)) return false;
+        }
+    }
+    return true;
+}
+
+/// Program entry point.
+/// @return the application status code (0 if success).
+int main() {
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+    gfx_context_t *ctxt = gfx_create("Sprite Layer Test", WIDTH, HEIGHT);
+    if (!ctxt) {
+        fprintf(stderr, "Graphics initialization failed!\n");
+        return EXIT_FAILURE;
+    }
+    uint8_t pixels[CELL*CELL*4];
+    for (int i = 0; i < CELL*CELL; i++) {
+        pixels[4*i] = 255;
+        pixels[4*i+1] = 128;
+        pixels[4*i+2] = 0;
+        pixels[4*i+3] = 255;
+    }
+    SDL_Texture *sprite = gfx_sprite_create(ctxt, pixels, CELL, CELL);
+    gfx_sprite_layer_t *layer = gfx_sprite_layer_create(0);
+    pixel_t *frame = malloc(WIDTH*HEIGHT*sizeof(pixel_t));
+    int texture = layer ? gfx_sprite_layer_texture(layer, sprite) : -1;
+    if (!sprite || !frame || texture < 0) {
+        fprintf(stderr, "Test setup failed!\n");
+        return EXIT_FAILURE;
+    }
+
+    int failed = 0;
+    for (int i = 0; i < GRID + OFFSCREEN; i++) {
+        gfx_sprite_instance_t inst = {
+            .x = i < GRID ? i % COLUMNS * CELL : -100 - CELL*i, .y = i < GRID ? i / COLUMNS * CELL : 50,
+            .w = CELL, .h = CELL, .texture = texture,
+        };
+        if (gfx_sprite_layer_add(layer, &inst, 1) != i) {
+            printf("add            FAIL: instance %d\n", i);
+            failed++;
+            break;
+        }
+    }
+    bool ok = layer->count == GRID + OFFSCREEN && layer->capacity < 2*layer->count;
+    printf("add one by one %s: %d instances, capacity %d\n", ok ? "OK  " : "FAIL", layer->count, layer->capacity);
+    failed += !ok;
+
+    // Remove the grid instances of index multiple of 3: their cells become empty.
+    int removed[GRID];
+    int n = 0;
+    for (int i = 0; i < GRID; i += 3) {
+        removed[n++] = i;
+    }
+    gfx_sprite_layer_remove(layer, removed, n);
+    ok = layer->count == GRID + OFFSCREEN - n;
+    printf("remove         %s: %d instances left\n", ok ? "OK  " : "FAIL", layer->count);
+    failed += !ok;
+
+    gfx_background_clear(ctxt, GFX_COL_BLACK);
+    gfx_background_update(ctxt);
+    int drawn = gfx_sprite_layer_render(ctxt, layer);
+    ok = drawn == GRID - n;
+    printf("render         %s: %d drawn, %d expected\n", ok ? "OK  " : "FAIL", drawn, GRID - n);
+    failed += !ok;
+
+    if (SDL_RenderReadPixels(ctxt->renderer, NULL, gfx_pixel_layout.format, frame, WIDTH*sizeof(pixel_t)) != 0) {
+        printf("read back      FAIL: %s\n", SDL_GetError());
+        failed++;
+    } else {
+        int wrong = 0;
+        pixel_t color = GFX_RGB(255, 128, 0);
+        for (int i = 0; i < GRID; i++) {
+            wrong += cell_filled(frame, i, color) != (i % 3 != 0);
+        }
+        printf("frame          %s: %d wrong cells\n", wrong ? "FAIL" : "OK  ", wrong);
+        failed += wrong != 0;
+    }
+    gfx_present(ctxt);
+
+    free(frame);
+    gfx_sprite_layer_destroy(layer);
+    gfx_sprite_destroy(sprite);
+    gfx_destroy(ctxt);
+    return failed;
+}
@@ -0,0 +1,116 @@
+/// @file stream.c
+/// Loopback test of the framebuffer stream: a headless context streams its
+/// background over a Unix socket to a receiver in the same process, which must
+/// reassemble identical frames from the changed tiles only.
+
+#include <stdlib.h>
+#include <poll.h>
+#include <unistd.h>
+#include "../gfx.h"
+
+#define WIDTH  320  // 5x4 tiles, the last row partial
+#define HEIGHT 200
+#define TILES  (((WIDTH+GFX_STREAM_TILE-1)/GFX_STREAM_TILE) * ((HEIGHT+GFX_STREAM_TILE-1)/GFX_STREAM_TILE))
+#define SYNC_ATTEMPTS 500
+
+/// Present frames until the receiver gets a message.
+/// @return 0 on success, -1 on failure or timeout.
+static int sync_frame(gfx_context_t *ctxt, int fd, gfx_stream_view_t *view) {
+    for (int i = 0; i < SYNC_ATTEMPTS; i++) {
+        gfx_present(ctxt);
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        if (poll(&pfd, 1, 10) > 0) {
+            return gfx_stream_receive(fd, view);
+        }
+    }
+    return -1;
+}
+
+/// Whether the reassembled frame equals the background.
+static bool view_matches(gfx_context_t *ctxt, const gfx_stream_view_t *view, uint32_t *row) {
+    if (view->width != ctxt->width || view->height != ctxt->height) {
+        return false;
+    }
+    for (int j = 0; j < ctxt->height; j++) {
+        const pixel_t *src = (const pixel_t *)((const uint8_t *)ctxt->background + ctxt->pitch*j);
+        gfx_pixels_convert(row, &gfx_pixel_layout_rgba32, src, &gfx_pixel_layout, ctxt->width);
+        if (memcmp(row, view->pixels + view->width*j, ctxt->width*sizeof(uint32_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Check one step: the frame received, its number of tiles and its size.
+/// @return true if the step passed.
+static bool check_step(gfx_context_t *ctxt, int fd, gfx_stream_view_t *view, uint32_t *row, const char *name, int tiles) {
+    gfx_stream_stats_t before, after;
+    gfx_stream_stats(ctxt, &before);
+    bool ok = sync_frame(ctxt, fd, view) == 0 && view_matches(ctxt, view, row) && view->tiles == tiles;
+    // The sender counts a message once fully written, possibly after it was received.
+    for (int i = 0; i < SYNC_ATTEMPTS; i++) {
+        gfx_stream_stats(ctxt, &after);
+        if (after.frames > before.frames) break;
+        usleep(1000);
+    }
+    printf("%-14s %s: %2d tiles, %7llu bytes\n", name, ok ? "OK  " : "FAIL", view->tiles,
+           (unsigned long long)(after.bytes - before.bytes));
+    return ok;
+}
+
+/// Program entry point.
+/// @return the application status code (0 if success).
+int main() {
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+    gfx_context_t *ctxt = gfx_create("Stream Test", WIDTH, HEIGHT);
+    if (!ctxt) {
+        fprintf(stderr, "Graphics initialization failed!\n");
+        return EXIT_FAILURE;
+    }
+    char address[64];
+    snprintf(address, sizeof(address), "unix:/tmp/gfx_stream_test.%d", (int)getpid());
+    uint32_t *row = malloc(WIDTH*sizeof(uint32_t));
+    int fd = -1;
+    if (!row || gfx_stream_start(ctxt, address) < 0 || (fd = gfx_stream_connect(address)) < 0) {
+        fprintf(stderr, "Test setup failed!\n");
+        return EXIT_FAILURE;
+    }
+
+    gfx_stream_view_t view = { 0 };
+    int failed = 0;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            gfx_background_putpixel(ctxt, x, y, GFX_RGB(x, y, (x^y) & 0xff));
+        }
+    }
+    failed += !check_step(ctxt, fd, &view, row, "full frame", TILES);
+
+    gfx_background_putpixel(ctxt, 100, 100, GFX_COL_WHITE);
+    failed += !check_step(ctxt, fd, &view, row, "one pixel", 1);
+
+    for (int y = 60; y < 70; y++) {
+        for (int x = 60; x < 70; x++) {
+            gfx_background_putpixel(ctxt, x, y, GFX_RGB(255, 0, 0));
+        }
+    }
+    failed += !check_step(ctxt, fd, &view, row, "tile corner", 4);
+
+    gfx_background_putpixel(ctxt, WIDTH-1, HEIGHT-1, GFX_COL_BLACK);
+    failed += !check_step(ctxt, fd, &view, row, "partial tile", 1);
+
+    srand(1);
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            gfx_background_putpixel(ctxt, x, y, GFX_RGB(rand() & 0xff, rand() & 0xff, rand() & 0xff));
+        }
+    }
+    failed += !check_step(ctxt, fd, &view, row, "noise", TILES);
+
+    close(fd);
+    gfx_stream_view_free(&view);
+    free(row);
+    gfx_destroy(ctxt);
+    return failed;
+}
@@ -0,0 +1,247 @@
+/// @file gfxbench.c
+/// Benchmark of gfxlib primitives, rendered headless with the software
+/// renderer so that all the work is done by the CPU. Each primitive is timed
+/// and, when the kernel permits it (see /proc/sys/kernel/perf_event_paranoid),
+/// measured with hardware counters: IPC and bytes per cycle tell whether it is
+/// bound by computation or by memory, LLC and branch misses tell why.
+/// Usage: gfxbench [name...]   (benchmarks whose name contains one of the arguments)
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "../gfx.h"
+#include "../examples/plasma.h"
+
+#define WIDTH  1280
+#define HEIGHT 720
+#define MIN_TIME 0.25           // seconds measured per benchmark, at least
+#define MIN_RUNS 5
+#define PARTICLES 200000
+#define SPRITES 64
+
+// Hardware counters, opened as one group so that they count the same runs.
+enum { CTR_CYCLES, CTR_INSTRUCTIONS, CTR_LLC_MISSES, CTR_BRANCH_MISSES, CTR_COUNT };
+
+static const struct {
+    uint32_t type;
+    uint64_t config;
+} counter_events[CTR_COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+};
+
+typedef struct {
+    int fd[CTR_COUNT];          // -1 if not available
+    double value[CTR_COUNT];    // last measure, scaled if the counters were multiplexed
+} counters_t;
+
+typedef struct {
+    char *name;
+    void (*run)(gfx_context_t *ctxt);
+    double pixels;              // pixels processed per run
+    double bytes;               // bytes read and written by the CPU per run
+} bench_t;
+
+static gfx_particles_t *particles = NULL;
+static SDL_Texture *sprite = NULL;
+static pixel_t *scratch = NULL;
+static uint32_t *rle_pixels = NULL;
+static uint8_t *rle_control = NULL;
+
+/// Open the counters of the calling thread, user space only.
+/// Those the kernel or the CPU refuse are left at -1.
+static void counters_open(counters_t *c) {
+    for (int i = 0; i < CTR_COUNT; i++) {
+        struct perf_event_attr attr = {
+            .size = sizeof(struct perf_event_attr),
+            .type = counter_events[i].type,
+            .config = counter_events[i].config,
+            .disabled = i == 0,  // the leader starts and stops the group
+            .exclude_kernel = 1,
+            .exclude_hv = 1,
+            .read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING,
+        };
+        int leader = c->fd[CTR_CYCLES];
+        c->fd[i] = i > 0 && leader < 0 ? -1 : syscall(SYS_perf_event_open, &attr, 0, -1, i ? leader : -1, 0);
+        c->value[i] = -1;
+    }
+}
+
+static void counters_start(counters_t *c) {
+    if (c->fd[CTR_CYCLES] >= 0) {
+        ioctl(c->fd[CTR_CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(c->fd[CTR_CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+static void counters_stop(counters_t *c) {
+    if (c->fd[CTR_CYCLES] < 0) {
+        return;
+    }
+    ioctl(c->fd[CTR_CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    for (int i = 0; i < CTR_COUNT; i++) {
+        uint64_t v[3];  // value, time enabled, time running
+        c->value[i] = -1;
+        if (c->fd[i] >= 0 && read(c->fd[i], v, sizeof(v)) == sizeof(v) && v[2] > 0) {
+            c->value[i] = (double)v[0] * v[1] / v[2];
+        }
+    }
+}
+
+static void counters_close(counters_t *c) {
+    for (int i = 0; i < CTR_COUNT; i++) {
+        if (c->fd[i] >= 0) close(c->fd[i]);
+    }
+}
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static void bench_clear(gfx_context_t *ctxt) {
+    gfx_background_clear(ctxt, GFX_COL_BLUE);
+}
+
+static void bench_putpixel(gfx_context_t *ctxt) {
+    for (int y = 0; y < ctxt->height; y++) {
+        for (int x = 0; x < ctxt->width; x++) {
+            gfx_background_putpixel(ctxt, x, y, (pixel_t)(x ^ y));
+        }
+    }
+}
+
+static void bench_plasma(gfx_context_t *ctxt) {
+    render_plasma(ctxt);
+}
+
+static void bench_convert(gfx_context_t *ctxt) {
+    gfx_pixels_convert(scratch, &gfx_pixel_layout_rgba32, ctxt->background, &gfx_pixel_layout, ctxt->width*ctxt->height);
+}
+
+static void bench_update(gfx_context_t *ctxt) {
+    gfx_background_update(ctxt);
+}
+
+static void bench_sprites(gfx_context_t *ctxt) {
+    for (int i = 0; i < SPRITES; i++) {
+        gfx_sprite_render(ctxt, sprite, (i*97) % (ctxt->width-128), (i*61) % (ctxt->height-128), 128, 128);
+    }
+}
+
+static void bench_particles(gfx_context_t *ctxt) {
+    gfx_particles_update(particles, 0.001f);
+    gfx_particles_render(ctxt, particles);
+}
+
+static void bench_rle(gfx_context_t *ctxt) {
+    uint32_t control_size;
+    gfx_rle_encode(ctxt->background, ctxt->width*ctxt->height, rle_control, rle_pixels, &control_size);
+}
+
+static bench_t benches[] = {
+    { "background_clear",    bench_clear,     WIDTH*HEIGHT,  WIDTH*HEIGHT*4.0 },
+    { "background_putpixel", bench_putpixel,  WIDTH*HEIGHT,  WIDTH*HEIGHT*4.0 },
+    { "plasma",              bench_plasma,    WIDTH*HEIGHT,  WIDTH*HEIGHT*4.0 },
+    { "pixels_convert",      bench_convert,   WIDTH*HEIGHT,  WIDTH*HEIGHT*8.0 },
+    { "background_update",   bench_update,    WIDTH*HEIGHT,  WIDTH*HEIGHT*12.0 },  // upload, then copy to the window
+    { "sprite_render",       bench_sprites,   SPRITES*128*128, SPRITES*128*128*12.0 },  // read sprite and target, write target
+    { "particles",           bench_particles, PARTICLES,     PARTICLES*(24+2*4.0) },  // arrays, then read-modify-write
+    { "rle_encode",          bench_rle,       WIDTH*HEIGHT,  WIDTH*HEIGHT*8.0 },
+};
+
+/// Whether a benchmark was selected on the command line.
+static bool selected(const char *name, int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strstr(name, argv[i])) return true;
+    }
+    return argc <= 1;
+}
+
+/// Print a value or a dash when it is unknown.
+static void print_value(double value, const char *format) {
+    if (value >= 0) {
+        printf(format, value);
+    } else {
+        printf("%*s", atoi(format+1), "-");
+    }
+}
+
+/// Program entry point.
+/// @return the application status code (0 if success).
+int main(int argc, char **argv) {
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+    gfx_context_t *ctxt = gfx_create("gfxbench", WIDTH, HEIGHT);
+    if (!ctxt) {
+        fprintf(stderr, "Graphics initialization failed!\n");
+        return EXIT_FAILURE;
+    }
+    sprite = gfx_sprite_load(ctxt, "examples/tux_jedi.png");
+    particles = gfx_particles_create(PARTICLES);
+    scratch = malloc(WIDTH*HEIGHT*sizeof(pixel_t));
+    rle_pixels = malloc(WIDTH*HEIGHT*sizeof(uint32_t));
+    rle_control = malloc(WIDTH*HEIGHT);
+    if (!particles || !scratch || !rle_pixels || !rle_control) {
+        fprintf(stderr, "Out of memory!\n");
+        return EXIT_FAILURE;
+    }
+    gfx_particles_emit(particles, PARTICLES, WIDTH/2, HEIGHT/2, 200, 1e9f, GFX_RGB(40, 20, 10));
+    render_plasma(ctxt);
+
+    counters_t counters;
+    counters_open(&counters);
+    if (counters.fd[CTR_CYCLES] < 0) {
+        fprintf(stderr, "Hardware counters unavailable (check /proc/sys/kernel/perf_event_paranoid): timing only.\n");
+    }
+
+    printf("%-20s %9s %9s %6s %9s %10s %10s\n", "benchmark", "MPix/s", "GB/s", "IPC", "bytes/cyc", "LLC/kpix", "brmiss/kpix");
+    for (size_t b = 0; b < sizeof(benches)/sizeof(benches[0]); b++) {
+        bench_t *bench = &benches[b];
+        if (!selected(bench->name, argc, argv) || (bench->run == bench_sprites && !sprite)) {
+            continue;
+        }
+        bench->run(ctxt);  // warm up caches and lazy initializations
+
+        // Calibrate the number of runs on the wall clock, then measure them.
+        int runs = MIN_RUNS;
+        double elapsed = 0;
+        for (;;) {
+            counters_start(&counters);
+            double start = now();
+            for (int i = 0; i < runs; i++) {
+                bench->run(ctxt);
+            }
+            elapsed = now() - start;
+            counters_stop(&counters);
+            if (elapsed >= MIN_TIME) break;
+            runs = elapsed > 0 ? SDL_max(2*runs, (int)(runs*MIN_TIME*1.2/elapsed)) : 2*runs;
+        }
+
+        double *v = counters.value;
+        double pixels = bench->pixels*runs, bytes = bench->bytes*runs;
+        printf("%-20s ", bench->name);
+        print_value(pixels/elapsed*1e-6, "%9.1f ");
+        print_value(bytes/elapsed*1e-9, "%9.2f ");
+        print_value(v[CTR_CYCLES] > 0 && v[CTR_INSTRUCTIONS] >= 0 ? v[CTR_INSTRUCTIONS]/v[CTR_CYCLES] : -1, "%6.2f ");
+        print_value(v[CTR_CYCLES] > 0 ? bytes/v[CTR_CYCLES] : -1, "%9.2f ");
+        print_value(v[CTR_LLC_MISSES] >= 0 ? v[CTR_LLC_MISSES]*1000/pixels : -1, "%10.2f ");
+        print_value(v[CTR_BRANCH_MISSES] >= 0 ? v[CTR_BRANCH_MISSES]*1000/pixels : -1, "%10.2f");
+        printf("\n");
+    }
+
+    counters_close(&counters);
+    free(rle_control);
+    free(rle_pixels);
+    free(scratch);
+    gfx_particles_destroy(particles);
+    if (sprite) gfx_sprite_destroy(sprite);
+    gfx_destroy(ctxt);
+    return EXIT_SUCCESS;
+}
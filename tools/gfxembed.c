@@ -0,0 +1,63 @@
+/// @file gfxembed.c
+/// Asset compiler: RLE-compresses an image into a blob that the Makefile links
+/// into programs (see gfx_asset_header_t and gfx_sprite_create_embedded).
+/// Usage: gfxembed image output.gfxz
+
+#include <stdlib.h>
+#include "../gfx.h"
+
+/// Program entry point.
+/// @return the application status code (0 if success).
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: gfxembed image output.gfxz\n");
+        return EXIT_FAILURE;
+    }
+    SDL_Surface *loaded = IMG_Load(argv[1]);
+    SDL_Surface *s = loaded ? SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0) : NULL;
+    if (loaded) SDL_FreeSurface(loaded);
+    if (!s) {
+        fprintf(stderr, "Failed loading \"%s\": %s\n", argv[1], IMG_GetError());
+        return EXIT_FAILURE;
+    }
+
+    int count = s->w*s->h;
+    uint32_t *pixels = malloc(count*sizeof(uint32_t));
+    uint32_t *out = malloc(count*sizeof(uint32_t));
+    uint8_t *control = malloc(count+3);
+    if (!pixels || !out || !control) {
+        fprintf(stderr, "Out of memory!\n");
+        return EXIT_FAILURE;
+    }
+    SDL_LockSurface(s);
+    for (int j = 0; j < s->h; j++) {
+        memcpy(pixels + s->w*j, (uint8_t *)s->pixels + s->pitch*j, s->w*sizeof(uint32_t));
+    }
+    SDL_UnlockSurface(s);
+
+    gfx_asset_header_t header = { .width = s->w, .height = s->h };
+    memcpy(header.magic, GFX_ASSET_MAGIC, sizeof(header.magic));
+    int n = gfx_rle_encode(pixels, count, control, out, &header.control_size);
+    uint32_t padded = (header.control_size+3)/4*4;
+    memset(control+header.control_size, 0, padded-header.control_size);
+
+    FILE *f = fopen(argv[2], "wb");
+    if (!f) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+    fwrite(&header, sizeof(header), 1, f);
+    fwrite(control, 1, padded, f);
+    fwrite(out, sizeof(uint32_t), n, f);
+    if (fclose(f) != 0) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+    printf("%s: %dx%d, %d -> %zu bytes\n", argv[1], s->w, s->h, count*4, sizeof(header)+padded+n*sizeof(uint32_t));
+
+    free(control);
+    free(out);
+    free(pixels);
+    SDL_FreeSurface(s);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+/// @file gfxpack.c
+/// Asset packer: decodes images once and writes their pixels, ready to be
+/// copied into textures, into a pack file loaded with gfx_pack_open.
+/// Usage: gfxpack [-f argb|abgr|rgba|bgra] output.pack image...
+/// Sprites are named after the image paths given on the command line.
+
+#include <stdlib.h>
+#include "../gfx.h"
+
+static const struct {
+    char *name;
+    Uint32 format;
+} formats[] = {
+    { "argb", SDL_PIXELFORMAT_ARGB8888 },
+    { "abgr", SDL_PIXELFORMAT_ABGR8888 },
+    { "rgba", SDL_PIXELFORMAT_RGBA8888 },
+    { "bgra", SDL_PIXELFORMAT_BGRA8888 },
+};
+
+static void usage() {
+    fprintf(stderr, "Usage: gfxpack [-f argb|abgr|rgba|bgra] output.pack image...\n");
+    fprintf(stderr, "Pack pixels in the renderer's native format (see list_drivers) to avoid any conversion at load time.\n");
+    exit(EXIT_FAILURE);
+}
+
+/// Pad the file with zeros up to the next multiple of GFX_PACK_ALIGN.
+static uint64_t pad(FILE *f, uint64_t offset) {
+    static const uint8_t zeros[GFX_PACK_ALIGN];
+    uint64_t aligned = (offset + GFX_PACK_ALIGN-1) / GFX_PACK_ALIGN * GFX_PACK_ALIGN;
+    fwrite(zeros, 1, aligned-offset, f);
+    return aligned;
+}
+
+/// Program entry point.
+/// @return the application status code (0 if success).
+int main(int argc, char **argv) {
+    Uint32 format = SDL_PIXELFORMAT_ARGB8888;
+    int first = 1;
+    if (argc > 2 && strcmp(argv[1], "-f") == 0) {
+        format = SDL_PIXELFORMAT_UNKNOWN;
+        for (size_t i = 0; i < sizeof(formats)/sizeof(formats[0]); i++) {
+            if (strcmp(argv[2], formats[i].name) == 0) format = formats[i].format;
+        }
+        if (format == SDL_PIXELFORMAT_UNKNOWN) usage();
+        first = 3;
+    }
+    if (argc-first < 2) usage();
+
+    char *output = argv[first];
+    char **images = argv+first+1;
+    int count = argc-first-1;
+
+    gfx_pack_header_t header = { .version = GFX_PACK_VERSION, .count = count };
+    memcpy(header.magic, GFX_PACK_MAGIC, sizeof(header.magic));
+    gfx_pack_entry_t *entries = calloc(count, sizeof(gfx_pack_entry_t));
+    SDL_Surface **surfaces = calloc(count, sizeof(SDL_Surface *));
+    if (!entries || !surfaces) {
+        fprintf(stderr, "Out of memory!\n");
+        return EXIT_FAILURE;
+    }
+
+    // Decode everything first to lay out the file.
+    uint64_t offset = sizeof(header) + count*sizeof(gfx_pack_entry_t);
+    for (int i = 0; i < count; i++) {
+        if (strlen(images[i]) >= GFX_PACK_NAME_LEN) {
+            fprintf(stderr, "Name too long: \"%s\"\n", images[i]);
+            return EXIT_FAILURE;
+        }
+        SDL_Surface *loaded = IMG_Load(images[i]);
+        surfaces[i] = loaded ? SDL_ConvertSurfaceFormat(loaded, format, 0) : NULL;
+        if (loaded) SDL_FreeSurface(loaded);
+        if (!surfaces[i]) {
+            fprintf(stderr, "Failed loading \"%s\": %s\n", images[i], IMG_GetError());
+            return EXIT_FAILURE;
+        }
+        gfx_pack_entry_t *e = &entries[i];
+        strcpy(e->name, images[i]);
+        e->format = format;
+        e->width = surfaces[i]->w;
+        e->height = surfaces[i]->h;
+        e->pitch = e->width*sizeof(pixel_t);
+        offset = (offset + GFX_PACK_ALIGN-1) / GFX_PACK_ALIGN * GFX_PACK_ALIGN;
+        e->offset = offset;
+        offset += (uint64_t)e->pitch*e->height;
+    }
+
+    FILE *f = fopen(output, "wb");
+    if (!f) {
+        perror(output);
+        return EXIT_FAILURE;
+    }
+    fwrite(&header, sizeof(header), 1, f);
+    fwrite(entries, sizeof(gfx_pack_entry_t), count, f);
+    offset = sizeof(header) + count*sizeof(gfx_pack_entry_t);
+    for (int i = 0; i < count; i++) {
+        offset = pad(f, offset);
+        SDL_Surface *s = surfaces[i];
+        SDL_LockSurface(s);
+        for (int j = 0; j < s->h; j++) {
+            fwrite((uint8_t *)s->pixels + s->pitch*j, entries[i].pitch, 1, f);
+        }
+        SDL_UnlockSurface(s);
+        offset += (uint64_t)entries[i].pitch*entries[i].height;
+        printf("%s: %dx%d\n", entries[i].name, s->w, s->h);
+        SDL_FreeSurface(s);
+    }
+    if (fclose(f) != 0) {
+        perror(output);
+        return EXIT_FAILURE;
+    }
+
+    free(surfaces);
+    free(entries);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+/// @file gfxview.c
+/// Viewer of a framebuffer stream (see gfx_stream_start): reassembles the
+/// changed tiles it receives and displays the frame.
+/// Usage: gfxview unix:PATH | tcp:HOST:PORT
+
+#include <stdlib.h>
+#include <poll.h>
+#include <unistd.h>
+#include "../gfx.h"
+
+#define POLL_TIMEOUT 16  // ms, keeps the window responsive while nothing changes
+
+/// Program entry point.
+/// @return the application status code (0 if success).
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: gfxview unix:PATH | tcp:HOST:PORT\n");
+        return EXIT_FAILURE;
+    }
+    int fd = gfx_stream_connect(argv[1]);
+    if (fd < 0) {
+        fprintf(stderr, "Failed connecting to \"%s\"\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    gfx_stream_view_t view = { 0 };
+    gfx_context_t *ctxt = NULL;
+    int status = EXIT_SUCCESS;
+    while (!ctxt || gfx_keypressed() != SDLK_ESCAPE) {
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        if (poll(&pfd, 1, POLL_TIMEOUT) <= 0) {
+            continue;
+        }
+        if (gfx_stream_receive(fd, &view) < 0) {
+            fprintf(stderr, "Stream closed\n");
+            break;
+        }
+        if (ctxt && (ctxt->width != view.width || ctxt->height != view.height)) {
+            gfx_destroy(ctxt);
+            ctxt = NULL;
+        }
+        if (!ctxt) {
+            ctxt = gfx_create("gfxview", view.width, view.height);
+            if (!ctxt) {
+                fprintf(stderr, "Graphics initialization failed!\n");
+                status = EXIT_FAILURE;
+                break;
+            }
+        }
+        for (int j = 0; j < view.height; j++) {
+            pixel_t *dst = (pixel_t *)((uint8_t *)ctxt->background + ctxt->pitch*j);
+            gfx_pixels_convert(dst, &gfx_pixel_layout, view.pixels + view.width*j, &gfx_pixel_layout_rgba32, view.width);
+        }
+        gfx_background_update(ctxt);
+        gfx_present(ctxt);
+    }
+
+    if (ctxt) gfx_destroy(ctxt);
+    gfx_stream_view_free(&view);
+    close(fd);
+    return status;
+}